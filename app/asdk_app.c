@@ -20,7 +20,8 @@
 
 /* ASDK User Action: Declare new task below */
 
-static void task_always_run(void);
+static void task_vehicle_can(void);
+static void task_rpi(void);
 static void task_1ms(void);
 static void task_5ms(void);
 static void task_10ms(void);
@@ -30,8 +31,9 @@ static void task_1000ms(void);
 /* ASDK User Action: Update the scheduler with newly added task */
 
 static scheduler_t scheduler_config[] = {
-    /* Task Function               Periodicity   */
-    { .task_fn = task_always_run, .periodicty = 0 },
+    /* Task Function               Periodicity   Events */
+    { .task_fn = task_vehicle_can, .periodicty = VEHICLE_CAN_STATUS_CYCLE_MS, .events = VEHICLE_CAN_EVENT },
+    { .task_fn = task_rpi,         .periodicty = 0, .events = RPI_RX_EVENT },
     { .task_fn = task_1ms,         .periodicty = 1 },
     { .task_fn = task_5ms,         .periodicty = 5 },
     { .task_fn = task_10ms,       .periodicty = 10 },
@@ -60,12 +62,14 @@ void asdk_app_init()
 
     /* Initialize scheduler */
     scheduler_init(scheduler_config, scheduler_size);
+    scheduler_set_mode(SCHEDULER_MODE_DEADLINE);
 
     /* Initialize UART for debug messages */
     debug_uart_init();
 
     /* ASDK User Action: Add init calls here */
     app_gpio_init();
+    ultrasonic_init();
     app_can_init();
     app_adc_init();
     app_rpi_init();
@@ -79,7 +83,8 @@ void asdk_app_init()
 
 static void task_1ms(void)
 {
-    ultrasonic_iterations();
+    app_gpio_event_iteration();
+    app_rpi_idle_check();
 }
 
 static void task_5ms(void)
@@ -90,14 +95,15 @@ static void task_5ms(void)
 static void task_10ms(void)
 { 
     // DEBUG_PRINTF("Max Debug Uart Buffer Usage %d\r\n", debug_uart_get_max_usage());
-    app_rpi_iteration();
+    app_adc_iteration();
 }
 
 static void task_100ms(void)
 {
+    /* results of this burst are read on the next run */
+    ultrasonic_iterations();
     app_gpio_iteration();
     app_can_iteration();
-    app_adc_iteration();
 }
 
 static void task_1000ms(void)
@@ -105,11 +111,18 @@ static void task_1000ms(void)
     app_ldr_iteration();
 }
 
-static void task_always_run(void)
+/* every status cycle, right away on Rx, Tx complete and data updates */
+static void task_vehicle_can(void)
 {
-    asdk_can_service_send_iteration(VEHICLE_CAN);
-    asdk_can_service_receive_iteration(VEHICLE_CAN);
-    debug_uart_iteration();
+    asdk_can_service_periodic_iteration(VEHICLE_CAN);
+    asdk_can_service_send_batch(VEHICLE_CAN, VEHICLE_CAN_BATCH_SIZE, VEHICLE_CAN_BATCH_BUDGET_MS, NULL);
+    asdk_can_service_receive_batch(VEHICLE_CAN, VEHICLE_CAN_BATCH_SIZE, VEHICLE_CAN_BATCH_BUDGET_MS, NULL);
+}
+
+/* only when bytes are received, task_1ms runs the idle line check */
+static void task_rpi(void)
+{
+    app_rpi_iteration();
 }
 
 /* ASDK User actions ends ************************************************** */
@@ -1,3 +1,4 @@
 option(USE_SCHEDULER "Enable ASDK Scheduler" OFF)
 option(USE_RTOS "Enable RTOS" OFF)
 option(USE_CAN_SERVICE "Enable CAN Service" ON)
+option(USE_OS_PROFILE "Enable RTOS profiling (requires USE_RTOS)" OFF)
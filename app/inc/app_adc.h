@@ -5,13 +5,27 @@
 #include "asdk_adc.h"
 #include "asdk_mcu_pins.h"
 
+/* group scans collected per channel before the block is filtered */
+#define APP_ADC_BLOCK_SCANS 8U
+
+typedef struct {
+    bool median;       /* 3 point median ahead of the IIR, rejects single sample spikes */
+    uint8_t iir_shift; /* y += (x - y) >> iir_shift, 0 disables smoothing */
+} app_adc_filter_t;
+
 extern asdk_mcu_pin_t adc_pins[];
+extern app_adc_filter_t adc_filter[];
 extern asdk_adc_config_t adc_conf;
 
 /* Application specific APIs */
 void app_adc_init();
 void app_adc_start_conversion();
 void app_adc_iteration();
+void app_adc_group_callback(asdk_adc_callback_t info);
+
+/* filtered value by index in adc_pins[] */
+uint32_t app_adc_get_value(uint8_t channel);
+uint32_t app_adc_get_overruns(void);
 uint32_t app_get_adc_value(asdk_mcu_pin_t p_Pin);
 
 void app_ldr_iteration();
@@ -3,12 +3,36 @@
 
 #include "asdk_platform.h"
 #include "asdk_can_service.h"
+#include "scheduler.h"
 
 #define VEHICLE_CAN ASDK_CAN_MODULE_CAN_CH_1
 
+/* frames processed per super-loop pass, time budget in ms (0 = unlimited) */
+#define VEHICLE_CAN_BATCH_SIZE 16
+#define VEHICLE_CAN_BATCH_BUDGET_MS 0
+
+/* posted on frame received and transmit complete */
+#define VEHICLE_CAN_EVENT SCHEDULER_EVENT(1)
+
+/* dedicated Tx buffers kept full by the CAN service */
+#define VEHICLE_CAN_TX_MAILBOXES 8
+
+/* refresh period of the cyclic status messages */
+#define VEHICLE_CAN_STATUS_CYCLE_MS 100
+
+/* cyclic status messages, sent on change and every VEHICLE_CAN_STATUS_CYCLE_MS */
+typedef enum {
+    APP_CAN_MSG_HORN = 0,  /* 0x305, mux 0x01 */
+    APP_CAN_MSG_BRAKE,     /* 0x305, mux 0x03 */
+    APP_CAN_MSG_INDICATOR, /* 0x305, mux 0x04 */
+    APP_CAN_MSG_RIDE,      /* 0x306, riding mode and speed */
+    APP_CAN_MSG_MAX,
+} app_can_msg_t;
+
 void app_can_init();
 void app_can_deinit();
 void app_can_iteration();
 void app_can_send(uint32_t can_id, uint8_t *data, uint8_t data_length);
+void app_can_update(app_can_msg_t can_msg, uint8_t *data, uint8_t data_length);
 
 #endif // APP_CAN_H
@@ -16,6 +16,7 @@ extern const uint8_t gpio_input_config_size;
 /* Application specific APIs */
 void app_gpio_init();
 void app_gpio_iteration();
+void app_gpio_event_iteration();
 void app_gpio_toggle(asdk_mcu_pin_t pin);
 void app_gpio_set_pin_state(asdk_mcu_pin_t pin, bool state);
 bool app_gpio_get_pin_state(asdk_mcu_pin_t pin);
@@ -2,8 +2,17 @@
 #define APP_RPI_H
 
 #include "asdk_uart.h"
+#include "scheduler.h"
+
+/* Raspberry Pi link: COBS frames with CRC-16, see cobs_frame.h.
+   Payload byte 0 is the command, the rest its data. */
+#define RPI_FRAME_MAX_PAYLOAD 32
+
+/* posted from the UART interrupt when received bytes are buffered */
+#define RPI_RX_EVENT SCHEDULER_EVENT(2)
 
 void app_rpi_init();
 void app_rpi_iteration();
+void app_rpi_idle_check();
 
 #endif // APP_RPI_H
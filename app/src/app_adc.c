@@ -12,93 +12,178 @@
 /* Debug Print includes */
 #include "debug_print.h"
 
-#define ADC_PIN_SIZE    4U
+/* IIR state carries 8 fractional bits */
+#define ADC_IIR_FRAC_BITS 8U
 
 static asdk_errorcode_t status;
 
-volatile bool adc_complete;
-
 uint8_t tx_adc_buffer[8] = {0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA};
 
-asdk_adc_callback_t adc_callback_params;
+/* the DMA fills one half while the task filters the other */
+static uint32_t adc_block[2][APP_ADC_BLOCK_SCANS][ADC_CH_MAX];
 
-uint32_t sensor_raw_value[ADC_PIN_SIZE];
+/* filled halves so far times 2, plus the last filled half, in one store */
+static volatile uint32_t adc_block_seq;
+static uint32_t adc_block_taken;
+static uint32_t adc_block_overruns;
 
-uint8_t ADC_Index = 0;
+/* filter state, task context only */
+static uint32_t adc_median_history[ADC_CH_MAX][2];
+static uint32_t adc_iir_state[ADC_CH_MAX];
+static bool adc_filter_primed[ADC_CH_MAX];
+static uint32_t adc_filtered[ADC_CH_MAX];
 
 static uint32_t LDR_brightness_lvl;
 
-void adc_callback(asdk_adc_callback_t params)
+static uint32_t __app_adc_median3(uint32_t a, uint32_t b, uint32_t c)
 {
-    if (ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE == params.callback_reason)
+    if (a > b)
     {
-        adc_complete = true;
+        uint32_t t = a;
+        a = b;
+        b = t;
+    }
 
-        adc_callback_params.adc_pin = params.adc_pin;
-        adc_callback_params.callback_reason = params.callback_reason;
+    /* a <= b, median is b clamped to [a, c] */
+    if (b > c)
+    {
+        b = (a > c) ? a : c;
     }
+
+    return b;
+}
+
+static void __app_adc_filter(uint8_t channel, uint32_t sample)
+{
+    uint32_t *history = adc_median_history[channel];
+    uint32_t value = sample;
+
+    if (!adc_filter_primed[channel])
+    {
+        adc_filter_primed[channel] = true;
+        history[0] = sample;
+        history[1] = sample;
+        adc_iir_state[channel] = sample << ADC_IIR_FRAC_BITS;
+    }
+
+    if (adc_filter[channel].median)
+    {
+        value = __app_adc_median3(history[0], history[1], sample);
+        history[0] = history[1];
+        history[1] = sample;
+    }
+
+    /* y += (x - y) / 2^shift, computed on signed difference */
+    adc_iir_state[channel] = (uint32_t)((int32_t)adc_iir_state[channel] +
+                             (((int32_t)(value << ADC_IIR_FRAC_BITS) - (int32_t)adc_iir_state[channel]) >> adc_filter[channel].iir_shift));
+
+    adc_filtered[channel] = adc_iir_state[channel] >> ADC_IIR_FRAC_BITS;
+}
+
+/* DMA ISR: a half of the buffer is filled, the DMA went on to the other */
+void app_adc_group_callback(asdk_adc_callback_t info)
+{
+    uint32_t block;
+
+    if (ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE_HALF == info.callback_reason)
+    {
+        block = 0U;
+    }
+    else if (ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE == info.callback_reason)
+    {
+        block = 1U;
+    }
+    else
+    {
+        return;
+    }
+
+    ASDK_MEMORY_BARRIER()
+    adc_block_seq = ((adc_block_seq + 2U) & ~1UL) | block;
 }
 
 void app_adc_init()
 {
+    /* group scans are moved into adc_block by DMA */
+    adc_conf.dma_dest = &adc_block[0][0][0];
+    adc_conf.dma_dest_len = (uint8_t)(sizeof(adc_block) / sizeof(adc_block[0][0][0]));
+
     status = asdk_adc_init(&adc_conf);
     ASDK_DEV_ERROR_ASSERT(status, ASDK_SUCCESS);
 
-    status = asdk_adc_install_callback(adc_callback);
-    ASDK_DEV_ERROR_ASSERT(status, ASDK_SUCCESS);
+    /* filter state is sized by ADC_CH_MAX, the DMA packs scans of pin_count results */
+    ASDK_DEV_ERROR_ASSERT((adc_conf.pin_count == ADC_CH_MAX), true);
 }
 
 void app_adc_start_conversion()
 {
-    /* Trigger ADC conversion */
+    /* Start the group, it re-triggers itself in continuous mode */
 
-    status = asdk_adc_start_conversion_non_blocking(adc_pins[ADC_Index]);
+    status = asdk_adc_start_group_conversion_non_blocking(adc_conf.adc_group_instance);
     ASDK_DEV_ERROR_ASSERT(status, ASDK_SUCCESS);
 }
 
 void app_adc_iteration()
-{   
-    /* Handle sequence of conversion and also reads the converted values */
+{
+    uint32_t (*scans)[ADC_CH_MAX];
+    uint32_t seq = adc_block_seq;
+    uint32_t filled = (seq >> 1) - (adc_block_taken >> 1);
 
-    if (adc_complete)
+    /* Filter the last filled block, one channel at a time. It must be done
+       before the DMA wraps around to it, one block of scans later. */
+
+    if (0U == filled)
     {
-        adc_complete = false;
+        return;
+    }
+    ASDK_MEMORY_BARRIER()
 
-        status = asdk_adc_read_conversion_value_non_blocking(adc_callback_params.adc_pin, &sensor_raw_value[ADC_Index]);
-        ASDK_DEV_ERROR_ASSERT(status, ASDK_SUCCESS);
+    /* blocks filled since the previous iteration and never filtered */
+    adc_block_overruns += filled - 1U;
+    adc_block_taken = seq;
 
-        ADC_Index++;
+    scans = adc_block[seq & 1U];
 
-        if(ADC_Index >= adc_conf.pin_count)
+    for (uint8_t ch = 0; ch < adc_conf.pin_count; ch++)
+    {
+        for (uint8_t scan = 0; scan < APP_ADC_BLOCK_SCANS; scan++)
         {
-            ADC_Index = 0;
+            __app_adc_filter(ch, scans[scan][ch]);
         }
+    }
+}
 
-        status = asdk_adc_start_conversion_non_blocking(adc_pins[ADC_Index]);
-        ASDK_DEV_ERROR_ASSERT(status, ASDK_SUCCESS);
+uint32_t app_adc_get_value(uint8_t channel)
+{
+    if (channel >= adc_conf.pin_count)
+    {
+        return 0;
     }
+
+    return adc_filtered[channel];
 }
 
-uint32_t app_get_adc_value(asdk_mcu_pin_t p_Pin)
+uint32_t app_adc_get_overruns(void)
 {
-    uint32_t Value = 0;
-    uint8_t Idx = 0;
+    return adc_block_overruns;
+}
 
-    for( ; adc_conf.pin_count; Idx++)
+uint32_t app_get_adc_value(asdk_mcu_pin_t p_Pin)
+{
+    for (uint8_t Idx = 0; Idx < adc_conf.pin_count; Idx++)
     {
-        if(p_Pin == adc_pins[Idx])
+        if (p_Pin == adc_pins[Idx])
         {
-            Value = sensor_raw_value[Idx];
-            break;
+            return adc_filtered[Idx];
         }
     }
 
-    return Value;
+    return 0;
 }
 
 void app_ldr_iteration()
 {
-    LDR_brightness_lvl = app_get_adc_value(LDR_ADC_PIN);
+    LDR_brightness_lvl = app_adc_get_value(ADC_CH_LDR);
 
     tx_adc_buffer[0]=0x02;
 
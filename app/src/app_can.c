@@ -37,16 +37,21 @@ volatile int16_t yaw = 0;
 
 uint8_t tx_buffer[8] = {0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA};
 uint8_t tx306_buffer[8] = {0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA};
-uint8_t rx_buffer[8] = {0};
 
 uint32_t rx_accept_can_ids[] = {0x300, 0x301};
 uint8_t can_ids_length =
     sizeof(rx_accept_can_ids) / sizeof(rx_accept_can_ids[0]);
 
-asdk_can_message_t rx_msg = {
-    .message = rx_buffer,
+static const uint32_t periodic_can_ids[APP_CAN_MSG_MAX] = {
+    [APP_CAN_MSG_HORN] = 0x305,
+    [APP_CAN_MSG_BRAKE] = 0x305,
+    [APP_CAN_MSG_INDICATOR] = 0x305,
+    [APP_CAN_MSG_RIDE] = 0x306,
 };
 
+static uint8_t periodic_handles[APP_CAN_MSG_MAX] = {0};
+static bool periodic_registered = false;
+
 asdk_can_message_t tx_msg = {
     .can_id = 0x400,
     .dlc = 8,
@@ -58,40 +63,46 @@ asdk_can_message_t msg = {.message = can_data};
 
 bool msg_received = false;
 bool tx_status_busy = 0;
+uint8_t tx_mailbox = 0;
 asdk_errorcode_t can_write_status = ASDK_CAN_SUCCESS;
 
 volatile uint16_t tx_can_id = 0;
 
+/* 0x300: rider inputs */
+static void __vehicle_input_handler(uint8_t can_ch, const asdk_can_frame_t *frame) {
+    msg_received = true;
+    horn_state = frame->message[0];
+    brake_state = frame->message[1];
+    indicator_state = frame->message[2];
+    throttle = frame->message[3];
+    sidestand_engaged = frame->message[4];
+    start_button = frame->message[5];
+}
+
+/* 0x301: ride state and orientation */
+static void __vehicle_state_handler(uint8_t can_ch, const asdk_can_frame_t *frame) {
+    msg_received = true;
+    riding_mode_r = frame->message[0];
+    vehicle_speed_r = frame->message[1];
+    roll = frame->message[2];
+    pitch = frame->message[4];
+    yaw = frame->message[6];
+}
+
+/* interrupt context, wakes the CAN task */
+static void __vehicle_can_rx_notify(uint8_t can_ch) {
+    scheduler_post_event(VEHICLE_CAN_EVENT);
+}
+
 void __service_callback(uint8_t VEHICLE_CAN, asdk_can_event_t event,
                         asdk_can_message_t *can_message) {
     switch (event) {
     case ASDK_CAN_TX_COMPLETE_EVENT:
         tx_can_id = can_message->can_id;
+        scheduler_post_event(VEHICLE_CAN_EVENT);
         break;
 
-    case ASDK_CAN_RX_EVENT:
-        msg_received = true;
-        rx_msg.can_id = can_message->can_id;
-        rx_msg.dlc = can_message->dlc;
-        memcpy(rx_msg.message, can_message->message, can_message->dlc);
-
-        if (rx_msg.can_id == 0x300) {
-            horn_state = rx_msg.message[0];
-            brake_state = rx_msg.message[1];
-            indicator_state = rx_msg.message[2];
-            throttle = rx_msg.message[3];
-            sidestand_engaged = rx_msg.message[4];
-            start_button = rx_msg.message[5];
-        }
-        if (rx_msg.can_id == 0x301) {
-            riding_mode_r = rx_msg.message[0];
-            vehicle_speed_r = rx_msg.message[1];
-            roll = rx_msg.message[2];
-            pitch = rx_msg.message[4];
-            yaw = rx_msg.message[6];
-        }
-
-        break;
+    // received frames are decoded by the per CAN ID handlers
 
     case ASDK_CAN_ERROR_EVENT:
         can_error_count++;
@@ -117,7 +128,8 @@ void app_can_init() {
                 CAN_RX_PIN,
             },
 
-        .hw_filter = {.rx_fifo_acceptance_filter =
+        .hw_filter = {.no_of_tx_queue_mailbox = VEHICLE_CAN_TX_MAILBOXES,
+                      .rx_fifo_acceptance_filter =
                           {
                               .can_ids = rx_accept_can_ids,
                               .length = can_ids_length,
@@ -153,6 +165,36 @@ void app_can_init() {
 
     can_status = asdk_can_service_install_callback(__service_callback);
     ASDK_DEV_ERROR_ASSERT(can_status, ASDK_CAN_SUCCESS);
+
+    can_status = asdk_can_service_install_rx_notify(__vehicle_can_rx_notify);
+    ASDK_DEV_ERROR_ASSERT(can_status, ASDK_MW_CAN_SERVICE_SUCCESS);
+
+    // hand lower CAN IDs to the controller first, e.g. 0x305 horn/brake/indicators before 0x306 ride data
+    can_status = asdk_can_service_set_tx_order(VEHICLE_CAN, ASDK_CAN_SERVICE_TX_ORDER_ID_PRIORITY);
+    ASDK_DEV_ERROR_ASSERT(can_status, ASDK_MW_CAN_SERVICE_SUCCESS);
+
+    can_status = asdk_can_service_register_rx_handler(VEHICLE_CAN, 0x300, __vehicle_input_handler);
+    ASDK_DEV_ERROR_ASSERT(can_status, ASDK_MW_CAN_SERVICE_SUCCESS);
+
+    can_status = asdk_can_service_register_rx_handler(VEHICLE_CAN, 0x301, __vehicle_state_handler);
+    ASDK_DEV_ERROR_ASSERT(can_status, ASDK_MW_CAN_SERVICE_SUCCESS);
+
+    // scheduler entries survive a bus-off re-init
+    if (!periodic_registered) {
+        asdk_can_service_periodic_config_t periodic_cfg = {
+            .cycle_time_ms = VEHICLE_CAN_STATUS_CYCLE_MS,
+            .min_interval_ms = 0,
+            .send_on_change = true,
+        };
+
+        for (uint8_t i = 0; i < APP_CAN_MSG_MAX; i++) {
+            periodic_cfg.can_id = periodic_can_ids[i];
+            can_status = asdk_can_service_periodic_register(VEHICLE_CAN, &periodic_cfg, &periodic_handles[i]);
+            ASDK_DEV_ERROR_ASSERT(can_status, ASDK_MW_CAN_SERVICE_SUCCESS);
+        }
+
+        periodic_registered = true;
+    }
 }
 
 void app_can_deinit() {
@@ -182,7 +224,7 @@ void app_can_iteration() {
         update_vehicle_speed();
     }
 
-    asdk_can_is_tx_busy(VEHICLE_CAN, 0, &tx_status_busy);
+    asdk_can_get_free_tx_mailbox(VEHICLE_CAN, &tx_mailbox, &tx_status_busy);
 
     if (!tx_status_busy) {
         can_write_status = asdk_can_service_send(VEHICLE_CAN, &tx_msg);
@@ -197,4 +239,12 @@ void app_can_send(uint32_t can_id, uint8_t *data, uint8_t data_length) {
 
     can_write_status = asdk_can_service_send(VEHICLE_CAN, &msg);
     ASDK_DEV_ERROR_ASSERT(ASDK_MW_CAN_SERVICE_SUCCESS, can_write_status);
+}
+
+void app_can_update(app_can_msg_t can_msg, uint8_t *data, uint8_t data_length) {
+    can_write_status = asdk_can_service_periodic_update(periodic_handles[can_msg], data, data_length);
+    ASDK_DEV_ERROR_ASSERT(ASDK_MW_CAN_SERVICE_SUCCESS, can_write_status);
+
+    /* a changed message goes out on the next pass, not the next cycle */
+    scheduler_post_event(VEHICLE_CAN_EVENT);
 }
\ No newline at end of file
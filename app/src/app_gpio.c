@@ -8,26 +8,22 @@
 #include "app_can.h"
 #include "app_gpio.h"
 #include "gpio_cfg.h"
+#include "gpio_event.h"
+#include "ultrasonic.h"
+#include "ultrasonic_cfg.h"
 #include <stdbool.h>
 #include <stdint.h>
 
 /* Debug Print includes */
 #include "debug_print.h"
 
-static uint32_t current_time;
-static uint32_t last_trigger_time;
-static bool trigger_state;
-static bool echo_captured = true;
-static uint32_t echo_start = 0;
-static uint32_t echo_end = 0;
-static uint32_t measured_distance_cm = 0;
-static uint32_t prev_distance_cm = (uint32_t)-1;
 static const uint32_t pothole_threshold_cm =
     10000; // Adjust this based on sensitivity
 
 volatile bool button_pressed = false;
 
 static void ir_sensor_iteration(void);
+static void ir_sensor_send(void);
 static void rain_sensor_iteration(void);
 static void light_sensor_iteration(void);
 static void ultrasonic_sensor_iteration(void);
@@ -43,18 +39,6 @@ extern volatile uint8_t indicator_state;
 uint8_t tx_buffer1[8] = {0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA};
 uint8_t tx_buffer2[8] = {0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA};
 
-/* Interrupt callback function for GPIO */
-static void gpio_callback(asdk_mcu_pin_t mcu_pin, uint32_t pin_state) {
-    switch (mcu_pin) {
-    case MCU_PIN_29:
-        button_pressed = true;
-        break;
-
-    default:
-        break;
-    }
-}
-
 /* Will be called from asdk_app_init() */
 void app_gpio_init() {
     asdk_errorcode_t status = ASDK_GPIO_SUCCESS;
@@ -73,10 +57,43 @@ void app_gpio_init() {
         ASDK_DEV_ERROR_ASSERT(status, ASDK_GPIO_SUCCESS);
     }
 
-    /* Initialize gpio peripheral ISR callback */
+    /* Debounce the inputs from their edge interrupts */
 
-    status = asdk_gpio_install_callback(gpio_callback);
-    ASDK_DEV_ERROR_ASSERT(status, ASDK_GPIO_SUCCESS);
+    gpio_event_init();
+
+    rain_temp = gpio_event_get_state(RAIN1_SENSE);
+    raining = !rain_temp;
+}
+
+/* Will be called every tick, reacts to debounced input changes */
+void app_gpio_event_iteration() {
+    gpio_event_t event;
+
+    gpio_event_iteration();
+
+    while (gpio_event_read(&event)) {
+        switch (event.pin) {
+        case USER_BUTTON:
+            // pressed pulls the pin low
+            if (!event.state) {
+                button_pressed = true;
+            }
+            break;
+
+        case IR1_SENSE:
+        case IR2_SENSE:
+            ir_sensor_send();
+            break;
+
+        case RAIN1_SENSE:
+            rain_temp = event.state;
+            raining = !event.state;
+            break;
+
+        default:
+            break;
+        }
+    }
 }
 
 /* Will be called from asdk_app_loop() */
@@ -130,14 +147,14 @@ void app_gpio_toggle(asdk_mcu_pin_t pin) {
     ASDK_DEV_ERROR_ASSERT(status, ASDK_GPIO_SUCCESS);
 }
 
-static void ir_sensor_iteration(void) {
-    /* IR Sensing */
+/* periodic refresh, changes are sent right away by app_gpio_event_iteration() */
+static void ir_sensor_iteration(void) { ir_sensor_send(); }
 
-    bool read_IR1 = app_gpio_get_pin_state(IR1_SENSE);
-    bool read_IR2 = app_gpio_get_pin_state(IR2_SENSE);
+static void ir_sensor_send(void) {
+    /* IR Sensing, debounced levels */
 
-    temp1 = read_IR1;
-    temp2 = read_IR2;
+    temp1 = gpio_event_get_state(IR1_SENSE);
+    temp2 = gpio_event_get_state(IR2_SENSE);
 
     tx_buffer1[0] = 0x05;
     tx_buffer1[1] = 0x00;
@@ -195,118 +212,73 @@ void handle_rain() {
     }
 }
 static void rain_sensor_iteration(void) {
-
-    rain_temp = app_gpio_get_pin_state(RAIN1_SENSE);
-    /* Rain Sensing */
-    if (app_gpio_get_pin_state(RAIN1_SENSE) == false) {
-        raining = true;
-    } else {
-        raining = false;
-    }
-
+    /* Rain Sensing, raining is updated by the debounced rain events */
     handle_rain();
 }
 
 static void ultrasonic_sensor_iteration(void) {
-    current_time = asdk_sys_get_time_ms();
-
-    // Trigger every 100ms
-    if ((current_time - last_trigger_time) >= 100) {
-        if (!trigger_state) {
-            app_gpio_set_pin_state(ULTRASONIC_TRIG1, true); // Send 10us pulse
-            trigger_state = true;
-        } else {
-            app_gpio_set_pin_state(ULTRASONIC_TRIG1, false);
-            trigger_state = false;
-            last_trigger_time = current_time;
-        }
+    static uint32_t last_sequence = 0;
+    static uint32_t prev_distance_cm = (uint32_t)-1;
+    ultrasonic_result_t result;
+
+    // Echoes are timed by the capture driver, act on new results only
+    if (!ultrasonic_get_result(ULTRASONIC_ROAD, &result) ||
+        (result.sequence == last_sequence)) {
+        return;
     }
+    last_sequence = result.sequence;
 
-    // Read echo pin state
-    bool echo_state = app_gpio_get_pin_state(ULTRASONIC_ECHO1);
-
-    if (echo_state && echo_captured) {
-        // Rising edge
-        echo_start = asdk_sys_get_time_ms();
-        echo_captured = false;
-    } else if (!echo_state && !echo_captured) {
-        // Falling edge
-        echo_end = asdk_sys_get_time_ms();
-        uint32_t duration_ms = echo_end - echo_start;
-
-        // Convert to cm
-        measured_distance_cm = (duration_ms * 34300) / (2 * 1000); // cm
-
-        // Pothole detection
-        if (prev_distance_cm != (uint32_t)-1) {
-            uint32_t diff = (measured_distance_cm > prev_distance_cm)
-                                ? (measured_distance_cm - prev_distance_cm)
-                                : (prev_distance_cm - measured_distance_cm);
-
-            if (diff >= pothole_threshold_cm) {
-                tx_buffer2[0] = 0x02;
-                tx_buffer2[1] = 0x01;
-                app_can_send(0x305, tx_buffer2, 2);
-                tx_buffer2[1] = 0x00;
-                app_can_send(0x305, tx_buffer2, 2);
-            }
-        }
+    if (!result.valid) {
+        prev_distance_cm = (uint32_t)-1;
+        return;
+    }
+
+    uint32_t measured_distance_cm = result.distance_mm / 10;
+
+    // Pothole detection
+    if (prev_distance_cm != (uint32_t)-1) {
+        uint32_t diff = (measured_distance_cm > prev_distance_cm)
+                            ? (measured_distance_cm - prev_distance_cm)
+                            : (prev_distance_cm - measured_distance_cm);
 
-        prev_distance_cm = measured_distance_cm;
-        echo_captured = true;
+        if (diff >= pothole_threshold_cm) {
+            tx_buffer2[0] = 0x02;
+            tx_buffer2[1] = 0x01;
+            app_can_send(0x305, tx_buffer2, 2);
+            tx_buffer2[1] = 0x00;
+            app_can_send(0x305, tx_buffer2, 2);
+        }
     }
+
+    prev_distance_cm = measured_distance_cm;
 }
 
 static void obs_ultrasonic_sensor_iteration(void) {
     static bool already_honked = false;
-    current_time = asdk_sys_get_time_ms();
-
-    // Trigger every 100ms
-    if ((current_time - last_trigger_time) >= 100) {
-        if (!trigger_state) {
-            app_gpio_set_pin_state(ULTRASONIC_TRIG2, true); // Send 10us pulse
-            trigger_state = true;
-        } else {
-            app_gpio_set_pin_state(ULTRASONIC_TRIG2, false);
-            trigger_state = false;
-            last_trigger_time = current_time;
-        }
-    }
-
-    // Read echo pin state
-    bool echo_state = app_gpio_get_pin_state(ULTRASONIC_ECHO2);
-
-    if (echo_state && echo_captured) {
-        // Rising edge
-        echo_start = asdk_sys_get_time_ms();
-        echo_captured = false;
-    } else if (!echo_state && !echo_captured) {
-        // Falling edge
-        echo_end = asdk_sys_get_time_ms();
-        uint32_t duration_ms = echo_end - echo_start;
-
-        // Convert to cm
-        measured_distance_cm =
-            (duration_ms * 34300) /
-            (2 * 1000); // cm
-                        // static bool already_honked = false;
-
-        if (measured_distance_cm < 100 &&
-            !already_honked) {
-            tx_buffer1[0] = 0x01;
-            tx_buffer1[1] = 0x01;
-            app_can_send(0x305, tx_buffer1, 2);
-            tx_buffer1[1] = 0x00;
-            app_can_send(0x305, tx_buffer1, 2);
-            tx_buffer1[1] = 0x01;
-            app_can_send(0x305, tx_buffer1, 2);
-            tx_buffer1[1] = 0x00;
-            app_can_send(0x305, tx_buffer1, 2);
-            already_honked = true;
-        } else if (measured_distance_cm >= 100) {
-            already_honked = false;
-        }
+    static uint32_t last_sequence = 0;
+    ultrasonic_result_t result;
 
-        echo_captured = true;
+    if (!ultrasonic_get_result(ULTRASONIC_OBSTACLE, &result) ||
+        (result.sequence == last_sequence) || !result.valid) {
+        return;
+    }
+    last_sequence = result.sequence;
+
+    uint32_t measured_distance_cm = result.distance_mm / 10;
+
+    if (measured_distance_cm < 100 &&
+        !already_honked) {
+        tx_buffer1[0] = 0x01;
+        tx_buffer1[1] = 0x01;
+        app_can_send(0x305, tx_buffer1, 2);
+        tx_buffer1[1] = 0x00;
+        app_can_send(0x305, tx_buffer1, 2);
+        tx_buffer1[1] = 0x01;
+        app_can_send(0x305, tx_buffer1, 2);
+        tx_buffer1[1] = 0x00;
+        app_can_send(0x305, tx_buffer1, 2);
+        already_honked = true;
+    } else if (measured_distance_cm >= 100) {
+        already_honked = false;
     }
 }
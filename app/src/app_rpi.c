@@ -7,6 +7,8 @@
 /* Application specific includes */
 #include <string.h>
 #include "app_rpi.h"
+#include "cobs_frame.h"
+#include "ring_buffer.h"
 
 /* Debug Print includes */
 #include "debug_print.h"
@@ -18,6 +20,22 @@ volatile uint8_t pi_data;
 #define RPI_UART_TX_PIN MCU_PIN_61
 #define RPI_UART_RX_PIN MCU_PIN_60
 
+/* DMA reports every half, i.e. 2.2 ms of line time at 115200 */
+static uint8_t __rpi_dma_buffer[64];
+
+/* received bytes from the UART interrupt to the parser, power of 2 */
+static uint8_t __rpi_rx_buffer[512];
+
+static ring_buffer_t __rpi_rx_ring = {
+    .buffer = __rpi_rx_buffer,
+    .total_capacity = sizeof(__rpi_rx_buffer),
+    .used_capacity = 0,
+    .block_size = 1,
+    .enable_overwrite = false,
+    .mode = RING_BUFFER_MODE_SPSC,
+    .event_callback = NULL
+};
+
 static asdk_uart_config_t __rpi_uart = {
     .uart_no = RPI_UART, /*!< UART no. indicates the UART module no. of the ECU */
     .uart_tx_mcu_pin_no = RPI_UART_TX_PIN, /*!< UART TX mcu pin no */
@@ -34,17 +52,32 @@ static asdk_uart_config_t __rpi_uart = {
       .intr_num = ASDK_EXTI_INTR_CPU_3,
       .priority = 1,
     }, /*!< UART interrupt config */
+
+    .uart_dma_config = {
+      .uart_rx_data_buffer = __rpi_dma_buffer,
+      .uart_rx_data_len_bytes = sizeof(__rpi_dma_buffer),
+      .enable_dma = true,
+    }, /*!< UART DMA config */
 };
 
-static bool __rpi_data = false;
-static uint8_t __rpi_data_buffer[17];
+static uint8_t __rpi_frame_buffer[COBS_FRAME_DECODED_SIZE(RPI_FRAME_MAX_PAYLOAD)];
+static cobs_frame_decoder_t __rpi_decoder;
+
+/* bytes lost before reaching the parser */
+static volatile uint32_t __rpi_rx_dropped;
+static volatile uint32_t __rpi_rx_errors;
 
 static void __rpi_uart_callback(asdk_uart_num_t uart_no, uint8_t *data, uint32_t data_len, asdk_uart_status_t event);
+static void __rpi_frame_handler(const uint8_t *payload, size_t len, void *arg);
 
 void app_rpi_init()
 {
     asdk_errorcode_t err = ASDK_UART_STATUS_SUCCESS;
 
+    ring_buffer_init(&__rpi_rx_ring);
+    cobs_frame_decoder_init(&__rpi_decoder, __rpi_frame_buffer, sizeof(__rpi_frame_buffer), __rpi_frame_handler, NULL);
+
+    // the DMA receives continuously from here on
     err = asdk_uart_init(&__rpi_uart);
     ASDK_DEV_ERROR_ASSERT(ASDK_UART_STATUS_SUCCESS, err);
 
@@ -52,38 +85,73 @@ void app_rpi_init()
     ASDK_DEV_ERROR_ASSERT(ASDK_UART_STATUS_SUCCESS, err);
 
     // DEBUG_PRINTF("RPI UART initialized successfully\r\n");
+}
 
-    err = asdk_uart_read_non_blocking(RPI_UART, __rpi_data_buffer, sizeof(__rpi_data_buffer));
-    ASDK_DEV_ERROR_ASSERT(ASDK_UART_STATUS_SUCCESS, err);
+/* every tick, posts RPI_RX_EVENT when bytes were left in the DMA buffer */
+void app_rpi_idle_check()
+{
+    // a frame shorter than half the DMA buffer is reported once the line is idle
+    asdk_uart_dma_rx_idle_check(RPI_UART);
 }
 
+/* on RPI_RX_EVENT, frames are dispatched as soon as they close */
 void app_rpi_iteration()
 {
-    if (__rpi_data)
+    size_t len;
+    uint8_t *data;
+
+    for (;;)
+    {
+        len = sizeof(__rpi_rx_buffer);
+        data = ring_buffer_claim_read(&__rpi_rx_ring, &len);
+
+        if (data == NULL)
+        {
+            break;
+        }
+
+        cobs_frame_decode(&__rpi_decoder, data, len);
+        ring_buffer_release_read(&__rpi_rx_ring, len);
+    }
+}
+
+static void __rpi_frame_handler(const uint8_t *payload, size_t len, void *arg)
+{
+    (void)arg;
+
+    if (len == 0)
     {
-        // DEBUG_PRINTF("Data received from RPI: %s\r\n", __rpi_data_buffer);
-        pi_data = __rpi_data_buffer[0];
-        asdk_uart_read_non_blocking(RPI_UART, __rpi_data_buffer, sizeof(__rpi_data_buffer));
-        __rpi_data = false;
+        return;
     }
+
+    // DEBUG_PRINTF("Frame received from RPI: cmd %d, %d bytes\r\n", payload[0], len);
+    pi_data = payload[0];
 }
 
+/* interrupt context, the DMA buffer is reused after returning */
 static void __rpi_uart_callback(asdk_uart_num_t uart_no, uint8_t *data, uint32_t data_len, asdk_uart_status_t event)
 {
+  uint32_t written;
+
   switch (event)
   {
     case ASDK_UART_STATUS_RECEIVE_COMPLETE:        /*!< Receive complete */
       if (uart_no == RPI_UART)
       {
-        __rpi_data = true;
+        written = ring_buffer_write(&__rpi_rx_ring, data, data_len);
+        __rpi_rx_dropped += data_len - written;
+        scheduler_post_event(RPI_RX_EVENT);
       }
       break;
-    case ASDK_UART_STATUS_TRANSMIT_COMPLETE:       /*!< Transmit complete. */
-    case ASDK_UART_STATUS_TRANSMIT_ERROR:          /*!< Error occurred in transmission. */
     case ASDK_UART_STATUS_RECEIVE_OVERFLOW:        /*!< UART buffer overflow. */
     case ASDK_UART_STATUS_RECEIVE_ERR_FRAME:       /*!< Frame error, either a start or stop bit error on receive line */
     case ASDK_UART_STATUS_RECEIVE_ERR_PARITY:      /*!< Parity error on receive line */
     case ASDK_UART_STATUS_RECEIVE_BREAK_DETECT:    /*!< Break detect on receive line */
+      // the CRC drops the frame, the next delimiter resynchronizes
+      __rpi_rx_errors++;
+      break;
+    case ASDK_UART_STATUS_TRANSMIT_COMPLETE:       /*!< Transmit complete. */
+    case ASDK_UART_STATUS_TRANSMIT_ERROR:          /*!< Error occurred in transmission. */
     default:
       break;
   }
@@ -27,13 +27,13 @@ static uint8_t tx306_buffer[8];
 void process_horn_state() {
     tx_buffer[0] = 0x01;
     tx_buffer[1] = horn_state ? 0x01 : 0x00;
-    app_can_send(0x305, tx_buffer, 2);
+    app_can_update(APP_CAN_MSG_HORN, tx_buffer, 2);
 }
 
 void process_brake_state() {
     tx_buffer[0] = 0x03;
     tx_buffer[1] = brake_state ? 0x02 : 0x00;
-    app_can_send(0x305, tx_buffer, 2);
+    app_can_update(APP_CAN_MSG_BRAKE, tx_buffer, 2);
 }
 
 void process_indicator_state() {
@@ -76,7 +76,7 @@ void process_indicator_state() {
         tx_buffer[1] = 0x00; // OFF
     }
 
-    app_can_send(0x305, tx_buffer, 2);
+    app_can_update(APP_CAN_MSG_INDICATOR, tx_buffer, 2);
 
     if (indicator_state == 0x00) {
         indicator_active = false;
@@ -131,7 +131,7 @@ void update_vehicle_speed() {
     tx306_buffer[0] = riding_mode;
     tx306_buffer[1] = vehicle_speed;
 
-    app_can_send(0x306, tx306_buffer, 2);
+    app_can_update(APP_CAN_MSG_RIDE, tx306_buffer, 2);
 }
 
 void process_hold_state() {
@@ -168,5 +168,5 @@ void process_hold_state() {
 
     tx306_buffer[0] = riding_mode;
     tx306_buffer[1] = vehicle_speed;
-    app_can_send(0x306, tx306_buffer, 2);
+    app_can_update(APP_CAN_MSG_RIDE, tx306_buffer, 2);
 }
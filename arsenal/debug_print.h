@@ -3,8 +3,16 @@
 
 #include "asdk_system.h"
 #include "printf.h"
+#include "debug_uart.h"
 
+#ifdef DEBUG_PRINT_USE_TRACE
+/* binary records instead of formatting on target, see debug_trace.h */
+#include "debug_trace.h"
+
+#define DEBUG_PRINTF(fmt, ...) DEBUG_TRACE(fmt, ##__VA_ARGS__)
+#else
 #define DEBUG_PRINTF(fmt, ...) \
-    printf("%lld: %s, %d: " fmt, asdk_sys_get_time_ms(), __func__, __LINE__, ##__VA_ARGS__)
+    debug_uart_printf("%lld: %s, %d: " fmt, asdk_sys_get_time_ms(), __func__, __LINE__, ##__VA_ARGS__)
+#endif
 
-#endif
\ No newline at end of file
+#endif
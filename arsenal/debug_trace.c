@@ -0,0 +1,140 @@
+#include "asdk_platform.h"
+#include "asdk_system.h"
+#include "debug_trace.h"
+
+#if (DEBUG_TRACE_BUFFER_WORDS & (DEBUG_TRACE_BUFFER_WORDS - 1U)) != 0U
+#error "DEBUG_TRACE_BUFFER_WORDS must be a power of 2"
+#endif
+
+#define DEBUG_TRACE_MASK (DEBUG_TRACE_BUFFER_WORDS - 1U)
+
+/* words in front of the args: header, timestamp */
+#define DEBUG_TRACE_RECORD_WORDS 2U
+
+/* record timestamp, microseconds of the system time base unless the build provides another */
+#ifndef DEBUG_TRACE_TIMESTAMP
+#define DEBUG_TRACE_TIMESTAMP() ((uint32_t)asdk_sys_get_time_us())
+#endif
+
+/* A zero word marks a record that is reserved but not yet complete: writers
+   fill the timestamp and args first and the header last, the reader clears
+   what it consumed. */
+static uint32_t trace_buffer[DEBUG_TRACE_BUFFER_WORDS];
+static volatile uint32_t trace_head; /* next word to reserve, writers */
+static volatile uint32_t trace_tail; /* next word to read, reader */
+
+static volatile uint32_t trace_dropped;
+static uint32_t trace_dropped_reported;
+
+static void __debug_trace_put_word(uint8_t *data, uint32_t word)
+{
+    data[0] = (uint8_t)word;
+    data[1] = (uint8_t)(word >> 8);
+    data[2] = (uint8_t)(word >> 16);
+    data[3] = (uint8_t)(word >> 24);
+}
+
+void debug_trace_write(uint32_t fmt_id, uint32_t nargs, const uint32_t *args)
+{
+    uint32_t timestamp = DEBUG_TRACE_TIMESTAMP();
+    uint32_t primask;
+    uint32_t pos;
+    uint32_t words;
+
+    if (nargs > DEBUG_TRACE_MAX_ARGS)
+    {
+        nargs = DEBUG_TRACE_MAX_ARGS;
+    }
+
+    words = DEBUG_TRACE_RECORD_WORDS + nargs;
+
+    // Cortex-M0+ has no exclusive access, only the reservation masks interrupts
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    pos = trace_head;
+
+    if ((DEBUG_TRACE_BUFFER_WORDS - (pos - trace_tail)) < words)
+    {
+        trace_dropped++;
+        __set_PRIMASK(primask);
+        return;
+    }
+
+    trace_head = pos + words;
+    __set_PRIMASK(primask);
+
+    trace_buffer[(pos + 1U) & DEBUG_TRACE_MASK] = timestamp;
+
+    for (uint32_t i = 0; i < nargs; i++)
+    {
+        trace_buffer[(pos + DEBUG_TRACE_RECORD_WORDS + i) & DEBUG_TRACE_MASK] = args[i];
+    }
+
+    ASDK_MEMORY_BARRIER()
+    trace_buffer[pos & DEBUG_TRACE_MASK] = DEBUG_TRACE_HEADER(fmt_id, nargs);
+}
+
+uint32_t debug_trace_read(uint8_t *data, uint32_t len)
+{
+    uint32_t count = 0;
+    uint32_t pos = trace_tail;
+    uint32_t header;
+    uint32_t words;
+    uint32_t dropped;
+
+    while (pos != trace_head)
+    {
+        header = trace_buffer[pos & DEBUG_TRACE_MASK];
+
+        if (0U == header)
+        {
+            break; // writer preempted before completing it
+        }
+
+        ASDK_MEMORY_BARRIER()
+
+        words = DEBUG_TRACE_RECORD_WORDS + ((header >> 24) & 0x0FU);
+
+        if ((len - count) < (1U + 4U * words))
+        {
+            break;
+        }
+
+        data[count++] = DEBUG_TRACE_SYNC;
+
+        for (uint32_t i = 0; i < words; i++)
+        {
+            __debug_trace_put_word(&data[count], trace_buffer[(pos + i) & DEBUG_TRACE_MASK]);
+            trace_buffer[(pos + i) & DEBUG_TRACE_MASK] = 0;
+            count += 4U;
+        }
+
+        pos += words;
+
+        // cleared words must be visible before writers may reserve them
+        ASDK_MEMORY_BARRIER()
+        trace_tail = pos;
+    }
+
+    // drops happened while the buffer was full, report them once it is drained
+    dropped = trace_dropped;
+
+    if ((dropped != trace_dropped_reported) && (pos == trace_head) &&
+        ((len - count) >= (1U + 4U * (DEBUG_TRACE_RECORD_WORDS + 1U))))
+    {
+        data[count] = DEBUG_TRACE_SYNC;
+        __debug_trace_put_word(&data[count + 1U], DEBUG_TRACE_HEADER(DEBUG_TRACE_ID_DROPPED, 1U));
+        __debug_trace_put_word(&data[count + 5U], DEBUG_TRACE_TIMESTAMP());
+        __debug_trace_put_word(&data[count + 9U], dropped - trace_dropped_reported);
+        trace_dropped_reported = dropped;
+        count += 13U;
+    }
+
+    return count;
+}
+
+uint32_t debug_trace_get_dropped(void)
+{
+    return trace_dropped;
+}
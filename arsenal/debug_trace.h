@@ -0,0 +1,57 @@
+#ifndef DEBUG_TRACE_H
+#define DEBUG_TRACE_H
+
+#include <stdint.h>
+
+/* Binary trace logging: DEBUG_TRACE() stores a record (format string ID,
+   timestamp, raw 32-bit args) and the string itself only lives in the ELF,
+   in the non-loaded .trace_fmt section. debug_trace_decode.py formats
+   the records on the host. */
+
+/* buffer size in 32-bit words, a power of 2 */
+#ifndef DEBUG_TRACE_BUFFER_WORDS
+#define DEBUG_TRACE_BUFFER_WORDS 512U
+#endif
+
+/* args per record, more are dropped */
+#define DEBUG_TRACE_MAX_ARGS 8U
+
+/* record on the wire: sync byte, header, timestamp, args, little endian */
+#define DEBUG_TRACE_SYNC 0xA5U
+#define DEBUG_TRACE_RECORD_MAX_SIZE (1U + 4U + 4U + (4U * DEBUG_TRACE_MAX_ARGS))
+
+/* header: bit 31 set, bits 24..27 arg count, bits 0..23 format string offset */
+#define DEBUG_TRACE_HEADER(fmt_id, nargs) (0x80000000UL | ((uint32_t)(nargs) << 24) | ((fmt_id) & 0xFFFFFFUL))
+
+/* format string offset of the record reporting dropped records, one arg: the count */
+#define DEBUG_TRACE_ID_DROPPED 0xFFFFFFUL
+
+#define DEBUG_TRACE_STR_(x) #x
+#define DEBUG_TRACE_STR(x) DEBUG_TRACE_STR_(x)
+
+/* Args are stored as uint32_t: pointers need a cast, %s is only resolved for
+   strings in the ELF, 64-bit values are not supported and floats must go
+   through DEBUG_TRACE_FLOAT(). Safe to call from interrupts. */
+#define DEBUG_TRACE(fmt, ...)                                                                   \
+    do                                                                                          \
+    {                                                                                           \
+        static const char __debug_trace_fmt[] __attribute__((section(".trace_fmt"), used)) = \
+            __FILE__ ":" DEBUG_TRACE_STR(__LINE__) ": " fmt;                                     \
+        const uint32_t __debug_trace_args[] = {0, ##__VA_ARGS__};                               \
+        debug_trace_write((uint32_t)(uintptr_t)__debug_trace_fmt,                               \
+                          (sizeof(__debug_trace_args) / sizeof(uint32_t)) - 1U,                 \
+                          &__debug_trace_args[1]);                                              \
+    } while (0)
+
+/* raw IEEE-754 bits of a float, decoded by the %f, %e and %g conversions */
+#define DEBUG_TRACE_FLOAT(x) (((union { float f; uint32_t u; }){.f = (float)(x)}).u)
+
+void debug_trace_write(uint32_t fmt_id, uint32_t nargs, const uint32_t *args);
+
+/* Copies whole records in wire format, returns the number of bytes.
+   Single consumer, e.g. the debug UART. */
+uint32_t debug_trace_read(uint8_t *data, uint32_t len);
+
+uint32_t debug_trace_get_dropped(void);
+
+#endif /* DEBUG_TRACE_H */
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""Decodes the DEBUG_TRACE() records of the debug UART, see debug_trace.h.
+
+The format strings are read from the .trace_fmt section of the application
+ELF, %s arguments are resolved when they point into a loaded section of the
+ELF. Text printed with printf on the same UART is passed through.
+
+usage: debug_trace_decode.py build/bb_app_m0.elf capture.bin
+       stty -F /dev/ttyUSB0 115200 raw && debug_trace_decode.py app.elf /dev/ttyUSB0
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+TRACE_SYNC = 0xA5
+TRACE_MAX_ARGS = 8
+TRACE_ID_DROPPED = 0xFFFFFF
+TRACE_SECTION = ".trace_fmt"
+
+SHF_ALLOC = 0x2
+SHT_PROGBITS = 1
+SHT_NOBITS = 8
+
+CONVERSION = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<prec>\*|\d+))?"
+    r"(?P<length>hh|h|ll|l|j|z|t|L)?(?P<conv>[diouxXeEfFgGaAcsp%])"
+)
+
+
+class Elf:
+    """Section headers of a little endian ELF32 or ELF64."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+
+        if self.data[:4] != b"\x7fELF" or self.data[5] != 1:
+            raise ValueError("%s: not a little endian ELF" % path)
+
+        if self.data[4] == 1:
+            shoff, = struct.unpack_from("<I", self.data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+            layout = "<IIIIIIIIII"
+        else:
+            shoff, = struct.unpack_from("<Q", self.data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x3A)
+            layout = "<IIQQQQIIQQ"
+
+        headers = [struct.unpack_from(layout, self.data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx]
+        self.sections = []
+
+        for name, sh_type, flags, addr, offset, size, *_ in headers:
+            end = self.data.index(b"\0", names[4] + name)
+            self.sections.append(
+                {
+                    "name": self.data[names[4] + name:end].decode(),
+                    "type": sh_type,
+                    "flags": flags,
+                    "addr": addr,
+                    "offset": offset,
+                    "size": size,
+                }
+            )
+
+    def section(self, name):
+        for section in self.sections:
+            if section["name"] == name:
+                return section
+        raise KeyError("%s not found, is the application linked with the trace linker section?" % name)
+
+    def bytes_of(self, section):
+        return self.data[section["offset"]:section["offset"] + section["size"]]
+
+    def string_at(self, address):
+        for section in self.sections:
+            if (section["flags"] & SHF_ALLOC) and section["type"] == SHT_PROGBITS:
+                if section["addr"] <= address < section["addr"] + section["size"]:
+                    start = section["offset"] + address - section["addr"]
+                    end = self.data.find(b"\0", start, section["offset"] + section["size"])
+                    if end >= 0:
+                        return self.data[start:end].decode(errors="replace")
+        return None
+
+
+class Formatter:
+    def __init__(self, elf):
+        section = elf.section(TRACE_SECTION)
+        self.elf = elf
+        self.base = section["addr"]
+        self.strings = elf.bytes_of(section)
+
+    def format_string(self, fmt_id):
+        offset = (fmt_id - self.base) & 0xFFFFFF
+        if offset >= len(self.strings) or (offset and self.strings[offset - 1] != 0):
+            return None
+        end = self.strings.index(b"\0", offset)
+        return self.strings[offset:end].decode(errors="replace")
+
+    def _convert(self, match, args):
+        conv = match.group("conv")
+        if conv == "%":
+            return "%"
+
+        spec = "%" + match.group("flags")
+        for part, prefix in (("width", ""), ("prec", ".")):
+            value = match.group(part)
+            if value == "*":
+                value = str(struct.unpack("<i", struct.pack("<I", args.pop(0) if args else 0))[0])
+            if value is not None:
+                spec += prefix + value
+
+        arg = args.pop(0) if args else 0
+        length = match.group("length")
+
+        if conv in "di":
+            bits = {"hh": 8, "h": 16}.get(length, 32)
+            arg &= (1 << bits) - 1
+            if arg & (1 << (bits - 1)):
+                arg -= 1 << bits
+            return (spec + "d") % arg
+        if conv in "ouxX":
+            arg &= {"hh": 0xFF, "h": 0xFFFF}.get(length, 0xFFFFFFFF)
+            return (spec + ("d" if conv == "u" else conv)) % arg
+        if conv in "eEfFgGaA":
+            value = struct.unpack("<f", struct.pack("<I", arg))[0]
+            return (spec + ("f" if conv in "aA" else conv)) % value
+        if conv == "c":
+            return (spec + "c") % chr(arg & 0xFF)
+        if conv == "p":
+            return "0x%08x" % arg
+        string = self.elf.string_at(arg)
+        return (spec + "s") % (string if string is not None else "<0x%08x>" % arg)
+
+    def format(self, fmt, args):
+        args = list(args)
+        return CONVERSION.sub(lambda m: self._convert(m, args), fmt)
+
+
+def decode(stream, formatter, out, ts_unit):
+    pending = b""
+    text = bytearray()
+
+    def flush_text():
+        if text:
+            out.write(text.decode(errors="replace"))
+            text.clear()
+
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        pending += chunk
+
+        while pending:
+            if pending[0] != TRACE_SYNC:
+                text.append(pending[0])
+                pending = pending[1:]
+                continue
+
+            if len(pending) < 5:
+                break
+
+            header, = struct.unpack_from("<I", pending, 1)
+            nargs = (header >> 24) & 0x0F
+            fmt_id = header & 0xFFFFFF
+            fmt = None
+
+            if (header & 0x80000000) and not (header & 0x70000000) and nargs <= TRACE_MAX_ARGS:
+                fmt = "<%u records dropped>" if fmt_id == TRACE_ID_DROPPED else formatter.format_string(fmt_id)
+
+            if fmt is None:
+                # not a record, e.g. a stray byte in the text
+                text.append(pending[0])
+                pending = pending[1:]
+                continue
+
+            size = 1 + 4 + 4 + 4 * nargs
+            if len(pending) < size:
+                break
+
+            timestamp, = struct.unpack_from("<I", pending, 5)
+            args = struct.unpack_from("<%dI" % nargs, pending, 9)
+            pending = pending[size:]
+
+            flush_text()
+            line = formatter.format(fmt, args)
+            out.write("[%10u %s] %s%s" % (timestamp, ts_unit, line, "" if line.endswith("\n") else "\n"))
+
+        flush_text()
+        out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="application ELF the records were logged by")
+    parser.add_argument("input", nargs="?", default="-", help="captured UART bytes or a serial device, default stdin")
+    parser.add_argument("--ts-unit", default="us", help="unit of DEBUG_TRACE_TIMESTAMP(), default us")
+    args = parser.parse_args()
+
+    formatter = Formatter(Elf(args.elf))
+    stream = sys.stdin.buffer if args.input == "-" else open(args.input, "rb", buffering=0)
+    decode(stream, formatter, sys.stdout, args.ts_unit)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,8 +1,20 @@
+#include <stdarg.h>
+
 #include "debug_uart.h"
+#include "debug_trace.h"
 #include "ring_buffer.h"
+#include "printf.h"
 
+// trace records are serialized here, text goes out straight from the ring
 #define PRINT_BUFFER_SIZE 64
 
+// longest transfer out of the ring, its space is only freed on TX complete
+#define DEBUG_UART_TX_CHUNK_SIZE 256
+
+#if PRINT_BUFFER_SIZE < DEBUG_TRACE_RECORD_MAX_SIZE
+#error "PRINT_BUFFER_SIZE must hold a whole trace record"
+#endif
+
 typedef enum {
   DEBUG_UART_INIT,
   DEBUG_UART_SEND,
@@ -11,8 +23,8 @@ typedef enum {
 
 static uint8_t _debug_uart_char_buffer[4096] = {0};
 static asdk_errorcode_t sm_iter_err = ASDK_SUCCESS;
-static uint32_t buff_len = 0;
-static uint32_t read_len = 0;
+static size_t tx_len = 0;
+static bool tx_from_ring = false;
 
 static asdk_uart_config_t _debug_uart = {
     .uart_no = ASDK_UART_0, /*!< UART no. indicates the UART module no. of the ECU */
@@ -39,13 +51,46 @@ static ring_buffer_t _debug_uart_buff = {
     .used_capacity = 0,
     .block_size = 1,
     .enable_overwrite = false,
+    .mode = RING_BUFFER_MODE_SPSC,
     .event_callback = NULL
 };
 
+typedef struct {
+  uint8_t *region;
+  size_t size;
+  size_t len;
+} debug_uart_out_t;
+
 static uint8_t _wc, _rc[PRINT_BUFFER_SIZE];
 static volatile debug_uart_state_t _uart_state;
 static volatile uint32_t max_buff_usage;
 
+static void __debug_uart_start_tx(void)
+{
+  uint8_t *data;
+
+  tx_len = DEBUG_UART_TX_CHUNK_SIZE;
+  data = ring_buffer_claim_read(&_debug_uart_buff, &tx_len);
+  tx_from_ring = (data != NULL);
+
+  if (!tx_from_ring)
+  {
+    // binary trace records go out once the text is flushed
+    tx_len = debug_trace_read(_rc, PRINT_BUFFER_SIZE);
+    data = _rc;
+  }
+
+  if (tx_len == 0)
+  {
+    return;
+  }
+
+  _uart_state = DEBUG_UART_WAIT_FOR_TX_EVT;
+
+  sm_iter_err = asdk_uart_write_non_blocking(ASDK_UART_0, data, tx_len);
+  ASDK_DEV_ERROR_ASSERT(sm_iter_err, ASDK_UART_STATUS_SUCCESS);
+}
+
 static void __uart_callback(asdk_uart_num_t uart_no, uint8_t *data, uint32_t data_len, asdk_uart_status_t event)
 {
   switch (event)
@@ -55,7 +100,14 @@ static void __uart_callback(asdk_uart_num_t uart_no, uint8_t *data, uint32_t dat
       {
         if (_uart_state == DEBUG_UART_WAIT_FOR_TX_EVT)
         {
+          if (tx_from_ring)
+          {
+            ring_buffer_release_read(&_debug_uart_buff, tx_len);
+          }
+
+          // chain the next chunk here, the main loop only restarts an idle UART
           _uart_state = DEBUG_UART_SEND;
+          __debug_uart_start_tx();
         }
       }
       break;
@@ -79,9 +131,11 @@ static void __debug_uart_sm_init(void)
 
 static void __debug_uart_sm_iterate(void)
 { 
-  if (max_buff_usage < _debug_uart_buff.used_capacity)
+  uint32_t used_capacity = ring_buffer_get_used_capacity(&_debug_uart_buff);
+
+  if (max_buff_usage < used_capacity)
   {
-    max_buff_usage = _debug_uart_buff.used_capacity;
+    max_buff_usage = used_capacity;
   }
 
   switch (_uart_state)
@@ -95,25 +149,8 @@ static void __debug_uart_sm_iterate(void)
         break;
 
     case DEBUG_UART_SEND:
-      buff_len = _debug_uart_buff.used_capacity;
-      
-      if (buff_len == 0)
-      {
-        break;
-      }
-
-      if (buff_len >= PRINT_BUFFER_SIZE)
-      {
-        buff_len = PRINT_BUFFER_SIZE;
-      }
-
-      read_len = ring_buffer_read(&_debug_uart_buff, _rc, buff_len);
-
-      _uart_state = DEBUG_UART_WAIT_FOR_TX_EVT;
-      
-      sm_iter_err = asdk_uart_write_non_blocking(ASDK_UART_0, _rc, read_len);
-      ASDK_DEV_ERROR_ASSERT(sm_iter_err, ASDK_UART_STATUS_SUCCESS);
-
+      // no transfer in flight, the TX complete ISR cannot race with this
+      __debug_uart_start_tx();
       break;
 
     case DEBUG_UART_WAIT_FOR_TX_EVT:
@@ -122,9 +159,43 @@ static void __debug_uart_sm_iterate(void)
   }
 }
 
+// the ring has a single producer, the main loop, so interrupts must not write
+static bool __debug_uart_in_isr(void)
+{
+  return (0U != __get_IPSR());
+}
+
+static void __debug_uart_out(char character, void *arg)
+{
+  debug_uart_out_t *out = (debug_uart_out_t *)arg;
+
+  if (out->len == out->size)
+  {
+    // region full or at the end of the buffer, publish it and claim the next
+    ring_buffer_commit_write(&_debug_uart_buff, out->len);
+
+    out->len = 0;
+    out->size = sizeof(_debug_uart_char_buffer);
+    out->region = ring_buffer_claim_write(&_debug_uart_buff, &out->size);
+
+    if (out->region == NULL)
+    {
+      out->size = 0; // buffer full, the character is dropped
+      return;
+    }
+  }
+
+  out->region[out->len++] = (uint8_t)character;
+}
+
 void _putchar(char character)
 {
   // send char to console etc.
+  if (__debug_uart_in_isr())
+  {
+    return;
+  }
+
   _wc = character;
   ring_buffer_write(&_debug_uart_buff, &_wc, 1);
 }
@@ -143,3 +214,43 @@ uint32_t debug_uart_get_max_usage(void)
 {
   return max_buff_usage;
 }
+
+int debug_uart_vprintf(const char *format, va_list va)
+{
+  debug_uart_out_t out = {NULL, 0, 0};
+  int ret;
+
+  if (__debug_uart_in_isr())
+  {
+    return 0;
+  }
+
+  // formatted in place, the UART transmits from the same memory
+  ret = vfctprintf(__debug_uart_out, &out, format, va);
+  ring_buffer_commit_write(&_debug_uart_buff, out.len);
+
+  return ret;
+}
+
+int debug_uart_printf(const char *format, ...)
+{
+  va_list va;
+  int ret;
+
+  va_start(va, format);
+  ret = debug_uart_vprintf(format, va);
+  va_end(va);
+
+  return ret;
+}
+
+uint32_t debug_uart_write(const uint8_t *data, uint32_t len)
+{
+  // raw bytes, e.g. binary dumps, share the buffer with printf
+  if (__debug_uart_in_isr())
+  {
+    return 0;
+  }
+
+  return ring_buffer_write(&_debug_uart_buff, (void *)data, len);
+}
@@ -1,10 +1,21 @@
 #ifndef _DEBUG_UART_H_
 #define _DEBUG_UART_H_
 
+#include <stdarg.h>
+
 #include "asdk_uart.h"
 
 void debug_uart_init(void);
 void debug_uart_iteration(void);
 uint32_t debug_uart_get_max_usage(void);
 
+/* The TX buffer has a single producer: debug_uart_write, debug_uart_printf
+   and printf (_putchar) are for thread context only. Called from an
+   interrupt they drop the text, use DEBUG_TRACE there instead. */
+uint32_t debug_uart_write(const uint8_t *data, uint32_t len);
+
+/* printf formatted straight into the TX buffer */
+int debug_uart_printf(const char *format, ...);
+int debug_uart_vprintf(const char *format, va_list va);
+
 #endif // _DEBUG_UART_H_
@@ -0,0 +1,290 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "asdk_platform.h"
+#include "asdk_system.h"
+#include "gpio_event.h"
+
+#if (GPIO_EVENT_EDGE_QUEUE_SIZE & (GPIO_EVENT_EDGE_QUEUE_SIZE - 1U)) != 0U
+#error "GPIO_EVENT_EDGE_QUEUE_SIZE must be a power of 2"
+#endif
+
+#if (GPIO_EVENT_QUEUE_SIZE & (GPIO_EVENT_QUEUE_SIZE - 1U)) != 0U
+#error "GPIO_EVENT_QUEUE_SIZE must be a power of 2"
+#endif
+
+#if GPIO_EVENT_PIN_MAX > 32U
+#error "GPIO_EVENT_PIN_MAX must fit the 32-bit settling mask"
+#endif
+
+#define GPIO_EVENT_EDGE_MASK (GPIO_EVENT_EDGE_QUEUE_SIZE - 1U)
+#define GPIO_EVENT_MASK (GPIO_EVENT_QUEUE_SIZE - 1U)
+
+/* pin_index entry of MCU pins not served */
+#define GPIO_EVENT_NO_INDEX 0xFFU
+
+/* edge timestamp, the system time base unless the build provides another */
+#ifndef GPIO_EVENT_TIMESTAMP_US
+#define GPIO_EVENT_TIMESTAMP_US() ((uint32_t)asdk_sys_get_time_us())
+#endif
+
+typedef struct
+{
+    uint32_t timestamp_us;
+    uint8_t index; /* into gpio_event_config */
+    bool level;
+} gpio_event_edge_t;
+
+/* Integrating debounce, task context only: the integral runs up while the
+   raw level is high and down while it is low, clamped to 0..debounce_us.
+   A level is accepted when the integral reaches its end, so chatter only
+   delays the change instead of restarting it. */
+typedef struct
+{
+    uint32_t integral_us;
+    uint32_t last_us; /* integrated up to here */
+    uint32_t edge_us; /* latest change of the raw level */
+    bool level;       /* raw level since edge_us */
+    bool state;       /* accepted level */
+} gpio_event_pin_t;
+
+static gpio_event_pin_t pins[GPIO_EVENT_PIN_MAX];
+static uint8_t pin_count;
+static uint8_t pin_index[MCU_PIN_MAX]; /* MCU pin to pins[], looked up by the ISR */
+static uint32_t settling;              /* bit per pin whose integral is not at an end */
+
+/* edges from the GPIO ISR, the GPIO interrupts share one priority so there is a single writer */
+static gpio_event_edge_t edges[GPIO_EVENT_EDGE_QUEUE_SIZE];
+static volatile uint32_t edge_head;
+static volatile uint32_t edge_tail;
+static volatile uint32_t edges_dropped;
+static uint32_t edges_dropped_seen;
+
+/* debounced events, gpio_event_iteration() to gpio_event_read() */
+static gpio_event_t events[GPIO_EVENT_QUEUE_SIZE];
+static volatile uint32_t event_head;
+static volatile uint32_t event_tail;
+static uint32_t events_dropped;
+
+static void __gpio_event_edge(asdk_mcu_pin_t mcu_pin, uint32_t pin_state);
+static void __gpio_event_apply(uint8_t index, uint32_t timestamp_us, bool level);
+static void __gpio_event_integrate(uint8_t index, uint32_t now_us);
+static void __gpio_event_push(uint8_t index, uint32_t timestamp_us, bool state);
+
+static void __gpio_event_edge(asdk_mcu_pin_t mcu_pin, uint32_t pin_state)
+{
+    uint32_t timestamp = GPIO_EVENT_TIMESTAMP_US();
+    uint32_t head = edge_head;
+    gpio_event_edge_t *edge;
+
+    if ((mcu_pin >= MCU_PIN_MAX) || (GPIO_EVENT_NO_INDEX == pin_index[mcu_pin]))
+    {
+        return;
+    }
+
+    if ((head - edge_tail) >= GPIO_EVENT_EDGE_QUEUE_SIZE)
+    {
+        edges_dropped++;
+        return;
+    }
+
+    edge = &edges[head & GPIO_EVENT_EDGE_MASK];
+    edge->timestamp_us = timestamp;
+    edge->index = pin_index[mcu_pin];
+    edge->level = (0U != pin_state);
+
+    ASDK_MEMORY_BARRIER()
+    edge_head = head + 1U;
+}
+
+static void __gpio_event_apply(uint8_t index, uint32_t timestamp_us, bool level)
+{
+    gpio_event_pin_t *pin = &pins[index];
+
+    __gpio_event_integrate(index, timestamp_us);
+
+    // same level twice means a short pulse was missed, it only adds chatter
+    if (level != pin->level)
+    {
+        pin->level = level;
+        pin->edge_us = timestamp_us;
+    }
+
+    settling |= (1UL << index);
+}
+
+static void __gpio_event_integrate(uint8_t index, uint32_t now_us)
+{
+    gpio_event_pin_t *pin = &pins[index];
+    uint32_t debounce_us = gpio_event_config[index].debounce_us;
+    uint32_t elapsed = now_us - pin->last_us;
+
+    pin->last_us = now_us;
+
+    if (pin->level)
+    {
+        if (elapsed < (debounce_us - pin->integral_us))
+        {
+            pin->integral_us += elapsed;
+            return;
+        }
+
+        pin->integral_us = debounce_us;
+    }
+    else
+    {
+        if (elapsed < pin->integral_us)
+        {
+            pin->integral_us -= elapsed;
+            return;
+        }
+
+        pin->integral_us = 0;
+    }
+
+    settling &= ~(1UL << index);
+
+    if (pin->state != pin->level)
+    {
+        pin->state = pin->level;
+        __gpio_event_push(index, pin->edge_us, pin->state);
+    }
+}
+
+static void __gpio_event_push(uint8_t index, uint32_t timestamp_us, bool state)
+{
+    uint32_t head = event_head;
+    gpio_event_t *event;
+
+    if ((head - event_tail) >= GPIO_EVENT_QUEUE_SIZE)
+    {
+        events_dropped++;
+        return;
+    }
+
+    event = &events[head & GPIO_EVENT_MASK];
+    event->timestamp_us = timestamp_us;
+    event->pin = gpio_event_config[index].pin;
+    event->state = state;
+
+    ASDK_MEMORY_BARRIER()
+    event_head = head + 1U;
+}
+
+void gpio_event_init(void)
+{
+    asdk_errorcode_t status;
+    asdk_gpio_snapshot_t inputs;
+    gpio_event_pin_t *pin;
+    uint32_t now;
+
+    pin_count = (gpio_event_config_size < GPIO_EVENT_PIN_MAX) ? gpio_event_config_size : GPIO_EVENT_PIN_MAX;
+    memset(pin_index, GPIO_EVENT_NO_INDEX, sizeof(pin_index));
+
+    // levels at init are accepted as they are
+    status = asdk_gpio_read_ports(&inputs);
+    ASDK_DEV_ERROR_ASSERT(status, ASDK_GPIO_SUCCESS);
+
+    now = GPIO_EVENT_TIMESTAMP_US();
+
+    for (uint8_t i = 0; i < pin_count; i++)
+    {
+        pin = &pins[i];
+        pin_index[gpio_event_config[i].pin] = i;
+
+        pin->level = asdk_gpio_snapshot_get(&inputs, gpio_event_config[i].pin);
+        pin->state = pin->level;
+        pin->integral_us = pin->level ? gpio_event_config[i].debounce_us : 0U;
+        pin->last_us = now;
+        pin->edge_us = now;
+    }
+
+    status = asdk_gpio_install_callback(__gpio_event_edge);
+    ASDK_DEV_ERROR_ASSERT(status, ASDK_GPIO_SUCCESS);
+}
+
+void gpio_event_iteration(void)
+{
+    uint32_t now = GPIO_EVENT_TIMESTAMP_US();
+    uint32_t tail = edge_tail;
+    uint32_t dropped = edges_dropped;
+    uint32_t pending;
+    gpio_event_edge_t *edge;
+    asdk_gpio_state_t level;
+    uint8_t index;
+
+    while (tail != edge_head)
+    {
+        ASDK_MEMORY_BARRIER()
+        edge = &edges[tail & GPIO_EVENT_EDGE_MASK];
+
+        // edges after now are integrated by the next iteration
+        if ((int32_t)(edge->timestamp_us - now) > 0)
+        {
+            break;
+        }
+
+        __gpio_event_apply(edge->index, edge->timestamp_us, edge->level);
+
+        tail++;
+        ASDK_MEMORY_BARRIER()
+        edge_tail = tail;
+    }
+
+    // edges were lost, restart the integration from the current levels
+    if (dropped != edges_dropped_seen)
+    {
+        edges_dropped_seen = dropped;
+
+        for (uint8_t i = 0; i < pin_count; i++)
+        {
+            if (ASDK_GPIO_SUCCESS == asdk_gpio_get_input_state(gpio_event_config[i].pin, &level))
+            {
+                __gpio_event_apply(i, now, (ASDK_GPIO_STATE_HIGH == level));
+            }
+        }
+    }
+
+    pending = settling;
+
+    while (0U != pending)
+    {
+        index = (uint8_t)__builtin_ctz(pending);
+        pending &= pending - 1U;
+
+        __gpio_event_integrate(index, now);
+    }
+}
+
+bool gpio_event_read(gpio_event_t *event)
+{
+    uint32_t tail = event_tail;
+
+    if ((NULL == event) || (tail == event_head))
+    {
+        return false;
+    }
+
+    ASDK_MEMORY_BARRIER()
+    *event = events[tail & GPIO_EVENT_MASK];
+
+    ASDK_MEMORY_BARRIER()
+    event_tail = tail + 1U;
+
+    return true;
+}
+
+bool gpio_event_get_state(asdk_mcu_pin_t pin)
+{
+    if ((pin >= MCU_PIN_MAX) || (GPIO_EVENT_NO_INDEX == pin_index[pin]))
+    {
+        return false;
+    }
+
+    return pins[pin_index[pin]].state;
+}
+
+uint32_t gpio_event_get_dropped(void)
+{
+    return edges_dropped + events_dropped;
+}
@@ -0,0 +1,60 @@
+#ifndef GPIO_EVENT_H
+#define GPIO_EVENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "asdk_gpio.h"
+
+/* Debounced GPIO input events: the pins interrupt on both edges, the edges
+   are timestamped in the GPIO ISR and debounced by gpio_event_iteration(),
+   which queues an event for every accepted level change. */
+
+/* pins served, each needs both-edge interrupts in its asdk_gpio_config_t */
+#ifndef GPIO_EVENT_PIN_MAX
+#define GPIO_EVENT_PIN_MAX 8U
+#endif
+
+/* raw edges between two iterations, a power of 2 */
+#ifndef GPIO_EVENT_EDGE_QUEUE_SIZE
+#define GPIO_EVENT_EDGE_QUEUE_SIZE 32U
+#endif
+
+/* debounced events not read yet, a power of 2 */
+#ifndef GPIO_EVENT_QUEUE_SIZE
+#define GPIO_EVENT_QUEUE_SIZE 16U
+#endif
+
+typedef struct
+{
+    asdk_mcu_pin_t pin;
+    uint32_t debounce_us; /* integration time, a level must win by this much to be accepted */
+} gpio_event_config_t;
+
+typedef struct
+{
+    uint32_t timestamp_us; /* edge that started the accepted level */
+    asdk_mcu_pin_t pin;
+    bool state;
+} gpio_event_t;
+
+extern gpio_event_config_t gpio_event_config[];
+extern const uint8_t gpio_event_config_size;
+
+/* call after the pins are initialized, installs the GPIO callback */
+void gpio_event_init(void);
+
+/* Debounces the queued edges and the time since, call every tick. Returns
+   quickly when no pin is settling. */
+void gpio_event_iteration(void);
+
+/* Oldest debounced event, false when there is none. Single consumer. */
+bool gpio_event_read(gpio_event_t *event);
+
+/* debounced level, false for pins not served */
+bool gpio_event_get_state(asdk_mcu_pin_t pin);
+
+/* edges and events lost to full queues */
+uint32_t gpio_event_get_dropped(void);
+
+#endif /* GPIO_EVENT_H */
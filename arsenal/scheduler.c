@@ -1,13 +1,50 @@
+#include <string.h>
+
 #include "scheduler.h"
+#include "asdk_system.h"
 #include "asdk_timer.h"
+#include "debug_uart.h"
+
+#define SCHEDULER_TIMER ASDK_TIMER_MODULE_CH_76
+#define SCHEDULER_TIMER_PERIOD 1000 /* 1 MHz counts per tick */
+
+/* task timestamps, cycle counter of the core where available */
+#ifndef SCHEDULER_CYCLE_COUNT
+#if defined(_CORE_cm4_)
+#define SCHEDULER_CYCLE_COUNT() (DWT->CYCCNT)
+#define SCHEDULER_CYCLES_PER_MS() (asdk_sys_get_core_clock_frequency() / 1000U)
+#else
+/* Cortex-M0+ has no DWT, use the microseconds of the system time base */
+#define SCHEDULER_CYCLE_COUNT() ((uint32_t)asdk_sys_get_time_us())
+#define SCHEDULER_CYCLES_PER_MS() (SCHEDULER_TIMER_PERIOD)
+#endif
+#endif
+
+/* waits for an interrupt, called with interrupts disabled */
+#ifndef SCHEDULER_IDLE
+#define SCHEDULER_IDLE() __WFI()
+#endif
 
 static scheduler_t *scheduler_config_p;
 static uint8_t scheduler_config_size = 0;
 static uint64_t current_tick = 0;
+static scheduler_mode_t scheduler_mode = SCHEDULER_MODE_RELATIVE;
+static uint32_t cycles_per_ms = 0;
+static bool always_run = false;
 
-volatile uint64_t tick_ms = 0;
+static volatile uint32_t pending_events = 0;
+static volatile uint32_t event_posted_cycles = 0; /* first event since the last pick up */
+static scheduler_latency_t event_latency = {0};
+
+/* system time at the scheduler timer start, ticks are counted from here so
+   that they change right when the timer interrupts */
+static uint64_t tick_origin_us = 0;
 
 static void timer_callback(asdk_timer_event_t);
+static void __scheduler_run(scheduler_t *task, uint64_t release_tick, bool released);
+static void __scheduler_idle(void);
+static uint32_t __scheduler_take_events(void);
+static uint64_t __scheduler_now_ms(void);
 
 static asdk_timer_t scheduler_timer_config = 
 {
@@ -18,7 +55,7 @@ static asdk_timer_t scheduler_timer_config =
         .config.timer = 
         {
             .callback = &timer_callback,
-            .timer_period = 1000,               // Setting count for 1ms
+            .timer_period = SCHEDULER_TIMER_PERIOD, // Setting count for 1ms
         }
     },
     .direction = ASDK_TIMER_COUNT_DIRECTION_UP,
@@ -35,12 +72,17 @@ static asdk_timer_t scheduler_timer_config =
     },
 };
 
+static uint64_t __scheduler_now_ms(void)
+{
+    return (asdk_sys_get_time_us() - tick_origin_us) / SCHEDULER_TIMER_PERIOD;
+}
+
 static void timer_callback(asdk_timer_event_t timer_event)
 {
     switch (timer_event)
     {
     case ASDK_TIMER_TERMINAL_COUNT_EVENT:
-        tick_ms++;
+        scheduler_tick();
         break;
 
     default:
@@ -48,35 +90,260 @@ static void timer_callback(asdk_timer_event_t timer_event)
     }
 }
 
+static void __scheduler_run(scheduler_t *task, uint64_t release_tick, bool released)
+{
+    scheduler_stats_t *stats = &task->stats;
+    uint64_t start_us;
+    uint32_t start;
+    uint32_t exec_cycles;
+    uint32_t jitter_cycles;
+
+    start_us = asdk_sys_get_time_us();
+    start = SCHEDULER_CYCLE_COUNT();
+    (*task->task_fn)();
+    exec_cycles = SCHEDULER_CYCLE_COUNT() - start;
+
+    if (0 == stats->run_count || exec_cycles < stats->exec_min_cycles)
+    {
+        stats->exec_min_cycles = exec_cycles;
+    }
+
+    if (exec_cycles > stats->exec_max_cycles)
+    {
+        stats->exec_max_cycles = exec_cycles;
+    }
+
+    stats->exec_total_cycles += exec_cycles;
+    stats->run_count++;
+
+    // event driven runs have no release time
+    if (!released)
+    {
+        return;
+    }
+
+    // release to start, in microseconds of the time base
+    jitter_cycles = (uint32_t)(start_us - tick_origin_us - (release_tick * SCHEDULER_TIMER_PERIOD)) *
+                    (cycles_per_ms / SCHEDULER_TIMER_PERIOD);
+
+    if (jitter_cycles > stats->jitter_max_cycles)
+    {
+        stats->jitter_max_cycles = jitter_cycles;
+    }
+
+    stats->jitter_total_cycles += jitter_cycles;
+
+    if (exec_cycles > (uint32_t)task->periodicty * cycles_per_ms)
+    {
+        stats->overrun_count++;
+    }
+}
+
+static void __scheduler_idle(void)
+{
+    if (always_run)
+    {
+        return;
+    }
+
+    // an interrupt pending at WFI wakes the core even with interrupts disabled
+    ASDK_ENTER_CRITICAL_SECTION()
+    if (0 == pending_events)
+    {
+        event_latency.idle_count++;
+        SCHEDULER_IDLE();
+    }
+    ASDK_EXIT_CRITICAL_SECTION()
+}
+
+static uint32_t __scheduler_take_events(void)
+{
+    uint32_t events;
+    uint32_t posted_cycles;
+    uint32_t latency_cycles;
+
+    ASDK_ENTER_CRITICAL_SECTION()
+    events = pending_events;
+    posted_cycles = event_posted_cycles;
+    pending_events = 0;
+    ASDK_EXIT_CRITICAL_SECTION()
+
+    if (0 != events)
+    {
+        latency_cycles = SCHEDULER_CYCLE_COUNT() - posted_cycles;
+
+        if (latency_cycles > event_latency.max_cycles)
+        {
+            event_latency.max_cycles = latency_cycles;
+        }
+
+        event_latency.total_cycles += latency_cycles;
+        event_latency.count++;
+    }
+
+    return events;
+}
+
+void scheduler_tick(void)
+{
+    scheduler_post_event(SCHEDULER_EVENT_TICK);
+}
+
+void scheduler_post_event(uint32_t events)
+{
+    ASDK_ENTER_CRITICAL_SECTION()
+    if (0 == pending_events)
+    {
+        event_posted_cycles = SCHEDULER_CYCLE_COUNT();
+    }
+
+    pending_events |= events;
+    ASDK_EXIT_CRITICAL_SECTION()
+}
+
 void scheduler_init(scheduler_t *scheduler_config, uint8_t size)
 {
     asdk_errorcode_t status;
 
     scheduler_config_p = scheduler_config;
     scheduler_config_size = size;
+    cycles_per_ms = SCHEDULER_CYCLES_PER_MS();
+
+    for(uint8_t i=0; i < size; i++)
+    {
+        if((scheduler_config[i].periodicty == 0) && (scheduler_config[i].events == 0))
+        {
+            always_run = true;
+        }
+    }
+
+#if defined(_CORE_cm4_)
+    /* enable the DWT cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 
-    /* Initializing the timer channel 75 as periodic */
-    status = asdk_timer_init(ASDK_TIMER_MODULE_CH_76, &scheduler_timer_config);
+    /* Initializing the timer channel 76 as periodic */
+    status = asdk_timer_init(SCHEDULER_TIMER, &scheduler_timer_config);
     ASDK_DEV_ERROR_ASSERT(status, ASDK_TIMER_SUCCESS);
 
-    status = asdk_timer_start(ASDK_TIMER_MODULE_CH_76);
+    // taken before the start, so a tick never finds the time base short of it
+    tick_origin_us = asdk_sys_get_time_us();
+
+    status = asdk_timer_start(SCHEDULER_TIMER);
     ASDK_DEV_ERROR_ASSERT(status, ASDK_TIMER_SUCCESS);
 }
 
 void scheduler_iteration(void)
 {
-    current_tick = tick_ms;
+    scheduler_t *task;
+    uint64_t releases;
+    uint32_t events;
+
+    // sleep until an interrupt posts an event
+    __scheduler_idle();
+
+    events = __scheduler_take_events();
+    current_tick = __scheduler_now_ms();
 
     for(uint8_t i=0; i < scheduler_config_size; i++)
     {
-        if(scheduler_config_p[i].periodicty == 0)
+        task = &scheduler_config_p[i];
+
+        if(task->periodicty == 0)
+        {
+            if((task->events == 0) || (task->events & events))
+            {
+                __scheduler_run(task, current_tick, false);
+            }
+        }
+        else if((current_tick - task->last_tick) >= task->periodicty)
         {
-            (*scheduler_config_p[i].task_fn)();
+            releases = (current_tick - task->last_tick) / task->periodicty;
+            task->stats.skipped_count += (uint32_t)(releases - 1);
+
+            if(scheduler_mode == SCHEDULER_MODE_DEADLINE)
+            {
+                // serve the latest release, later ones stay on the grid
+                task->last_tick += releases * task->periodicty;
+                __scheduler_run(task, task->last_tick, true);
+            }
+            else
+            {
+                __scheduler_run(task, task->last_tick + task->periodicty, true);
+                task->last_tick = current_tick;
+            }
         }
-        else if((current_tick - scheduler_config_p[i].last_tick) >= scheduler_config_p[i].periodicty)
+        else if(task->events & events)
         {
-            (*scheduler_config_p[i].task_fn)();
-            scheduler_config_p[i].last_tick = current_tick;
+            __scheduler_run(task, current_tick, false);
         }
     }
 }
+
+void scheduler_get_latency(scheduler_latency_t *latency)
+{
+    if(NULL != latency)
+    {
+        *latency = event_latency;
+    }
+}
+
+void scheduler_set_mode(scheduler_mode_t mode)
+{
+    if(mode < SCHEDULER_MODE_MAX)
+    {
+        scheduler_mode = mode;
+    }
+}
+
+bool scheduler_get_stats(uint8_t task_index, scheduler_stats_t *stats)
+{
+    if((task_index >= scheduler_config_size) || (NULL == stats))
+    {
+        return false;
+    }
+
+    *stats = scheduler_config_p[task_index].stats;
+
+    return true;
+}
+
+void scheduler_reset_stats(void)
+{
+    for(uint8_t i=0; i < scheduler_config_size; i++)
+    {
+        memset(&scheduler_config_p[i].stats, 0, sizeof(scheduler_stats_t));
+    }
+
+    memset(&event_latency, 0, sizeof(event_latency));
+}
+
+uint32_t scheduler_get_cycles_per_ms(void)
+{
+    return cycles_per_ms;
+}
+
+void scheduler_print_stats(void)
+{
+    scheduler_stats_t *stats;
+    uint32_t runs;
+
+    debug_uart_printf("scheduler: %lu cycles/ms, event latency %lu/%lu, idle %lu\r\n", (unsigned long)cycles_per_ms,
+           (unsigned long)(event_latency.total_cycles / ((event_latency.count > 0) ? event_latency.count : 1)),
+           (unsigned long)event_latency.max_cycles, (unsigned long)event_latency.idle_count);
+
+    for(uint8_t i=0; i < scheduler_config_size; i++)
+    {
+        stats = &scheduler_config_p[i].stats;
+        runs = (stats->run_count > 0) ? stats->run_count : 1;
+
+        debug_uart_printf("task %u %lums: runs %lu exec %lu/%lu/%lu jitter %lu/%lu overrun %lu skipped %lu\r\n",
+               i, (unsigned long)scheduler_config_p[i].periodicty, (unsigned long)stats->run_count,
+               (unsigned long)stats->exec_min_cycles, (unsigned long)(stats->exec_total_cycles / runs),
+               (unsigned long)stats->exec_max_cycles, (unsigned long)(stats->jitter_total_cycles / runs),
+               (unsigned long)stats->jitter_max_cycles, (unsigned long)stats->overrun_count,
+               (unsigned long)stats->skipped_count);
+    }
+}
@@ -5,14 +5,66 @@
 
 typedef void (*task_t)(void);
 
+/* event bits posted from interrupts, bit 0 is the scheduler tick */
+#define SCHEDULER_EVENT(n) (1UL << (n))
+#define SCHEDULER_EVENT_TICK SCHEDULER_EVENT(0)
+
+typedef enum
+{
+    SCHEDULER_MODE_RELATIVE = 0, /* next release counted from the last run (default) */
+    SCHEDULER_MODE_DEADLINE,     /* fixed release times, last_tick += periodicty */
+    SCHEDULER_MODE_MAX,
+} scheduler_mode_t;
+
+/* timing in cycles of the scheduler timestamp, see scheduler_get_cycles_per_ms() */
+typedef struct
+{
+    uint32_t run_count;
+    uint32_t exec_min_cycles;
+    uint32_t exec_max_cycles;
+    uint64_t exec_total_cycles;   /* divide by run_count for the average */
+    uint32_t jitter_max_cycles;   /* delay from release to start */
+    uint64_t jitter_total_cycles; /* divide by run_count for the average */
+    uint32_t overrun_count;       /* runs longer than the period */
+    uint32_t skipped_count;       /* releases missed because of a late run */
+} scheduler_stats_t;
+
+/* delay from an interrupt posting an event to the loop picking it up */
+typedef struct
+{
+    uint32_t count;
+    uint32_t max_cycles;
+    uint64_t total_cycles; /* divide by count for the average */
+    uint32_t idle_count;   /* number of times the core slept */
+} scheduler_latency_t;
+
 typedef struct
 {
     const task_t task_fn;
     uint64_t last_tick;
     const uint64_t periodicty;
+    const uint32_t events; /* also run when one of these events is posted */
+    scheduler_stats_t stats;
 } scheduler_t;
 
 void scheduler_init(scheduler_t *scheduler_config, uint8_t size);
 void scheduler_iteration(void);
 
+/* 1 ms wake up, called by the scheduler timer. Ticks are counted from the
+   system time base, see asdk_sys_get_time_us(). */
+void scheduler_tick(void);
+
+/* Marks events pending, safe to call from interrupts. A task with periodicty 0
+   and no events runs on every iteration and keeps the core from sleeping. */
+void scheduler_post_event(uint32_t events);
+void scheduler_get_latency(scheduler_latency_t *latency);
+
+void scheduler_set_mode(scheduler_mode_t mode);
+bool scheduler_get_stats(uint8_t task_index, scheduler_stats_t *stats);
+void scheduler_reset_stats(void);
+uint32_t scheduler_get_cycles_per_ms(void);
+
+/* prints the statistics of all tasks over the debug UART */
+void scheduler_print_stats(void);
+
 #endif /* SCHEDULER_H */
@@ -146,8 +146,8 @@ typedef enum
 {
     ASDK_ADC_CALLBACK_REASON_DEFAULT = 0u, /*!< Default value - depends on MCU. */
 
-    ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE,      /*!< Conversion Complete Flag. */
-    ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE_HALF, /*!< 50% Conversion Complete - in case of continuous conversion. */
+    ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE,      /*!< Conversion Complete Flag. With group DMA, the second half of dma_dest is filled. */
+    ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE_HALF, /*!< 50% Conversion Complete - in case of continuous conversion. With group DMA, the first half of dma_dest is filled. */
     ASDK_ADC_CALLBACK_REASON_CONVERSION_ERROR,         /*!< Error in Conversion. */
     ASDK_ADC_CALLBACK_REASON_ADC_MOD_ERROR,            /*!< ADC Module Error. */
 
@@ -240,11 +240,18 @@ typedef struct
     bool enable_group;                   /*!< Enable group conversion. */
     void *adc_group_instance;            /*!< Instance of the group conversion - used to trigger and read adc values. */
     asdk_adc_callback_fn_t grp_callback; /*!< Callback for ADC group events (Error/Conversion Complete). */
+    bool enable_continuous;              /*!< Group is re-triggered by hardware as soon as it completes, started once by
+                                              @ref asdk_adc_start_group_conversion_non_blocking. */
+    uint16_t average_samples;            /*!< Conversions averaged in hardware for each group result, power of 2 up to 256.
+                                              0 or 1 disables averaging. */
 
     /* DMA Configs */
-    bool enable_dma;      /*!< DMA Enabled for data transfer - Additional Congigs in DMA module (If required). */
-    uint32_t *dma_dest;   /*!< Destination address for DMA transfer - array of 32-bit. */
-    uint8_t dma_dest_len; /*!< DMA destination buffer length. */
+    bool enable_dma;      /*!< DMA Enabled for data transfer, groups only. Each group done moves one scan into
+                               dma_dest, the group callback reports each filled half instead of each scan. */
+    uint32_t *dma_dest;   /*!< Destination address for DMA transfer - array of 32-bit. For a group it is a double
+                               buffer of scans, pin_count results each in the order of pin_nums. */
+    uint8_t dma_dest_len; /*!< DMA destination buffer length in 32-bit words. For a group it is split into two
+                               halves of a whole number of scans. */
 } asdk_adc_config_t;
 
 /** @} */ // end of asdk_adc_ds_group
@@ -297,7 +304,7 @@ typedef void (*asdk_adc_callback_fn_t)(asdk_adc_callback_t info);
     @return
       - @ref ASDK_ADC_ERROR_HW_TRIG_NOT_SUPPORTED
       - @ref ASDK_ADC_ERROR_DMA_TRIG_NOT_SUPPORTED
-      - @ref ASDK_ADC_ERROR_DMA_TRIG_NOT_SUPPORTED
+      - @ref ASDK_ADC_ERROR_INVALID_DMA_CONFIG
       - @ref ASDK_ADC_ERROR_NULL_PTR
       - @ref ASDK_ADC_ERROR_INVALID_PIN_COUNT
       - @ref ASDK_ADC_ERROR_INVALID_PIN
@@ -469,12 +476,15 @@ asdk_errorcode_t asdk_adc_start_group_conversion_blocking(void *adc_group_instan
 /* Function : asdk_adc_start_group_conversion_non_blocking */
 /*----------------------------------------------------------------------------*/
 /*!
-    @brief This function will start group conversion of all channel of that module in non-blocking mio
+    @brief This function will start group conversion of all channel of that module in non-blocking mode.
+    The group callback is called from the ISR when the last channel of the group is converted.
 
     @param [in] adc_group_instance Instance of the group conversion - used to trigger and read adc values.
 
     @return
-      - @ref ASDK_ADC_ERROR_FUNCTION_NOT_IMPLEMENTED
+      - @ref ASDK_SUCCESS
+      - @ref ASDK_ADC_ERROR_INVALID_GROUP_INSTANCE
+      - @ref ASDK_ADC_ERROR_CONVERSION_FAIL
 
 */
 asdk_errorcode_t asdk_adc_start_group_conversion_non_blocking(void *adc_group_instance);
@@ -489,7 +499,9 @@ asdk_errorcode_t asdk_adc_start_group_conversion_non_blocking(void *adc_group_in
     @param [out] status Pointer to the adc status buffer.
 
     @return
-      - @ref ASDK_ADC_ERROR_FUNCTION_NOT_IMPLEMENTED
+      - @ref ASDK_SUCCESS
+      - @ref ASDK_ADC_ERROR_INVALID_GROUP_INSTANCE
+      - @ref ASDK_ADC_ERROR_NULL_PTR
 
 */
 asdk_errorcode_t asdk_adc_get_group_conversion_status_non_blocking(void *adc_group_instance, asdk_adc_conversion_status_t *status);
@@ -498,7 +510,8 @@ asdk_errorcode_t asdk_adc_get_group_conversion_status_non_blocking(void *adc_gro
 /* Function : asdk_adc_read_group_conversion_value_non_blocking */
 /*----------------------------------------------------------------------------*/
 /*!
-    @brief Read the data of the all group channel of the ADC module.
+    @brief Read the data of the all group channel of the ADC module, in the
+    order of the pins passed to @ref asdk_adc_init. Safe to call from the group callback.
 
 
     @param [in] adc_group_instance Instance of the group conversion - used to trigger and read adc values.
@@ -506,7 +519,10 @@ asdk_errorcode_t asdk_adc_get_group_conversion_status_non_blocking(void *adc_gro
     @param [in] buffer_len Length of the data buffer
 
     @return
-      - @ref ASDK_ADC_ERROR_FUNCTION_NOT_IMPLEMENTED
+      - @ref ASDK_SUCCESS
+      - @ref ASDK_ADC_ERROR_INVALID_GROUP_INSTANCE
+      - @ref ASDK_ADC_ERROR_NULL_PTR
+      - @ref ASDK_ADC_ERROR_INVALID_GROUP_INPUT when buffer_len is less than the group pin count
 */
 asdk_errorcode_t asdk_adc_read_group_conversion_value_non_blocking(void *adc_group_instance, uint32_t *adc_data, uint8_t buffer_len);
 
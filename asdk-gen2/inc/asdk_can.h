@@ -283,6 +283,7 @@ typedef struct
 {
     asdk_can_mailbox_t *tx_mailboxes; /*!< An array of mailboxes to be configured for transmission. */
     uint8_t no_of_tx_mailbox;         /*!< Number elements in tx_mailboxes. */
+    uint8_t no_of_tx_queue_mailbox;   /*!< Number of mailboxes used as transmit queue when tx_mailboxes is NULL, 0 uses a single mailbox. */
 
     asdk_can_mailbox_t *rx_mailboxes; /*!< An array of mailboxes to be configured for reception. */
     uint8_t no_of_rx_mailbox;         /*!< Number elements in rx_mailboxes. */
@@ -324,6 +325,18 @@ typedef struct
     uint8_t *message; /*!< A pointer to a buffer for holding data. */
 } asdk_can_message_t;
 
+/*!
+ * @brief An data structure to represent a classic CAN frame with in-place
+ * storage for the data bytes. Used as a receive slot so that the DAL can
+ * extract a frame directly into the memory owned by the caller.
+ */
+typedef struct
+{
+    uint32_t can_id;    /*!< The CAN message identifier (CAN ID). */
+    uint8_t dlc;        /*!< Length of the message. */
+    uint8_t message[8]; /*!< Buffer holding the data bytes. */
+} asdk_can_frame_t;
+
 /** @} */ // end of asdk_can_ds_group
 
 /*==============================================================================
@@ -353,6 +366,26 @@ typedef struct
  */
 typedef void (*asdk_can_callback_t)(uint8_t can_ch, asdk_can_event_t event, asdk_can_message_t *can_message);
 
+/*!
+ * @brief The CAN module's receive slot claim function type. Refer
+   @ref asdk_can_install_rx_slot_handler. Called from interrupt context.
+
+   @param can_ch The CAN channel on which a frame was received.
+
+   @return Pointer to a free frame slot, NULL if no slot is available in
+   which case the frame is dropped.
+ */
+typedef asdk_can_frame_t *(*asdk_can_rx_claim_t)(uint8_t can_ch);
+
+/*!
+ * @brief The CAN module's receive slot commit function type. Refer
+   @ref asdk_can_install_rx_slot_handler. Called from interrupt context
+   after the claimed slot has been filled.
+
+   @param can_ch The CAN channel on which a frame was received.
+ */
+typedef void (*asdk_can_rx_commit_t)(uint8_t can_ch);
+
 /** @} */ // end of asdk_can_cb_group
 
 /*==============================================================================
@@ -442,6 +475,29 @@ asdk_errorcode_t asdk_can_deinit(asdk_can_channel_t can_ch);
 */
 asdk_errorcode_t asdk_can_install_callback(asdk_can_callback_t callback);
 
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_can_install_rx_slot_handler */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief This function registers the receive slot handlers. When installed,
+  a received frame is extracted from the hardware Rx FIFO directly into the
+  slot returned by the claim function and then published with the commit
+  function. The @ref ASDK_CAN_RX_EVENT is no longer reported through the
+  callback installed with @ref asdk_can_install_callback.
+
+  @note
+  This a module level handler. Only classic CAN frames (up to 8 bytes) are
+  supported.
+
+  @param [in] claim Function returning a free frame slot.
+  @param [in] commit Function publishing the filled frame slot.
+
+  @return
+    - @ref ASDK_CAN_SUCCESS
+    - @ref ASDK_CAN_ERROR_NULL_PTR
+*/
+asdk_errorcode_t asdk_can_install_rx_slot_handler(asdk_can_rx_claim_t claim, asdk_can_rx_commit_t commit);
+
 /*----------------------------------------------------------------------------*/
 /* Function : asdk_can_sleep */
 /*----------------------------------------------------------------------------*/
@@ -474,6 +530,28 @@ asdk_errorcode_t asdk_can_sleep(asdk_can_channel_t can_ch);
 */
 asdk_errorcode_t asdk_can_is_tx_busy(asdk_can_channel_t can_ch, uint8_t virtual_mailbox_no, bool *status);
 
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_can_get_free_tx_mailbox */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief This function finds a mailbox of the transmit queue that can accept
+  the next message. Refer no_of_tx_queue_mailbox of @ref asdk_can_hw_filter_t.
+
+  The mailboxes are handed out in ascending order so that messages with the
+  same CAN ID leave the controller in the order they were written. Messages
+  with different CAN IDs are sent lowest CAN ID first.
+
+  @param [in] can_ch CAN channel number.
+  @param [out] virtual_mailbox_no Free Tx mailbox number, valid only when status is false.
+  @param [out] status true if no mailbox is free, false otherwise.
+
+  @return
+    - @ref ASDK_CAN_SUCCESS
+    - @ref ASDK_CAN_ERROR_INVALID_CHANNEL
+    - @ref ASDK_CAN_ERROR_NULL_PTR
+*/
+asdk_errorcode_t asdk_can_get_free_tx_mailbox(asdk_can_channel_t can_ch, uint8_t *virtual_mailbox_no, bool *status);
+
 /*----------------------------------------------------------------------------*/
 /* Function : asdk_can_write */
 /*----------------------------------------------------------------------------*/
@@ -22,6 +22,13 @@
     virtual address are mapped to each variable of the structure and is being taken
     care inside the DAL of emulated eeprom module.
     This eeprom module developed is for the emulation of upto 4KB (4*1024 Bytes).
+
+    In journaled mode writes are kept in RAM and programmed by
+    asdk_emulated_eeprom_iteration(), one flash operation per call. The data
+    rotates over EMULATED_EEPROM_NB_PAGE_COUNT pages and every batch of records
+    is closed by a commit record, so a reset never exposes a partial batch.
+    The first journaled init after the blocking or non-blocking mode migrates
+    the valid page of the two page format into the ring, so the data is kept.
 */
 
 #ifndef ASDK_EMULATED_EEPROM_H
@@ -36,6 +43,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "asdk_error.h"
+#include "asdk_platform.h"
 
 /*==============================================================================
 
@@ -80,6 +88,16 @@
 #define INITIAL_VALUE ((uint8_t)0x01)
 #define INITIAL_VALUE_ZERO ((uint8_t)0x00)
 #define INITIAL_PAGE_STATUS   ((uint32_t)0x66666666)
+
+/* Journaled mode: pages in the wear levelling ring, 16KByte each from EEPROM_START_ADDRESS */
+#ifndef EMULATED_EEPROM_NB_PAGE_COUNT
+#define EMULATED_EEPROM_NB_PAGE_COUNT 4
+#endif
+
+/* Journaled mode: 2 byte variables that can wait in RAM for the next batch */
+#ifndef EMULATED_EEPROM_JOURNAL_SIZE
+#define EMULATED_EEPROM_JOURNAL_SIZE 64
+#endif
 /*==============================================================================
 
                       DEFINITIONS AND TYPES : ENUMS
@@ -113,6 +131,7 @@ typedef enum
 {
     ASDK_EMULATED_EEPROM_OPERATION_NON_BLOCKING_MODE = 0,
     ASDK_EMULATED_EEPROM_OPERATION_BLOCKING_MODE,
+    ASDK_EMULATED_EEPROM_OPERATION_JOURNALED_MODE, /*!< Writes journaled in RAM, asdk_emulated_eeprom_iteration() programs them */
     ASDK_EMULATED_EEPROM_OPERATION_MAX,
     ASDK_EMULATED_EEPROM_OPERATION_INVALID = ASDK_EMULATED_EEPROM_OPERATION_MAX,
 } asdk_emulated_eeprom_operation_mode_t;
@@ -149,6 +168,7 @@ typedef struct
     asdk_emulated_eeprom_type_t  flash_type_used;                              /*Initialize the code flash/data flash/both*///name to be chnaged
     asdk_emulated_eeprom_operation_mode_t emulated_eeprom_operation_mode; /*Initialize the flash in the polling mode or interrupt mode*/
     asdk_emulated_eeprom_size_t emulated_eeprom_size;
+    asdk_exti_interrupt_num_t intr_num;                                   /*Flash completion interrupt, used in non-blocking and journaled mode*/
 } asdk_emulated_eeprom_init_deinit_config_t;
 
 
@@ -311,4 +331,24 @@ asdk_errorcode_t asdk_emulated_eeprom_write(uint8_t *structure_member_addr, uint
 */
 asdk_errorcode_t asdk_emulated_eeprom_update(uint8_t *structure_member_addr, uint8_t *global_structure_addr, uint32_t structure_member_size, uint32_t global_structure_size);
 
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_emulated_eeprom_iteration */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function steps the journaled mode engine: it starts at most one flash
+  program/erase operation and returns. Call it periodically from the scheduler,
+  in the same context as the write function.
+
+  @retval ASDK_EMULATED_EEPROM_STATUS_SUCCESS - nothing pending, the flash holds every write
+  @retval ASDK_EMULATED_EEPROM_STATUS_BUSY - writes are pending or a flash operation is in progress
+  @retval ASDK_EMULATED_EEPROM_STATUS_ERROR - a flash operation failed to start, retried on the next call
+  @retval ASDK_EMULATED_EEPROM_ERROR_NOT_INITIALIZED - not initialized in journaled mode
+
+  @note
+  In journaled mode the write and update functions only journal the data and
+  return ASDK_EMULATED_EEPROM_STATUS_BUSY when the journal cannot take the whole member.
+*/
+asdk_errorcode_t asdk_emulated_eeprom_iteration(void);
+
 #endif /* ASDK_EMULATED_EEPROM_H */
@@ -163,6 +163,11 @@ typedef enum
     ASDK_MW_CAN_SERVICE_TX_QUEUE_FULL,
     ASDK_MW_CAN_SERVICE_RX_QUEUE_EMPTY,
     ASDK_MW_CAN_SERVICE_RX_QUEUE_FULL,
+    ASDK_MW_CAN_SERVICE_ERROR_INVALID_TX_ORDER,
+    ASDK_MW_CAN_SERVICE_PERIODIC_TABLE_FULL,
+    ASDK_MW_CAN_SERVICE_ERROR_INVALID_HANDLE,
+    ASDK_MW_CAN_SERVICE_RX_HANDLER_TABLE_FULL,
+    ASDK_MW_CAN_SERVICE_ERROR_BUFFER_INIT,
     ASDK_MW_ERROR_MAX,
 
     ASDK_I2C_STATUS_SUCCESS = 1201,
@@ -233,6 +238,8 @@ typedef enum
     ASDK_UART_ERROR_MODULE_UNAVAILABLE,
     ASDK_UART_ERROR_FEATURE_NOT_IMPLEMENTED,
     ASDK_UART_ERROR_INVALID_INTR_NUM,
+    ASDK_UART_ERROR_INVALID_DMA_CONFIG,
+    ASDK_UART_ERROR_DMA_BUSY,
     ASDK_UART_ERROR_MAX,
 
     ASDK_PWM_SUCCESS = 1501,                        /*!< PWM status is Success*/
@@ -267,8 +274,15 @@ typedef enum
     ASDK_MW_EXTERNAL_EEPROM_ERROR_LESS_BUFFER_SIZE,             /*!< The External EEPROM buffer size is less than the minimum size*/
     ASDK_MW_EXTERNAL_EEPROM_ERROR_TIMEOUT,                      /*!< The External EEPROM operation is timedout*/
     ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX,                /*!< The External EEPROM selected via index is not valid*/
+    ASDK_MW_EXTERNAL_EEPROM_ERROR_TRANSFER_FAILED,              /*!< The External EEPROM transfer failed on the bus or never got ACKed*/
     ASDK_MW_EXTERNAL_EEPROM_ERROR_MAX,
 
+    ASDK_MW_OS_PROFILE_SUCCESS = 1701,              /*!< The OS profile status is Success*/
+    ASDK_MW_OS_PROFILE_ERROR_NULL_PTR,              /*!< The pointer passed to the OS profile API is NULL*/
+    ASDK_MW_OS_PROFILE_TASK_TABLE_FULL,             /*!< No free slot left to track the task*/
+    ASDK_MW_OS_PROFILE_DUMP_TRUNCATED,              /*!< The write function accepted less than the whole dump*/
+    ASDK_MW_OS_PROFILE_ERROR_MAX,
+
     ASDK_ERROR_MAX,
 } asdk_errorcode_t;
 
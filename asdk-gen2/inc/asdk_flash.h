@@ -141,6 +141,16 @@ typedef struct
     uint32_t destination_addr;                        /*Destination address for the varaible to be read / write*/
 } asdk_flash_operation_config_t;
 
+/*!
+ * @brief Write combining figures of asdk_flash_write_buffered()
+ */
+typedef struct
+{
+    uint32_t buffered_writes;   /*Writes taken by the row buffers*/
+    uint32_t program_ops;       /*Program operations issued for them*/
+    uint32_t program_ops_saved; /*Operations a word by word write of the same data would have added*/
+} asdk_flash_write_stats_t;
+
 
 /*==============================================================================
 
@@ -215,6 +225,17 @@ asdk_errorcode_t asdk_flash_deinit(asdk_flash_config_t *flash_config);
 */
 asdk_errorcode_t asdk_flash_install_callback(asdk_flash_callback_fun_t callback_fun);
 
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_flash_is_operation_complete */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function tells if the last non-blocking program/erase operation has completed.
+
+  @return true when no non-blocking operation is in progress.
+*/
+bool asdk_flash_is_operation_complete(void);
+
 /*----------------------------------------------------------------------------*/
 /* Function : asdk_flash_read_blocking */
 /*----------------------------------------------------------------------------*/
@@ -264,19 +285,80 @@ asdk_errorcode_t asdk_flash_read_non_blocking(asdk_flash_operation_config_t *fla
 asdk_errorcode_t asdk_flash_write_blocking(asdk_flash_operation_config_t *flash_write_config, uint32_t timeout_ms);
 
 /*----------------------------------------------------------------------------*/
-/* Function : asdk_flash_write_non_blocking */
+/* Function : asdk_flash_write_buffered */
 /*----------------------------------------------------------------------------*/
 /*!
   @brief
-   This function enables the user to write to the flash memory based on the address passed in the config structure
+   This function merges the write into 32 byte row buffers in RAM instead of programming it.
+   Adjacent and overlapping writes to a row are combined, the latest bytes win. A row is
+   programmed in one operation once it is full, or by asdk_flash_flush(); when every buffer
+   is in use the oldest row is programmed to make room. Reads see buffered data, blocking
+   writes program overlapping rows first and erases drop them.
+
+  @note Partial rows are programmed per 4 byte (work flash) or 8 byte (code flash) unit, so
+   a unit must not be written again once programmed, as with the direct write.
 
   @param [in] flash_write_config- Flash input config structure for write operation.
   @param [in] timeout_ms  Timeout value for the blocking APIs in ms
 
+  @return
+    - @ref ASDK_FLASH_STATUS_SUCCESS
+    - @ref ASDK_FLASH_STATUS_ERROR
+    - @ref ASDK_FLASH_ERROR_NULL_PTR
+    - @ref ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS
+*/
+asdk_errorcode_t asdk_flash_write_buffered(asdk_flash_operation_config_t *flash_write_config, uint32_t timeout_ms);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_flash_flush */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+   This function programs every row buffered by asdk_flash_write_buffered(), oldest first.
+
+  @param [in] timeout_ms  Timeout value for the blocking APIs in ms
+
+  @return
+    - @ref ASDK_FLASH_STATUS_SUCCESS
+    - @ref ASDK_FLASH_STATUS_ERROR
+*/
+asdk_errorcode_t asdk_flash_flush(uint32_t timeout_ms);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_flash_get_write_stats */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+   This function gives the write combining figures since reset.
+
+  @param [out] stats Write combining figures.
+
   @return
     - @ref ASDK_FLASH_STATUS_SUCCESS
     - @ref ASDK_FLASH_ERROR_NULL_PTR
+*/
+asdk_errorcode_t asdk_flash_get_write_stats(asdk_flash_write_stats_t *stats);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_flash_write_non_blocking */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+   This function starts programming one work flash row (4 or 32 bytes, aligned to its size)
+   and returns without waiting. The flash must be initialized in non-blocking mode, completion
+   is reported through asdk_flash_is_operation_complete() and the installed callback.
+
+  @param [in] flash_write_config- Flash input config structure for write operation.
+
+  @return
+    - @ref ASDK_FLASH_STATUS_SUCCESS
+    - @ref ASDK_FLASH_STATUS_BUSY
+    - @ref ASDK_FLASH_STATUS_ERROR
+    - @ref ASDK_FLASH_ERROR_NULL_PTR
     - @ref ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS
+    - @ref ASDK_FLASH_ERROR_INVALID_DATA_SIZE
+    - @ref ASDK_FLASH_ERROR_INVALID_DATA_ALIGNMENT
+    - @ref ASDK_FLASH_ERROR_INVALID_FLASH_OPERATION_MODE
 */
 asdk_errorcode_t asdk_flash_write_non_blocking(asdk_flash_operation_config_t *flash_write_config);
 
@@ -338,15 +420,18 @@ asdk_errorcode_t asdk_flash_erase_sector_blocking(uint32_t Base_Sector_Address,
 /*----------------------------------------------------------------------------*/
 /*!
   @brief
-  This function erases the flash memory sectorwise based on the config structure passed.
+  This function starts erasing one sector and returns without waiting. The flash must be
+  initialized in non-blocking mode, completion is reported through
+  asdk_flash_is_operation_complete() and the installed callback.
 
   @param [in] Base_Sector_Address Base address of the sector to be erased.
 
   @return
     - @ref ASDK_FLASH_STATUS_SUCCESS
+    - @ref ASDK_FLASH_STATUS_BUSY
     - @ref ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS
+    - @ref ASDK_FLASH_ERROR_INVALID_DATA_ALIGNMENT
     - @ref ASDK_FLASH_ERROR_INVALID_FLASH_OPERATION_MODE
-    - @ref ASDK_FLASH_ERROR_NULL_PTR
     - @ref ASDK_FLASH_STATUS_ERROR
 */
 asdk_errorcode_t asdk_flash_erase_sector_non_blocking(uint32_t Base_Sector_Address);
@@ -29,6 +29,7 @@
 
 /* standard includes ************************* */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /* asdk includes ***************************** */
@@ -48,6 +49,9 @@
 
 ==============================================================================*/
 
+/*! Number of 32-bit words in @ref asdk_gpio_snapshot_t, one bit per MCU pin. */
+#define ASDK_GPIO_SNAPSHOT_WORDS ((MCU_PIN_MAX + 31U) / 32U)
+
 /*==============================================================================
 
                       DEFINITIONS AND TYPES : ENUMS
@@ -180,6 +184,14 @@ typedef struct
     asdk_gpio_interrupt_t interrupt_config; /*!< The required interrupt configuration of the input GPIO pin */
 } asdk_gpio_config_t;
 
+/*!
+ * @brief Input states of all GPIO input pins, latched by @ref asdk_gpio_read_ports.
+ */
+typedef struct
+{
+    uint32_t pins[ASDK_GPIO_SNAPSHOT_WORDS]; /*!< Bit (n % 32) of word (n / 32) is the state of MCU pin n */
+} asdk_gpio_snapshot_t;
+
 /** @} */ // end of asdk_gpio_ds_group
 
 /*==============================================================================
@@ -374,6 +386,42 @@ asdk_errorcode_t asdk_gpio_get_output_state(asdk_mcu_pin_t gpio_pin, asdk_gpio_s
 */
 asdk_errorcode_t asdk_gpio_get_input_state(asdk_mcu_pin_t gpio_pin, asdk_gpio_state_t *gpio_state);
 
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_gpio_read_ports */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function latches the input state of every pin initialized as
+  @ref ASDK_GPIO_MODE_INPUT, reading each GPIO port once. Use it instead of
+  several @ref asdk_gpio_get_input_state calls when the pins must be sampled
+  together or read often. Test the pins with @ref asdk_gpio_snapshot_get.
+
+  @param [out] snapshot Input states, pins which are not inputs read as low.
+
+  @return
+    - @ref ASDK_GPIO_SUCCESS
+    - @ref ASDK_GPIO_ERROR_NULL_PTR
+*/
+asdk_errorcode_t asdk_gpio_read_ports(asdk_gpio_snapshot_t *snapshot);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_gpio_snapshot_get */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function returns the state of the given MCU pin in a snapshot taken by
+  @ref asdk_gpio_read_ports.
+
+  @param [in] snapshot Snapshot of the input pins.
+  @param [in] gpio_pin Pin number of the MCU, must be below @ref MCU_PIN_MAX.
+
+  @return true when the pin was high.
+*/
+static inline bool asdk_gpio_snapshot_get(const asdk_gpio_snapshot_t *snapshot, asdk_mcu_pin_t gpio_pin)
+{
+    return (0U != (snapshot->pins[gpio_pin / 32U] & (1UL << (gpio_pin % 32U))));
+}
+
 /** @} */ // end of asdk_gpio_fun_group
 
 #endif /* ASDK_GPIO_H */
@@ -52,6 +52,9 @@
 #define MAX_DUTY_CYCLE 100U
 #define MIN_DUTY_CYCLE 0U
 
+/*! Q16 duty cycle of 100 %, see @ref asdk_pwm_set_duty_q16 */
+#define ASDK_PWM_DUTY_Q16_MAX 0x10000UL
+
 /*==============================================================================
 
                       DEFINITIONS AND TYPES : ENUMS
@@ -409,6 +412,126 @@ asdk_errorcode_t asdk_pwm_set_duty(asdk_pwm_channel_t pwm_ch, uint8_t duty_cycle
 */
 asdk_errorcode_t asdk_pwm_set_frequency(asdk_pwm_channel_t pwm_ch, asdk_pwm_clock_t pwm_clock, uint32_t pwm_freq_in_Hz);
 
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_pwm_set_duty_counts */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Set the duty cycle of the PWM as a compare value in counter clocks, the
+  output is active for compare_counts of every period.
+
+  @param [in] pwm_ch PWM channel number.
+  @param [in] compare_counts Compare value, 0 to the period in counter clocks.
+
+  @return
+    - @ref ASDK_PWM_SUCCESS
+    - @ref ASDK_PWM_ERROR_INVALID_CHANNEL
+    - @ref ASDK_PWM_ERROR_INVALID_DUTY_CYCLE
+
+  @note The compare register is as wide as the counter. With a full period
+  (0x10000 clocks on a 16-bit counter, 2^32 on a 32-bit one) 100 % is set
+  as the largest compare value, the output goes inactive for the last clock.
+*/
+asdk_errorcode_t asdk_pwm_set_duty_counts(asdk_pwm_channel_t pwm_ch, uint32_t compare_counts);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_pwm_set_duty_q16 */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Set the duty cycle of the PWM as a Q16 fraction of the period, the
+  resolution is one counter clock.
+
+  @param [in] pwm_ch PWM channel number.
+  @param [in] duty_q16 Duty cycle, 0 to @ref ASDK_PWM_DUTY_Q16_MAX (100 %).
+
+  @return
+    - @ref ASDK_PWM_SUCCESS
+    - @ref ASDK_PWM_ERROR_INVALID_CHANNEL
+    - @ref ASDK_PWM_ERROR_INVALID_DUTY_CYCLE
+*/
+asdk_errorcode_t asdk_pwm_set_duty_q16(asdk_pwm_channel_t pwm_ch, uint32_t duty_q16);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_pwm_stage_duty_counts */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Stage a duty cycle in counter clocks, it takes effect with
+  @ref asdk_pwm_commit.
+
+  @param [in] pwm_ch PWM channel number.
+  @param [in] compare_counts Compare value, 0 to the period in counter clocks.
+
+  @return
+    - @ref ASDK_PWM_SUCCESS
+    - @ref ASDK_PWM_ERROR_INVALID_CHANNEL
+    - @ref ASDK_PWM_ERROR_INVALID_DUTY_CYCLE
+
+  @note The value is checked against the period by @ref asdk_pwm_commit,
+  which limits it to the period in effect. 100 % of a full period loses
+  its last clock, see @ref asdk_pwm_set_duty_counts.
+*/
+asdk_errorcode_t asdk_pwm_stage_duty_counts(asdk_pwm_channel_t pwm_ch, uint32_t compare_counts);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_pwm_stage_duty_q16 */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Stage a duty cycle as a Q16 fraction of the period, it takes effect with
+  @ref asdk_pwm_commit. The fraction applies to the period staged for the
+  same commit, if any.
+
+  @param [in] pwm_ch PWM channel number.
+  @param [in] duty_q16 Duty cycle, 0 to @ref ASDK_PWM_DUTY_Q16_MAX (100 %).
+
+  @return
+    - @ref ASDK_PWM_SUCCESS
+    - @ref ASDK_PWM_ERROR_INVALID_CHANNEL
+    - @ref ASDK_PWM_ERROR_INVALID_DUTY_CYCLE
+*/
+asdk_errorcode_t asdk_pwm_stage_duty_q16(asdk_pwm_channel_t pwm_ch, uint32_t duty_q16);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_pwm_stage_period_counts */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Stage a PWM period in counter clocks, it takes effect with
+  @ref asdk_pwm_commit. A duty cycle staged as a fraction follows the new
+  period, otherwise the compare value is kept as is.
+
+  @param [in] pwm_ch PWM channel number.
+  @param [in] period_counts Period in counter clocks, at least 1.
+
+  @return
+    - @ref ASDK_PWM_SUCCESS
+    - @ref ASDK_PWM_ERROR_INVALID_CHANNEL
+    - @ref ASDK_PWM_ERROR_INVALID_FREQUENCY
+*/
+asdk_errorcode_t asdk_pwm_stage_period_counts(asdk_pwm_channel_t pwm_ch, uint32_t period_counts);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_pwm_commit */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Apply all staged duty cycles and periods. The values are written to the
+  buffer registers of the channels and swapped in by the hardware at the
+  terminal count of each channel, so no period ever mixes old and new
+  values.
+
+  @return
+    - @ref ASDK_PWM_SUCCESS
+
+  @note Channels started together with the same period switch at the same
+  period boundary. Stage and commit at most once per period, a commit
+  whose swap is still pending is overwritten by the next one. Stage and
+  commit from a single context.
+*/
+asdk_errorcode_t asdk_pwm_commit(void);
+
 /** @} */ // end of asdk_pwm_fun_group
 
 #endif /* ASDK_PWM_H */
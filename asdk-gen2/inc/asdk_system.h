@@ -192,6 +192,20 @@ uint32_t asdk_sys_get_core_clock_frequency(void);
 */
 int64_t asdk_sys_get_time_ms(void);
 
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_sys_get_time_us */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Get system up time in microseconds. The time base is a free-running 32-bit
+  counter extended to 64 bits, it interrupts once every 35 minutes. Safe to
+  call from any context including interrupts, it never blocks or disables
+  interrupts.
+
+  @return System up time in micro seconds, 0 when the platform has no system timer.
+*/
+uint64_t asdk_sys_get_time_us(void);
+
 /*----------------------------------------------------------------------------*/
 /* Function : asdk_sys_get_reset_reason */
 /*----------------------------------------------------------------------------*/
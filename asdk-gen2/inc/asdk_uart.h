@@ -40,6 +40,13 @@
 
 ==============================================================================*/
 
+/*! Largest circular RX buffer in DMA mode, two halves of at most 256 bytes */
+#define ASDK_UART_DMA_RX_BUFFER_MAX 512U
+
+/*! DMA descriptors per UART for a TX scatter list, a segment longer than 256
+    bytes takes two of them */
+#define ASDK_UART_DMA_TX_DESCR_MAX 8U
+
 /*==============================================================================
 
                       DEFINITIONS AND TYPES : ENUMS
@@ -179,19 +186,36 @@ typedef struct
  * @brief UART transfer via DMA related config
  *
  * @note:The DMA should be configured for Byte transfer
+ *
+ * With enable_dma the receiver runs continuously into the circular
+ * uart_rx_data_buffer and received bytes are reported by
+ * @ref ASDK_UART_STATUS_RECEIVE_COMPLETE callbacks pointing into it: when
+ * half of the buffer is filled and when the line goes idle, see
+ * @ref asdk_uart_dma_rx_idle_check. The data must be consumed in the callback.
  */
 typedef struct
 {
-    uint8_t uart_dma_rx_channel_no;
-    uint8_t uart_dma_tx_channel_no;
+    uint8_t uart_dma_rx_channel_no; /*!< DMA channel for RX, unused where the platform derives it from the UART */
+    uint8_t uart_dma_tx_channel_no; /*!< DMA channel for TX, unused where the platform derives it from the UART */
 
     uint8_t *uart_tx_data_buffer;
     uint32_t uart_tx_data_len_bytes;
 
-    uint8_t *uart_rx_data_buffer;
-    uint32_t uart_rx_data_len_bytes;
+    uint8_t *uart_rx_data_buffer;    /*!< Circular RX buffer in DMA mode */
+    uint32_t uart_rx_data_len_bytes; /*!< Even, at most @ref ASDK_UART_DMA_RX_BUFFER_MAX */
+
+    bool enable_dma; /*!< Transfer by DMA instead of an interrupt per FIFO level */
 } asdk_uart_dma_config_t;
 
+/*!
+ * @brief One segment of a DMA scatter list, see @ref asdk_uart_write_scatter
+ */
+typedef struct
+{
+    uint8_t *data;     /*!< Data to be sent, must stay valid until transmit complete */
+    uint32_t data_len; /*!< Length of data, 1 to 65536 bytes */
+} asdk_uart_tx_segment_t;
+
 /*!
  * @brief UART Configuration structure
  *
@@ -326,6 +350,7 @@ asdk_errorcode_t asdk_uart_read_blocking(asdk_uart_num_t uart_no, uint8_t *data,
 /*!
   @brief
   This function sends data out through UART module using non-blocking method.
+  In DMA mode it is a scatter list of one segment, see @ref asdk_uart_write_scatter.
 
   @param [in] uart_no ASDK UART number
   @param [in] data Pointer to buffer containing data to be sent.
@@ -344,6 +369,7 @@ asdk_errorcode_t asdk_uart_write_non_blocking(asdk_uart_num_t uart_no, uint8_t *
 /*!
   @brief
   This function receives data from UART module using non-blocking method.
+  Not available in DMA mode, the receiver runs continuously there.
 
   @param [in] uart_no ASDK UART number
   @param [out] data Pointer to buffer containing data received.
@@ -356,6 +382,49 @@ asdk_errorcode_t asdk_uart_write_non_blocking(asdk_uart_num_t uart_no, uint8_t *
 */
 asdk_errorcode_t asdk_uart_read_non_blocking(asdk_uart_num_t uart_no, uint8_t *data, uint32_t data_len);
 
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_uart_write_scatter */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function sends the segments back to back as one DMA transfer, the CPU
+  is interrupted once when the last byte is handed to the UART FIFO. The
+  callback then receives @ref ASDK_UART_STATUS_TRANSMIT_COMPLETE with the
+  first segment and the total length. Requires enable_dma in
+  @ref asdk_uart_dma_config_t.
+
+  @param [in] uart_no ASDK UART number
+  @param [in] segments Scatter list, copied before the function returns.
+  @param [in] segment_count Number of segments.
+
+  @return
+    - @ref ASDK_UART_STATUS_SUCCESS
+    - @ref ASDK_UART_ERROR_RANGE_EXCEEDED
+    - @ref ASDK_UART_ERROR_NULL_PTR
+    - @ref ASDK_UART_ERROR_NOT_INITIALIZED
+    - @ref ASDK_UART_ERROR_INVALID_DMA_CONFIG
+    - @ref ASDK_UART_ERROR_DMA_BUSY
+*/
+asdk_errorcode_t asdk_uart_write_scatter(asdk_uart_num_t uart_no, const asdk_uart_tx_segment_t *segments, uint8_t segment_count);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_uart_dma_rx_idle_check */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function reports the bytes received by DMA when no byte arrived since
+  its previous call. The UART has no idle line interrupt, call it
+  periodically, e.g. every 1 ms, the period is the idle time.
+
+  @param [in] uart_no ASDK UART number
+
+  @return
+    - @ref ASDK_UART_STATUS_SUCCESS
+    - @ref ASDK_UART_ERROR_RANGE_EXCEEDED
+    - @ref ASDK_UART_ERROR_NOT_INITIALIZED
+*/
+asdk_errorcode_t asdk_uart_dma_rx_idle_check(asdk_uart_num_t uart_no);
+
 /** @} */ // end of asdk_uart_fun_group
 
 #endif /* ASDK_UART_H */
\ No newline at end of file
@@ -0,0 +1,196 @@
+/*
+   @file
+   cobs_frame.c
+
+   @path
+   lib/cobs_frame/cobs_frame.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   This file implements COBS framing with CRC-16 for byte streams.
+*/
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#include "cobs_frame.h"
+
+/* a block holds at most 254 data bytes, its code byte is length + 1 */
+#define COBS_BLOCK_MAX 0xFFU
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DECLARATIONS
+
+==============================================================================*/
+
+static void __cobs_frame_reset(cobs_frame_decoder_t *decoder);
+static void __cobs_frame_close(cobs_frame_decoder_t *decoder);
+static void __cobs_frame_put(cobs_frame_decoder_t *decoder, uint8_t byte);
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+/* nibble table, 32 bytes of flash instead of 512 */
+static const uint16_t crc16_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+static void __cobs_frame_reset(cobs_frame_decoder_t *decoder) {
+  decoder->len = 0;
+  decoder->block_left = 0;
+  decoder->zero_pending = false;
+  decoder->discard = false;
+}
+
+static void __cobs_frame_put(cobs_frame_decoder_t *decoder, uint8_t byte) {
+  if (decoder->len >= decoder->size) {
+    decoder->discard = true;
+    return;
+  }
+
+  decoder->buffer[decoder->len++] = byte;
+}
+
+static void __cobs_frame_close(cobs_frame_decoder_t *decoder) {
+  size_t len = decoder->len;
+
+  if (decoder->discard || (0U != decoder->block_left) || (COBS_FRAME_CRC_SIZE > len)) {
+    /* back to back delimiters are idle fill, not errors */
+    if (decoder->discard || (0U != len) || (0U != decoder->block_left)) {
+      decoder->framing_errors++;
+    }
+    return;
+  }
+
+  /* the CRC is appended MSB first, running it over the CRC as well gives 0 */
+  if (0U != cobs_frame_crc16(decoder->buffer, len, 0xFFFFU)) {
+    decoder->crc_errors++;
+    return;
+  }
+
+  decoder->frames++;
+
+  if (NULL != decoder->handler) {
+    decoder->handler(decoder->buffer, len - COBS_FRAME_CRC_SIZE, decoder->arg);
+  }
+}
+
+/*==============================================================================
+
+                            GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+uint16_t cobs_frame_crc16(const uint8_t *data, size_t len, uint16_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc = (uint16_t)((crc << 4) ^ crc16_nibble[(crc >> 12) ^ (data[i] >> 4)]);
+    crc = (uint16_t)((crc << 4) ^ crc16_nibble[(crc >> 12) ^ (data[i] & 0x0FU)]);
+  }
+
+  return crc;
+}
+
+size_t cobs_frame_encode(const uint8_t *payload, size_t len, uint8_t *out, size_t out_size) {
+  uint16_t crc;
+  uint8_t byte;
+  size_t code_idx = 0;
+  size_t out_idx = 1;
+  uint8_t code = 1;
+
+  if ((NULL == out) || ((NULL == payload) && (0U != len)) ||
+      (COBS_FRAME_ENCODED_SIZE(len) > out_size)) {
+    return 0;
+  }
+
+  crc = cobs_frame_crc16(payload, len, 0xFFFFU);
+
+  for (size_t i = 0; i < (len + COBS_FRAME_CRC_SIZE); i++) {
+    if (i < len) {
+      byte = payload[i];
+    } else {
+      byte = (i == len) ? (uint8_t)(crc >> 8) : (uint8_t)crc;
+    }
+
+    if (0U == byte) {
+      out[code_idx] = code;
+      code_idx = out_idx++;
+      code = 1;
+      continue;
+    }
+
+    out[out_idx++] = byte;
+    code++;
+
+    if (COBS_BLOCK_MAX == code) {
+      out[code_idx] = code;
+      code_idx = out_idx++;
+      code = 1;
+    }
+  }
+
+  out[code_idx] = code;
+  out[out_idx++] = COBS_FRAME_DELIMITER;
+
+  return out_idx;
+}
+
+void cobs_frame_decoder_init(cobs_frame_decoder_t *decoder, uint8_t *buffer, size_t size,
+                             cobs_frame_handler_t handler, void *arg) {
+  decoder->buffer = buffer;
+  decoder->size = size;
+  decoder->handler = handler;
+  decoder->arg = arg;
+  decoder->frames = 0;
+  decoder->crc_errors = 0;
+  decoder->framing_errors = 0;
+
+  __cobs_frame_reset(decoder);
+}
+
+void cobs_frame_decode(cobs_frame_decoder_t *decoder, const uint8_t *data, size_t len) {
+  uint8_t byte;
+
+  for (size_t i = 0; i < len; i++) {
+    byte = data[i];
+
+    if (COBS_FRAME_DELIMITER == byte) {
+      __cobs_frame_close(decoder);
+      __cobs_frame_reset(decoder);
+      continue;
+    }
+
+    if (decoder->discard) {
+      continue;
+    }
+
+    if (0U != decoder->block_left) {
+      __cobs_frame_put(decoder, byte);
+      decoder->block_left--;
+      continue;
+    }
+
+    /* code byte of the next block, the previous one ended with a zero */
+    if (decoder->zero_pending) {
+      __cobs_frame_put(decoder, 0);
+    }
+
+    decoder->block_left = (uint8_t)(byte - 1U);
+    decoder->zero_pending = (COBS_BLOCK_MAX != byte);
+  }
+}
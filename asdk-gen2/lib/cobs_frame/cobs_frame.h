@@ -0,0 +1,121 @@
+/*
+   @file
+   cobs_frame.h
+
+   @path
+   lib/cobs_frame/cobs_frame.h
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   COBS framing with a CRC for byte streams like UART links.
+
+   A frame on the wire is COBS(payload, crc_hi, crc_lo) followed by a 0x00
+   delimiter. The CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of
+   the payload. As 0x00 only appears as delimiter, a receiver joining
+   mid-stream or losing bytes resynchronizes on the next frame.
+
+   @example
+   @code
+
+   static uint8_t rx_frame[COBS_FRAME_DECODED_SIZE(32)];
+   static cobs_frame_decoder_t decoder;
+
+   static void on_frame(const uint8_t *payload, size_t len, void *arg)
+   {
+       // complete frame with a valid CRC
+   }
+
+   cobs_frame_decoder_init(&decoder, rx_frame, sizeof(rx_frame), on_frame, NULL);
+
+   // feed received bytes in any chunking
+   cobs_frame_decode(&decoder, data, data_len);
+
+   // sending
+   uint8_t tx_frame[COBS_FRAME_ENCODED_SIZE(32)];
+   size_t tx_len = cobs_frame_encode(payload, payload_len, tx_frame, sizeof(tx_frame));
+
+   @endcode
+*/
+
+#ifndef COBS_FRAME_H
+#define COBS_FRAME_H
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*==============================================================================
+
+                      DEFINITIONS AND TYPES : MACROS
+
+==============================================================================*/
+
+#define COBS_FRAME_DELIMITER 0x00U
+#define COBS_FRAME_CRC_SIZE 2U
+
+/* decoder buffer for payloads up to n bytes, the CRC is decoded into it too */
+#define COBS_FRAME_DECODED_SIZE(n) ((n) + COBS_FRAME_CRC_SIZE)
+
+/* worst case encoded frame: one overhead byte per 254 bytes and the delimiter */
+#define COBS_FRAME_ENCODED_SIZE(n)                                             \
+  (COBS_FRAME_DECODED_SIZE(n) + (COBS_FRAME_DECODED_SIZE(n) / 254U) + 2U)
+
+/*==============================================================================
+
+                   DEFINITIONS AND TYPES : STRUCTURES
+
+==============================================================================*/
+
+/* called for every complete frame with a valid CRC, payload without the CRC */
+typedef void (*cobs_frame_handler_t)(const uint8_t *payload, size_t len, void *arg);
+
+typedef struct {
+  uint8_t *buffer;              /*!< Decoded bytes of the current frame */
+  size_t size;                  /*!< Size of buffer, see COBS_FRAME_DECODED_SIZE */
+  size_t len;                   /*!< Decoded bytes so far */
+  uint8_t block_left;           /*!< Bytes left in the current COBS block */
+  bool zero_pending;            /*!< Current block ends with an encoded zero */
+  bool discard;                 /*!< Frame is broken, skip to the delimiter */
+  cobs_frame_handler_t handler;
+  void *arg;
+
+  uint32_t frames;              /*!< Frames passed to the handler */
+  uint32_t crc_errors;          /*!< Frames dropped for a CRC mismatch */
+  uint32_t framing_errors;      /*!< Frames dropped for broken COBS or size */
+} cobs_frame_decoder_t;
+
+/*==============================================================================
+
+                           FUNCTION PROTOTYPES
+
+==============================================================================*/
+
+/* CRC-16/CCITT-FALSE, pass 0xFFFF to start or the previous result to continue */
+uint16_t cobs_frame_crc16(const uint8_t *data, size_t len, uint16_t crc);
+
+/* Encodes a frame including the delimiter, returns its length or 0 when out
+   is too small. */
+size_t cobs_frame_encode(const uint8_t *payload, size_t len, uint8_t *out, size_t out_size);
+
+void cobs_frame_decoder_init(cobs_frame_decoder_t *decoder, uint8_t *buffer, size_t size,
+                             cobs_frame_handler_t handler, void *arg);
+
+/* Feeds received bytes, calls the handler as soon as a frame closes. Bytes
+   before the first delimiter are treated as a broken frame. */
+void cobs_frame_decode(cobs_frame_decoder_t *decoder, const uint8_t *data, size_t len);
+
+#endif /* COBS_FRAME_H */
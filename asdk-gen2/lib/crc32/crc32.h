@@ -0,0 +1,111 @@
+/*
+   @file
+   crc32.h
+
+   @path
+   lib/crc32/crc32.h
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   CRC-32 (IEEE 802.3, reflected poly 0xEDB88320, as zlib) shared by the
+   image_magic host tool and the firmware.
+
+   Three variants give the same result:
+   - crc32_bitwise: no table, 8 steps per byte, the reference.
+   - crc32_table: one byte per step with a 1 KB table in flash.
+   - crc32_slice8: eight bytes per step with 8 KB of tables built on first
+     use, only compiled with CRC32_SLICE_BY_8 (host builds).
+
+   crc32() picks the fastest one compiled in. All of them continue from a
+   previous result, so an image can be checked in chunks of any size.
+
+   The image footer is what image_magic appends to a binary: the CRC of
+   all bytes in front of it and a 4 character magic.
+
+   @example
+   @code
+
+   // whole buffer
+   uint32_t crc = crc32(data, len, 0);
+
+   // streaming, same result
+   uint32_t crc = 0;
+   while ((n = read_chunk(chunk, sizeof(chunk))) > 0)
+   {
+       crc = crc32(chunk, n, crc);
+   }
+
+   // image followed by its footer, e.g. at boot
+   if (!crc32_footer_check(image_start, image_len, "BBAP"))
+   {
+       // corrupted or not stamped by image_magic
+   }
+
+   @endcode
+*/
+
+#ifndef CRC32_H
+#define CRC32_H
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*==============================================================================
+
+                      DEFINITIONS AND TYPES : MACROS
+
+==============================================================================*/
+
+#define CRC32_POLYNOMIAL 0xEDB88320UL
+
+#define CRC32_FOOTER_MAGIC_SIZE 4U
+
+/*==============================================================================
+
+                   DEFINITIONS AND TYPES : STRUCTURES
+
+==============================================================================*/
+
+/* appended to the image, little endian */
+typedef struct {
+  uint32_t crc;                        /*!< CRC-32 of the image in front of the footer */
+  char magic[CRC32_FOOTER_MAGIC_SIZE]; /*!< Not NUL terminated */
+} crc32_footer_t;
+
+/*==============================================================================
+
+                           FUNCTION PROTOTYPES
+
+==============================================================================*/
+
+/* pass 0 to start or the previous result to continue */
+uint32_t crc32_bitwise(const uint8_t *data, size_t len, uint32_t crc);
+uint32_t crc32_table(const uint8_t *data, size_t len, uint32_t crc);
+
+#ifdef CRC32_SLICE_BY_8
+uint32_t crc32_slice8(const uint8_t *data, size_t len, uint32_t crc);
+#endif
+
+/* fastest variant compiled in */
+uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc);
+
+/* True when the footer behind len bytes of image carries the given magic
+   and the CRC of those bytes. The footer may be unaligned. */
+bool crc32_footer_check(const uint8_t *image, size_t len, const char *magic);
+
+#endif /* CRC32_H */
@@ -0,0 +1,115 @@
+/*
+   @file
+   crc32_bench.c
+
+   @path
+   lib/crc32/crc32_bench.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Host benchmark of the CRC-32 variants in MB/s, built by the crc32_bench
+   target of utils/image_magic. Not part of the firmware.
+
+   usage: crc32_bench [buffer size in KB, default 1024]
+*/
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "crc32.h"
+
+/* each variant runs for at least this long */
+#define BENCH_MIN_SECONDS 0.5
+
+typedef uint32_t (*crc32_fn_t)(const uint8_t *data, size_t len, uint32_t crc);
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+static double __bench_now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static void __bench_run(const char *name, crc32_fn_t fn, const uint8_t *data, size_t len,
+                        uint32_t expected) {
+  double start = __bench_now();
+  double elapsed;
+  uint32_t crc = fn(data, len, 0);
+  size_t rounds = 1;
+
+  if (crc != expected) {
+    printf("%-8s 0x%08x, expected 0x%08x\n", name, (unsigned)crc, (unsigned)expected);
+    exit(1);
+  }
+
+  do {
+    crc = fn(data, len, crc);
+    rounds++;
+    elapsed = __bench_now() - start;
+  } while (elapsed < BENCH_MIN_SECONDS);
+
+  printf("%-8s %9.1f MB/s\n", name, ((double)len * (double)rounds) / (elapsed * 1e6));
+}
+
+/*==============================================================================
+
+                            GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+int main(int argc, char *argv[]) {
+  size_t len = ((argc > 1) ? strtoul(argv[1], NULL, 0) : 1024U) * 1024U;
+  uint8_t *data = malloc(len);
+  uint32_t expected;
+
+  if ((NULL == data) || (0U == len)) {
+    printf("usage: %s [buffer size in KB]\n", argv[0]);
+    return 1;
+  }
+
+  srand(1);
+  for (size_t i = 0; i < len; i++) {
+    data[i] = (uint8_t)rand();
+  }
+
+  /* "123456789" is the standard check value */
+  if (0xCBF43926UL != crc32_bitwise((const uint8_t *)"123456789", 9U, 0)) {
+    printf("check value mismatch\n");
+    return 1;
+  }
+
+  expected = crc32_bitwise(data, len, 0);
+
+  printf("%zu KB buffer\n", len / 1024U);
+  __bench_run("bitwise", crc32_bitwise, data, len, expected);
+  __bench_run("table", crc32_table, data, len, expected);
+#ifdef CRC32_SLICE_BY_8
+  __bench_run("slice8", crc32_slice8, data, len, expected);
+#endif
+
+  free(data);
+  return 0;
+}
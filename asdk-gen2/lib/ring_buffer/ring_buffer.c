@@ -45,12 +45,164 @@ z                                INCLUDE FILES
     return num_of_blocks;                                                      \
   }
 
+/* indices shared between producer and consumer in SPSC mode */
+#define SPSC_LOAD_INDEX(index) (*(volatile size_t *)&(index))
+#define SPSC_STORE_INDEX(index, value) (*(volatile size_t *)&(index) = (value))
+
+#define IS_POWER_OF_TWO(value) (((value) & ((value)-1)) == 0)
+
 /*==============================================================================
 
                             LOCAL FUNCTION DECLARATIONS
 
 ==============================================================================*/
 
+static size_t __ring_buffer_spsc_write(ring_buffer_t *buffer_p, void *data_p,
+                                       size_t num_of_blocks);
+static size_t __ring_buffer_spsc_read(ring_buffer_t *buffer_p, void *data_p,
+                                      size_t num_of_blocks, bool consume);
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+/*******************************************************************************
+ * Function __ring_buffer_spsc_write
+ ****************************************************************************/
+/**
+ *
+ * Lock-free write for single-producer/single-consumer mode. The write index
+ * and read index are free running, the buffer offset is derived by masking
+ * with (total_capacity - 1). Only the producer updates the write index.
+ *
+ *******************************************************************************/
+static size_t __ring_buffer_spsc_write(ring_buffer_t *buffer_p, void *data_p,
+                                       size_t num_of_blocks) {
+  uint8_t *buffer_ptr = (uint8_t *)(buffer_p->buffer);
+  size_t buff_size_bytes = buffer_p->total_capacity;
+  size_t total_num_of_bytes = num_of_blocks * buffer_p->block_size;
+  size_t num_bytes_overwritten = 0;
+  size_t wr_idx;
+  size_t rd_idx;
+  size_t remaining_space;
+  size_t buff_wr_offset;
+  size_t wrap_around_len;
+
+  if ((buffer_ptr == NULL) || (total_num_of_bytes > buff_size_bytes)) {
+    return 0;
+  }
+
+  wr_idx = buffer_p->write_index;
+  rd_idx = SPSC_LOAD_INDEX(buffer_p->read_index);
+
+  /* consumer must be done with the slots before they are reused */
+  ASDK_MEMORY_BARRIER()
+
+  remaining_space = buff_size_bytes - (wr_idx - rd_idx);
+
+  if (remaining_space == 0) {
+    if (buffer_p->event_callback != NULL) {
+      buffer_p->event_callback((ring_buffer *)buffer_p, RING_BUFFER_EVENT_FULL,
+                               &num_bytes_overwritten);
+    }
+    return 0;
+  }
+
+  /* write only as many blocks as will fit */
+  if (total_num_of_bytes > remaining_space) {
+    total_num_of_bytes = remaining_space;
+  }
+
+  buff_wr_offset = wr_idx & (buff_size_bytes - 1);
+  wrap_around_len = CALCULATE_SEGMENT_LENGTH(buff_wr_offset, total_num_of_bytes,
+                                             buff_size_bytes);
+  memcpy(&(buffer_ptr[buff_wr_offset]), data_p, wrap_around_len);
+
+  /* check for wrap around, if it exists write remaining bytes at the start */
+  if (wrap_around_len != total_num_of_bytes) {
+    memcpy(buffer_ptr, (uint8_t *)data_p + wrap_around_len,
+           total_num_of_bytes - wrap_around_len);
+  }
+
+  /* data must be visible before the consumer observes the new index */
+  ASDK_MEMORY_BARRIER()
+
+  SPSC_STORE_INDEX(buffer_p->write_index, wr_idx + total_num_of_bytes);
+
+  if ((total_num_of_bytes == remaining_space) &&
+      (buffer_p->event_callback != NULL)) {
+    buffer_p->event_callback((ring_buffer *)buffer_p, RING_BUFFER_EVENT_FULL,
+                             &num_bytes_overwritten);
+  }
+
+  return (total_num_of_bytes / buffer_p->block_size);
+}
+
+/*******************************************************************************
+ * Function __ring_buffer_spsc_read
+ ****************************************************************************/
+/**
+ *
+ * Lock-free read/peek for single-producer/single-consumer mode. Only the
+ * consumer updates the read index and only when consume is true.
+ *
+ *******************************************************************************/
+static size_t __ring_buffer_spsc_read(ring_buffer_t *buffer_p, void *data_p,
+                                      size_t num_of_blocks, bool consume) {
+  uint8_t *buffer_ptr = (uint8_t *)(buffer_p->buffer);
+  size_t buff_size_bytes = buffer_p->total_capacity;
+  size_t total_num_of_bytes = num_of_blocks * buffer_p->block_size;
+  size_t wr_idx;
+  size_t rd_idx;
+  size_t buff_len;
+  size_t buff_rd_offset;
+  size_t wrap_around_len;
+
+  if (buffer_ptr == NULL) {
+    return 0;
+  }
+
+  rd_idx = buffer_p->read_index;
+  wr_idx = SPSC_LOAD_INDEX(buffer_p->write_index);
+
+  /* data written by the producer must be visible before it is copied */
+  ASDK_MEMORY_BARRIER()
+
+  buff_len = wr_idx - rd_idx;
+
+  /* Buffer is empty */
+  if (buff_len == 0) {
+    return 0;
+  }
+
+  /* read length requested is more than used capacity of the buffer */
+  if (total_num_of_bytes > buff_len) {
+    total_num_of_bytes = buff_len;
+  }
+
+  buff_rd_offset = rd_idx & (buff_size_bytes - 1);
+  wrap_around_len = CALCULATE_SEGMENT_LENGTH(buff_rd_offset, total_num_of_bytes,
+                                             buff_size_bytes);
+  memcpy(data_p, &(buffer_ptr[buff_rd_offset]), wrap_around_len);
+
+  /* check for wrap around, if exists read remaining bytes from the start */
+  if (wrap_around_len != total_num_of_bytes) {
+    memcpy((uint8_t *)data_p + wrap_around_len, buffer_ptr,
+           total_num_of_bytes - wrap_around_len);
+  }
+
+  if (consume) {
+    /* copy must complete before the producer may reuse the slots */
+    ASDK_MEMORY_BARRIER()
+
+    SPSC_STORE_INDEX(buffer_p->read_index, rd_idx + total_num_of_bytes);
+  }
+
+  return (total_num_of_bytes / buffer_p->block_size);
+}
+
 /*==============================================================================
 
                             GLOBAL FUNCTION DEFINITIONS
@@ -85,6 +237,22 @@ ring_buffer_error_t ring_buffer_init(ring_buffer_t *buffer_p) {
     return RING_BUFFER_ERROR_INVALID_LEN;
   }
 
+  if (buffer_p->mode > RING_BUFFER_MODE_MAX) {
+    return RING_BUFFER_ERROR_INVALID_MODE;
+  }
+
+  if (buffer_p->mode == RING_BUFFER_MODE_SPSC) {
+    /* free running indices are masked, capacity must be a power of two */
+    if (!IS_POWER_OF_TWO(buffer_p->total_capacity)) {
+      return RING_BUFFER_ERROR_INVALID_LEN;
+    }
+
+    /* overwrite would require the producer to move the read index */
+    if (buffer_p->enable_overwrite) {
+      return RING_BUFFER_ERROR_INVALID_MODE;
+    }
+  }
+
   ASDK_ENTER_CRITICAL_SECTION()
 
   buffer_p->read_index = 0;
@@ -125,6 +293,10 @@ size_t ring_buffer_write(ring_buffer_t *buffer_p, void *data_p,
     return 0;
   }
 
+  if (buffer_p->mode == RING_BUFFER_MODE_SPSC) {
+    return __ring_buffer_spsc_write(buffer_p, data_p, num_of_blocks);
+  }
+
   /* Enter critical section */
   ASDK_ENTER_CRITICAL_SECTION()
 
@@ -258,6 +430,10 @@ size_t ring_buffer_read(ring_buffer_t *buffer_p, void *data_p,
     return 0;
   }
 
+  if (buffer_p->mode == RING_BUFFER_MODE_SPSC) {
+    return __ring_buffer_spsc_read(buffer_p, data_p, num_of_blocks, true);
+  }
+
   /* Enter critical section */
   ASDK_ENTER_CRITICAL_SECTION()
 
@@ -348,6 +524,10 @@ size_t ring_buffer_peek(ring_buffer_t *buffer_p, void *data_p,
     return 0;
   }
 
+  if (buffer_p->mode == RING_BUFFER_MODE_SPSC) {
+    return __ring_buffer_spsc_read(buffer_p, data_p, num_of_blocks, false);
+  }
+
   /* Enter critical section */
   ASDK_ENTER_CRITICAL_SECTION()
 
@@ -413,7 +593,7 @@ size_t ring_buffer_peek(ring_buffer_t *buffer_p, void *data_p,
  *
  *******************************************************************************/
 bool ring_buffer_is_empty(ring_buffer_t *buffer_p) {
-  return (buffer_p->used_capacity == 0);
+  return (ring_buffer_get_used_capacity(buffer_p) == 0);
 }
 
 /*******************************************************************************
@@ -425,5 +605,159 @@ bool ring_buffer_is_empty(ring_buffer_t *buffer_p) {
  *
  *******************************************************************************/
 bool ring_buffer_is_full(ring_buffer_t *buffer_p) {
-  return (buffer_p->used_capacity == buffer_p->total_capacity);
+  return (ring_buffer_get_used_capacity(buffer_p) == buffer_p->total_capacity);
+}
+
+/*******************************************************************************
+ * Function ring_buffer_get_used_capacity
+ ****************************************************************************/
+/**
+ *
+ * Function to get the number of bytes held in the ring buffer.
+ *
+ *******************************************************************************/
+size_t ring_buffer_get_used_capacity(ring_buffer_t *buffer_p) {
+  if (buffer_p->mode == RING_BUFFER_MODE_SPSC) {
+    return (SPSC_LOAD_INDEX(buffer_p->write_index) -
+            SPSC_LOAD_INDEX(buffer_p->read_index));
+  }
+
+  return buffer_p->used_capacity;
+}
+
+/*******************************************************************************
+ * Function ring_buffer_claim_write
+ ****************************************************************************/
+/**
+ *
+ * Reserve contiguous free blocks for in-place writing (SPSC mode only).
+ *
+ *******************************************************************************/
+void *ring_buffer_claim_write(ring_buffer_t *buffer_p, size_t *num_of_blocks) {
+  size_t buff_size_bytes;
+  size_t wr_idx;
+  size_t buff_wr_offset;
+  size_t contiguous_len;
+
+  if ((buffer_p == NULL) || (num_of_blocks == NULL) ||
+      (buffer_p->buffer == NULL) ||
+      (buffer_p->mode != RING_BUFFER_MODE_SPSC)) {
+    return NULL;
+  }
+
+  buff_size_bytes = buffer_p->total_capacity;
+  wr_idx = buffer_p->write_index;
+
+  /* free space = capacity - used, limited to the end of the buffer */
+  contiguous_len =
+      buff_size_bytes - (wr_idx - SPSC_LOAD_INDEX(buffer_p->read_index));
+
+  /* consumer must be done with the slots before they are handed out */
+  ASDK_MEMORY_BARRIER()
+
+  buff_wr_offset = wr_idx & (buff_size_bytes - 1);
+  if (contiguous_len > (buff_size_bytes - buff_wr_offset)) {
+    contiguous_len = buff_size_bytes - buff_wr_offset;
+  }
+
+  if (*num_of_blocks > (contiguous_len / buffer_p->block_size)) {
+    *num_of_blocks = contiguous_len / buffer_p->block_size;
+  }
+
+  if (*num_of_blocks == 0) {
+    return NULL;
+  }
+
+  return &(((uint8_t *)buffer_p->buffer)[buff_wr_offset]);
+}
+
+/*******************************************************************************
+ * Function ring_buffer_commit_write
+ ****************************************************************************/
+/**
+ *
+ * Publish blocks reserved by ring_buffer_claim_write (SPSC mode only).
+ *
+ *******************************************************************************/
+size_t ring_buffer_commit_write(ring_buffer_t *buffer_p, size_t num_of_blocks) {
+  if ((buffer_p == NULL) || (buffer_p->mode != RING_BUFFER_MODE_SPSC)) {
+    return 0;
+  }
+
+  /* data must be visible before the consumer observes the new index */
+  ASDK_MEMORY_BARRIER()
+
+  SPSC_STORE_INDEX(buffer_p->write_index,
+                   buffer_p->write_index +
+                       (num_of_blocks * buffer_p->block_size));
+
+  return num_of_blocks;
+}
+
+/*******************************************************************************
+ * Function ring_buffer_claim_read
+ ****************************************************************************/
+/**
+ *
+ * Get in-place access to the oldest contiguous blocks (SPSC mode only).
+ *
+ *******************************************************************************/
+void *ring_buffer_claim_read(ring_buffer_t *buffer_p, size_t *num_of_blocks) {
+  size_t buff_size_bytes;
+  size_t rd_idx;
+  size_t buff_rd_offset;
+  size_t contiguous_len;
+
+  if ((buffer_p == NULL) || (num_of_blocks == NULL) ||
+      (buffer_p->buffer == NULL) ||
+      (buffer_p->mode != RING_BUFFER_MODE_SPSC)) {
+    return NULL;
+  }
+
+  buff_size_bytes = buffer_p->total_capacity;
+  rd_idx = buffer_p->read_index;
+
+  /* used space, limited to the end of the buffer */
+  contiguous_len = SPSC_LOAD_INDEX(buffer_p->write_index) - rd_idx;
+
+  /* data written by the producer must be visible before it is accessed */
+  ASDK_MEMORY_BARRIER()
+
+  buff_rd_offset = rd_idx & (buff_size_bytes - 1);
+  if (contiguous_len > (buff_size_bytes - buff_rd_offset)) {
+    contiguous_len = buff_size_bytes - buff_rd_offset;
+  }
+
+  if (*num_of_blocks > (contiguous_len / buffer_p->block_size)) {
+    *num_of_blocks = contiguous_len / buffer_p->block_size;
+  }
+
+  if (*num_of_blocks == 0) {
+    return NULL;
+  }
+
+  return &(((uint8_t *)buffer_p->buffer)[buff_rd_offset]);
+}
+
+/*******************************************************************************
+ * Function ring_buffer_release_read
+ ****************************************************************************/
+/**
+ *
+ * Release blocks obtained by ring_buffer_claim_read (SPSC mode only).
+ *
+ *******************************************************************************/
+size_t ring_buffer_release_read(ring_buffer_t *buffer_p, size_t num_of_blocks) {
+  if ((buffer_p == NULL) || (buffer_p->mode != RING_BUFFER_MODE_SPSC)) {
+    return 0;
+  }
+
+  /* accesses to the slots must complete before the producer reuses them */
+  ASDK_MEMORY_BARRIER()
+
+  SPSC_STORE_INDEX(buffer_p->read_index,
+                   buffer_p->read_index +
+                       (num_of_blocks * buffer_p->block_size));
+
+  return num_of_blocks;
 }
@@ -62,9 +62,14 @@
       .read_index = 0,
       .used_capacity = 0,
       .enable_overwrite = false,
+      .mode = RING_BUFFER_MODE_LOCKED,
       .event_callback = ring_buffer_event_callback,
   };
 
+  // For an ISR producer and a main loop consumer use the lock-free mode,
+  // the buffer size must then be a power of two (e.g. 16 bytes).
+  // ring_buffer.mode = RING_BUFFER_MODE_SPSC;
+
   ring_buffer_error_t error;
 
   uint8_t wr_data[5] = {1,2,3,4,5};
@@ -125,10 +130,28 @@ typedef enum {
   RING_BUFFER_SUCCESS,
   RING_BUFFER_ERROR_INVALID_PTR,
   RING_BUFFER_ERROR_INVALID_LEN,
+  RING_BUFFER_ERROR_INVALID_MODE,
 
-  RING_BUFFER_ERROR_MAX = RING_BUFFER_ERROR_INVALID_LEN,
+  RING_BUFFER_ERROR_MAX = RING_BUFFER_ERROR_INVALID_MODE,
 } ring_buffer_error_t;
 
+/*!
+ * @brief An enumerator to represent the concurrency mode of the ring buffer.
+ *
+ * @note In @ref RING_BUFFER_MODE_SPSC the buffer must have exactly one
+ * producer context (calling @ref ring_buffer_write) and exactly one consumer
+ * context (calling @ref ring_buffer_read and @ref ring_buffer_peek). The
+ * total capacity must be a power of two and overwrite is not supported.
+ */
+typedef enum {
+  RING_BUFFER_MODE_LOCKED = 0, /*!< Every access is guarded by a critical
+                                    section (default) */
+  RING_BUFFER_MODE_SPSC,       /*!< Lock-free single-producer/single-consumer
+                                    access using memory barriers */
+
+  RING_BUFFER_MODE_MAX = RING_BUFFER_MODE_SPSC,
+} ring_buffer_mode_t;
+
 /*!
  * @brief An enumerator to represent the possible events.
  */
@@ -196,11 +219,16 @@ typedef struct {
   size_t block_size;     /*!< Size of the block to be read/written in bytes */
   size_t write_index;   /*!< Index of the buffer at which enqueue can be done */
   size_t read_index;    /*!< Index of the buffer at which dequeue can be done */
-  size_t used_capacity; /*!< Used capacity of the buffer */
+  size_t used_capacity; /*!< Used capacity of the buffer, not maintained in
+                             @ref RING_BUFFER_MODE_SPSC, use
+                             @ref ring_buffer_get_used_capacity instead */
 
   bool enable_overwrite; /*!< if true, buffer write when buffer is full will
                               overwrite into oldest element of buffer. */
 
+  ring_buffer_mode_t mode; /*!< Concurrency mode, refer
+                                @ref ring_buffer_mode_t */
+
   ring_buffer_event_callback_t
       event_callback; /*!< Callback to the user for buffer full/overwrite
                               event */
@@ -320,6 +348,89 @@ bool ring_buffer_is_empty(ring_buffer_t *buffer_p);
 */
 bool ring_buffer_is_full(ring_buffer_t *buffer_p);
 
+/*----------------------------------------------------------------------------*/
+/* Function : ring_buffer_get_used_capacity */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Get the number of bytes currently held in the buffer.
+
+  @param [in] buffer_p Pointer to ring buffer.
+
+  @return size_t Used capacity of the buffer in bytes
+*/
+size_t ring_buffer_get_used_capacity(ring_buffer_t *buffer_p);
+
+/*----------------------------------------------------------------------------*/
+/* Function : ring_buffer_claim_write */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Reserve contiguous free blocks for in-place writing by the producer. The
+  blocks become visible to the consumer only after
+  @ref ring_buffer_commit_write. Supported only in @ref RING_BUFFER_MODE_SPSC.
+
+  @param [in] buffer_p Pointer to ring buffer.
+
+  @param [in,out] num_of_blocks Number of blocks requested, updated with the
+  number of contiguous blocks available at the returned address.
+
+  @return void* Address of the first reserved block, NULL if the buffer is
+  full or the mode is not supported
+*/
+void *ring_buffer_claim_write(ring_buffer_t *buffer_p, size_t *num_of_blocks);
+
+/*----------------------------------------------------------------------------*/
+/* Function : ring_buffer_commit_write */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Publish blocks previously reserved with @ref ring_buffer_claim_write.
+
+  @param [in] buffer_p Pointer to ring buffer.
+
+  @param [in] num_of_blocks Number of blocks to be published, must not exceed
+  the number of blocks claimed.
+
+  @return size_t Number of Blocks published
+*/
+size_t ring_buffer_commit_write(ring_buffer_t *buffer_p, size_t num_of_blocks);
+
+/*----------------------------------------------------------------------------*/
+/* Function : ring_buffer_claim_read */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Get in-place access to the oldest contiguous blocks for the consumer. The
+  blocks remain owned by the consumer until @ref ring_buffer_release_read.
+  Supported only in @ref RING_BUFFER_MODE_SPSC.
+
+  @param [in] buffer_p Pointer to ring buffer.
+
+  @param [in,out] num_of_blocks Number of blocks requested, updated with the
+  number of contiguous blocks available at the returned address.
+
+  @return void* Address of the oldest block, NULL if the buffer is empty or
+  the mode is not supported
+*/
+void *ring_buffer_claim_read(ring_buffer_t *buffer_p, size_t *num_of_blocks);
+
+/*----------------------------------------------------------------------------*/
+/* Function : ring_buffer_release_read */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Return blocks obtained with @ref ring_buffer_claim_read to the producer.
+
+  @param [in] buffer_p Pointer to ring buffer.
+
+  @param [in] num_of_blocks Number of blocks to be released, must not exceed
+  the number of blocks claimed.
+
+  @return size_t Number of Blocks released
+*/
+size_t ring_buffer_release_read(ring_buffer_t *buffer_p, size_t num_of_blocks);
+
 /** @} */ // end of ring_buffer_fun_group
 
 #endif /* RING_BUFFER_H */
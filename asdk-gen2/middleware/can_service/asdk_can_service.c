@@ -44,6 +44,7 @@
 
 #include "asdk_can.h"
 #include "asdk_platform.h"
+#include "asdk_system.h"
 
 /* sdk includes ****************************** */
 
@@ -53,7 +54,8 @@
 
 ==============================================================================*/
 
-#define MAX_POOL_SIZE 40
+/* must be a power of two for the lock-free (SPSC) ring buffers */
+#define MAX_POOL_SIZE 64
 #define MAX_STD_CANID 0x7FF
 
 /*==============================================================================
@@ -68,6 +70,42 @@
 
 ==============================================================================*/
 
+/* transmit queue element, wait time is measured from enqueue to hand-off */
+typedef struct
+{
+    asdk_can_frame_t frame;
+    uint32_t enqueue_time_ms;
+    uint32_t sequence; /* keeps equal CAN IDs in order in the priority queue */
+    uint8_t reserved[8]; /* pads to 32 bytes, the SPSC ring needs a power of two capacity */
+} asdk_can_service_tx_entry_t;
+
+_Static_assert((sizeof(asdk_can_service_tx_entry_t) & (sizeof(asdk_can_service_tx_entry_t) - 1U)) == 0U,
+               "tx entry size must be a power of two");
+
+/* periodic scheduler message, data holds the latest update */
+typedef struct
+{
+    asdk_can_service_periodic_config_t config;
+    uint8_t can_ch;
+    uint8_t dlc;
+    uint8_t data[8];
+    uint8_t sent_dlc;
+    uint8_t sent_data[8]; /* payload of the last sent frame */
+    bool valid;   /* updated at least once */
+    bool changed; /* differs from the last sent frame */
+    bool pending; /* updated since the last sent frame */
+    bool sent_once;
+    uint32_t last_sent_ms;
+    uint32_t next_cycle_ms; /* next cyclic send, on the grid of the first send */
+} asdk_can_service_periodic_t;
+
+/* receive handler, chained when several channels register the same CAN ID */
+typedef struct
+{
+    asdk_can_service_rx_handler_t handler;
+    uint8_t can_ch;
+    uint8_t next; /* 1-based index of the next handler, 0 ends the chain */
+} asdk_can_service_rx_dispatch_t;
 
 /*==============================================================================
 
@@ -75,6 +113,17 @@
 
 ==============================================================================*/
 
+static asdk_can_frame_t *__asdk_can_service_rx_claim(uint8_t can_ch);
+static void __asdk_can_service_rx_commit(uint8_t can_ch);
+
+static inline bool __asdk_can_service_tx_before(const asdk_can_service_tx_entry_t *a, const asdk_can_service_tx_entry_t *b);
+static void __asdk_can_service_heap_push(uint8_t can_ch, const asdk_can_service_tx_entry_t *entry);
+static void __asdk_can_service_heap_pop(uint8_t can_ch, asdk_can_service_tx_entry_t *entry);
+static bool __asdk_can_service_tx_dequeue(uint8_t can_ch, asdk_can_service_tx_entry_t *entry);
+static void __asdk_can_service_record_wait(uint8_t can_ch, uint32_t can_id, uint32_t wait_ms);
+static bool __asdk_can_service_periodic_due(const asdk_can_service_periodic_t *periodic, uint32_t now_ms);
+static inline asdk_can_service_rx_handler_t __asdk_can_service_find_rx_handler(uint8_t can_ch, uint32_t can_id);
+
 /*==============================================================================
 
                         LOCAL AND EXTERNAL DEFINITIONS
@@ -86,13 +135,32 @@
 /* global variables ************************** */
 
 /* static variables ************************** */
-static asdk_can_frame_t can_message_tx[ASDK_CAN_MODULE_CAN_CH_MAX][MAX_POOL_SIZE] = {0};
+/* backs the tx ring buffer in FIFO order, or the binary heap in ID priority order */
+static asdk_can_service_tx_entry_t can_message_tx[ASDK_CAN_MODULE_CAN_CH_MAX][MAX_POOL_SIZE] = {0};
 static asdk_can_frame_t can_message_rx[ASDK_CAN_MODULE_CAN_CH_MAX][MAX_POOL_SIZE] = {0};
 
 static ring_buffer_t can_tx_buffer[ASDK_CAN_MODULE_CAN_CH_MAX] = {0};
 static ring_buffer_t can_rx_buffer[ASDK_CAN_MODULE_CAN_CH_MAX] = {0};
 
 static asdk_can_callback_t service_user_callback = NULL;
+static asdk_can_service_rx_notify_t service_rx_notify = NULL;
+
+static volatile asdk_can_service_stats_t can_service_stats[ASDK_CAN_MODULE_CAN_CH_MAX] = {0};
+
+static asdk_can_service_tx_order_t can_tx_order[ASDK_CAN_MODULE_CAN_CH_MAX] = {0};
+static uint32_t can_tx_heap_count[ASDK_CAN_MODULE_CAN_CH_MAX] = {0};
+static uint32_t can_tx_sequence[ASDK_CAN_MODULE_CAN_CH_MAX] = {0};
+
+static asdk_can_service_wait_stats_t can_wait_stats[ASDK_CAN_MODULE_CAN_CH_MAX][ASDK_CAN_SERVICE_WAIT_STATS_MAX] = {0};
+static uint32_t can_wait_stats_count[ASDK_CAN_MODULE_CAN_CH_MAX] = {0};
+
+static asdk_can_service_periodic_t can_periodic[ASDK_CAN_SERVICE_PERIODIC_MAX] = {0};
+static uint8_t can_periodic_count = 0;
+
+/* direct-indexed over the 11-bit ID space, holds 1-based index into can_rx_handlers */
+static uint8_t can_rx_dispatch[MAX_STD_CANID + 1] = {0};
+static asdk_can_service_rx_dispatch_t can_rx_handlers[ASDK_CAN_SERVICE_RX_HANDLER_MAX] = {0};
+static uint8_t can_rx_handler_count = 0;
 
 /*==============================================================================
 
@@ -101,20 +169,246 @@ static asdk_can_callback_t service_user_callback = NULL;
 ==============================================================================*/
 
 /* static functions ************************** */
+
+/* rx pool slot handlers, called by the DAL from interrupt context */
+static asdk_can_frame_t *__asdk_can_service_rx_claim(uint8_t can_ch)
+{
+    size_t num_slots = 1;
+    asdk_can_frame_t *rx_slot = NULL;
+
+    rx_slot = (asdk_can_frame_t *)ring_buffer_claim_write(&(can_rx_buffer[can_ch]), &num_slots);
+
+    if (NULL == rx_slot)
+    {
+        can_service_stats[can_ch].rx_drop_count++;
+    }
+
+    return rx_slot;
+}
+
+static void __asdk_can_service_rx_commit(uint8_t can_ch)
+{
+    uint32_t used_slots;
+
+    ring_buffer_commit_write(&(can_rx_buffer[can_ch]), 1);
+
+    used_slots = ring_buffer_get_used_capacity(&(can_rx_buffer[can_ch])) / sizeof(asdk_can_frame_t);
+
+    if (can_service_stats[can_ch].rx_high_water_mark < used_slots)
+    {
+        can_service_stats[can_ch].rx_high_water_mark = used_slots;
+    }
+
+    if (NULL != service_rx_notify)
+    {
+        service_rx_notify(can_ch);
+    }
+}
+
+/* tx priority queue, a binary min-heap ordered by CAN ID then sequence */
+static inline bool __asdk_can_service_tx_before(const asdk_can_service_tx_entry_t *a, const asdk_can_service_tx_entry_t *b)
+{
+    if (a->frame.can_id != b->frame.can_id)
+    {
+        return (a->frame.can_id < b->frame.can_id);
+    }
+
+    return ((int32_t)(a->sequence - b->sequence) < 0);
+}
+
+static void __asdk_can_service_heap_push(uint8_t can_ch, const asdk_can_service_tx_entry_t *entry)
+{
+    asdk_can_service_tx_entry_t *heap = can_message_tx[can_ch];
+    uint32_t child = can_tx_heap_count[can_ch]++;
+    uint32_t parent;
+
+    /* move parents down until the new entry fits */
+    while (child > 0)
+    {
+        parent = (child - 1) / 2;
+
+        if (!__asdk_can_service_tx_before(entry, &heap[parent]))
+        {
+            break;
+        }
+
+        heap[child] = heap[parent];
+        child = parent;
+    }
+
+    heap[child] = *entry;
+}
+
+static void __asdk_can_service_heap_pop(uint8_t can_ch, asdk_can_service_tx_entry_t *entry)
+{
+    asdk_can_service_tx_entry_t *heap = can_message_tx[can_ch];
+    uint32_t count = --can_tx_heap_count[can_ch];
+    uint32_t parent = 0;
+    uint32_t child;
+
+    *entry = heap[0];
+
+    /* re-insert the last entry from the root downwards */
+    while ((child = (2 * parent) + 1) < count)
+    {
+        if (((child + 1) < count) && __asdk_can_service_tx_before(&heap[child + 1], &heap[child]))
+        {
+            child++;
+        }
+
+        if (!__asdk_can_service_tx_before(&heap[child], &heap[count]))
+        {
+            break;
+        }
+
+        heap[parent] = heap[child];
+        parent = child;
+    }
+
+    heap[parent] = heap[count];
+}
+
+static bool __asdk_can_service_tx_dequeue(uint8_t can_ch, asdk_can_service_tx_entry_t *entry)
+{
+    bool dequeued = false;
+    size_t num_slots = 1;
+    asdk_can_service_tx_entry_t *tx_slot = NULL;
+
+    if (ASDK_CAN_SERVICE_TX_ORDER_ID_PRIORITY == can_tx_order[can_ch])
+    {
+        ASDK_ENTER_CRITICAL_SECTION()
+        if (0 != can_tx_heap_count[can_ch])
+        {
+            __asdk_can_service_heap_pop(can_ch, entry);
+            dequeued = true;
+        }
+        ASDK_EXIT_CRITICAL_SECTION()
+    }
+    else
+    {
+        tx_slot = (asdk_can_service_tx_entry_t *)ring_buffer_claim_read(&(can_tx_buffer[can_ch]), &num_slots);
+
+        if (NULL != tx_slot)
+        {
+            *entry = *tx_slot;
+            ring_buffer_release_read(&(can_tx_buffer[can_ch]), 1);
+            dequeued = true;
+        }
+    }
+
+    return dequeued;
+}
+
+static void __asdk_can_service_record_wait(uint8_t can_ch, uint32_t can_id, uint32_t wait_ms)
+{
+    asdk_can_service_wait_stats_t *wait_stats = NULL;
+    uint32_t i;
+
+    for (i = 0; i < can_wait_stats_count[can_ch]; i++)
+    {
+        if (can_wait_stats[can_ch][i].can_id == can_id)
+        {
+            wait_stats = &can_wait_stats[can_ch][i];
+            break;
+        }
+    }
+
+    if (NULL == wait_stats)
+    {
+        // table full, CAN ID is not tracked
+        if (ASDK_CAN_SERVICE_WAIT_STATS_MAX <= can_wait_stats_count[can_ch])
+        {
+            return;
+        }
+
+        wait_stats = &can_wait_stats[can_ch][can_wait_stats_count[can_ch]++];
+        wait_stats->can_id = can_id;
+        wait_stats->frame_count = 0;
+        wait_stats->max_wait_ms = 0;
+        wait_stats->total_wait_ms = 0;
+    }
+
+    wait_stats->frame_count++;
+    wait_stats->total_wait_ms += wait_ms;
+
+    if (wait_stats->max_wait_ms < wait_ms)
+    {
+        wait_stats->max_wait_ms = wait_ms;
+    }
+}
+
+static bool __asdk_can_service_periodic_due(const asdk_can_service_periodic_t *periodic, uint32_t now_ms)
+{
+    uint32_t elapsed_ms = now_ms - periodic->last_sent_ms;
+
+    if (!periodic->valid)
+    {
+        return false;
+    }
+
+    if (!periodic->sent_once)
+    {
+        return true;
+    }
+
+    if (periodic->config.send_on_change && periodic->changed &&
+        (elapsed_ms >= periodic->config.min_interval_ms))
+    {
+        return true;
+    }
+
+    return ((0 != periodic->config.cycle_time_ms) &&
+            (0 <= (int32_t)(now_ms - periodic->next_cycle_ms)));
+}
+
+static inline asdk_can_service_rx_handler_t __asdk_can_service_find_rx_handler(uint8_t can_ch, uint32_t can_id)
+{
+    uint8_t index;
+
+    if (MAX_STD_CANID < can_id)
+    {
+        return NULL;
+    }
+
+    for (index = can_rx_dispatch[can_id]; 0 != index; index = can_rx_handlers[index - 1].next)
+    {
+        if (can_rx_handlers[index - 1].can_ch == can_ch)
+        {
+            return can_rx_handlers[index - 1].handler;
+        }
+    }
+
+    return NULL;
+}
+
+static inline bool __asdk_can_service_budget_expired(int64_t start_time_ms, uint32_t time_budget_ms)
+{
+    /* zero budget means no time limit */
+    if (0 == time_budget_ms)
+    {
+        return false;
+    }
+
+    return ((asdk_sys_get_time_ms() - start_time_ms) >= (int64_t)time_budget_ms);
+}
+
 void __asdk_can_service_callback_handler(uint8_t can_ch, asdk_can_event_t event, asdk_can_message_t *message)
 {
-    asdk_can_frame_t can_data;
+    asdk_can_frame_t *rx_slot = NULL;
+
     switch (event)
     {
-    /* service rx event */
+    /* service rx event, reported only when the DAL does not fill the slots */
     case ASDK_CAN_RX_EVENT:
-        ASDK_ENTER_CRITICAL_SECTION()
-        can_data.can_id = message->can_id;
-        can_data.dlc = message->dlc;
-        memcpy(can_data.message, message->message, message->dlc);
-        ASDK_EXIT_CRITICAL_SECTION()
+        rx_slot = __asdk_can_service_rx_claim(can_ch);
 
-        ring_buffer_write(&(can_rx_buffer[can_ch]), (uint8_t *)&can_data, 1);
+        if (NULL != rx_slot)
+        {
+            rx_slot->can_id = message->can_id;
+            rx_slot->dlc = message->dlc;
+            memcpy(rx_slot->message, message->message, message->dlc);
+            __asdk_can_service_rx_commit(can_ch);
+        }
         break;
 
     // propogate transmit complete event
@@ -160,19 +454,29 @@ asdk_errorcode_t asdk_can_service_init(uint8_t can_ch, asdk_can_config_t can_con
 
     can_tx_buffer[can_ch].buffer = (uint8_t *)&(can_message_tx[can_ch]);
     can_tx_buffer[can_ch].total_capacity = sizeof(can_message_tx[can_ch]);
-    can_tx_buffer[can_ch].block_size = sizeof(asdk_can_frame_t);
+    can_tx_buffer[can_ch].block_size = sizeof(asdk_can_service_tx_entry_t);
     can_tx_buffer[can_ch].enable_overwrite = false;
+    can_tx_buffer[can_ch].mode = RING_BUFFER_MODE_SPSC;
     can_tx_buffer[can_ch].event_callback = (ring_buffer_event_callback_t)NULL;
 
-    ring_buffer_init(&(can_tx_buffer[can_ch]));
+    if (RING_BUFFER_SUCCESS != ring_buffer_init(&(can_tx_buffer[can_ch])))
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_BUFFER_INIT;
+    }
+
+    can_tx_heap_count[can_ch] = 0;
 
     can_rx_buffer[can_ch].buffer = (uint8_t *)&(can_message_rx[can_ch]);
     can_rx_buffer[can_ch].total_capacity = sizeof(can_message_rx[can_ch]);
     can_rx_buffer[can_ch].block_size = sizeof(asdk_can_frame_t);
     can_rx_buffer[can_ch].enable_overwrite = false;
+    can_rx_buffer[can_ch].mode = RING_BUFFER_MODE_SPSC;
     can_rx_buffer[can_ch].event_callback = (ring_buffer_event_callback_t)NULL;
 
-    ring_buffer_init(&(can_rx_buffer[can_ch]));
+    if (RING_BUFFER_SUCCESS != ring_buffer_init(&(can_rx_buffer[can_ch])))
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_BUFFER_INIT;
+    }
 
     return service_init_status;
 }
@@ -203,33 +507,77 @@ asdk_errorcode_t asdk_can_service_install_callback(asdk_can_callback_t user_call
         return assign_cb_status;
     }
 
+    /* receive frames in-place into the rx pool */
+
+    assign_cb_status = asdk_can_install_rx_slot_handler(&__asdk_can_service_rx_claim, &__asdk_can_service_rx_commit);
+
     return assign_cb_status;
 }
 
+asdk_errorcode_t asdk_can_service_install_rx_notify(asdk_can_service_rx_notify_t rx_notify)
+{
+    if (NULL == rx_notify)
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_NULL_PTR;
+    }
+
+    service_rx_notify = rx_notify;
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
 asdk_errorcode_t asdk_can_service_send(uint8_t can_ch, asdk_can_message_t *msg)
 {
     asdk_errorcode_t service_send_status = ASDK_MW_CAN_SERVICE_SUCCESS;
-    uint32_t num_blocks;
-    asdk_can_frame_t can_data;
+    uint32_t num_blocks = 0;
+    size_t num_slots = 1;
+    asdk_can_service_tx_entry_t tx_entry;
+    asdk_can_service_tx_entry_t *tx_slot = NULL;
 
     if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
     {
         return ASDK_CAN_ERROR_INVALID_CHANNEL;
     }
 
-    /* push packet to transmit  queue */
-    ASDK_ENTER_CRITICAL_SECTION()
-    can_data.can_id = msg->can_id;
-    can_data.dlc = msg->dlc;
-    memcpy(can_data.message, msg->message, msg->dlc);
-    ASDK_EXIT_CRITICAL_SECTION()
+    tx_entry.frame.can_id = msg->can_id;
+    tx_entry.frame.dlc = msg->dlc;
+    memcpy(tx_entry.frame.message, msg->message, msg->dlc);
+    tx_entry.enqueue_time_ms = (uint32_t)asdk_sys_get_time_ms();
 
-    num_blocks = ring_buffer_write(&(can_tx_buffer[can_ch]), (uint8_t *)&can_data, 1);
+    /* push packet to transmit queue */
+    if (ASDK_CAN_SERVICE_TX_ORDER_ID_PRIORITY == can_tx_order[can_ch])
+    {
+        ASDK_ENTER_CRITICAL_SECTION()
+        if (MAX_POOL_SIZE > can_tx_heap_count[can_ch])
+        {
+            tx_entry.sequence = can_tx_sequence[can_ch]++;
+            __asdk_can_service_heap_push(can_ch, &tx_entry);
+            num_blocks = can_tx_heap_count[can_ch];
+        }
+        ASDK_EXIT_CRITICAL_SECTION()
+    }
+    else
+    {
+        tx_slot = (asdk_can_service_tx_entry_t *)ring_buffer_claim_write(&(can_tx_buffer[can_ch]), &num_slots);
+
+        if (NULL != tx_slot)
+        {
+            *tx_slot = tx_entry;
+            ring_buffer_commit_write(&(can_tx_buffer[can_ch]), 1);
+            num_blocks = ring_buffer_get_used_capacity(&(can_tx_buffer[can_ch])) / sizeof(asdk_can_service_tx_entry_t);
+        }
+    }
 
     if (num_blocks == 0) {
+        can_service_stats[can_ch].tx_drop_count++;
         return ASDK_MW_CAN_SERVICE_TX_QUEUE_FULL;
     }
 
+    if (can_service_stats[can_ch].tx_high_water_mark < num_blocks)
+    {
+        can_service_stats[can_ch].tx_high_water_mark = num_blocks;
+    }
+
     return service_send_status;
 }
 
@@ -237,11 +585,12 @@ asdk_errorcode_t asdk_can_service_send_iteration(uint8_t can_ch)
 {
     asdk_errorcode_t service_send_iteration_status = ASDK_MW_CAN_SERVICE_SUCCESS;
     bool tx_status_busy = false;
-    asdk_can_frame_t can_data;
+    uint8_t tx_mailbox = 0;
+    asdk_can_service_tx_entry_t tx_entry;
     asdk_can_message_t tx_msg = {0};
-    uint32_t num_blocks = 0;
 
-    service_send_iteration_status = asdk_can_is_tx_busy(can_ch, 0, &tx_status_busy);
+    /* any free mailbox of the transmit queue will do */
+    service_send_iteration_status = asdk_can_get_free_tx_mailbox(can_ch, &tx_mailbox, &tx_status_busy);
 
     if (ASDK_CAN_SUCCESS != service_send_iteration_status)
     {
@@ -253,51 +602,443 @@ asdk_errorcode_t asdk_can_service_send_iteration(uint8_t can_ch)
     }
     else
     {
-        /* get data from transmit queue and send it on can bus */
-        num_blocks = ring_buffer_read(&(can_tx_buffer[can_ch]), (uint8_t *)&can_data, 1);
-
-        if (num_blocks == 0) {
+        /* get the next frame as per the transmit order and send it */
+        if (!__asdk_can_service_tx_dequeue(can_ch, &tx_entry))
+        {
             return ASDK_MW_CAN_SERVICE_TX_QUEUE_EMPTY;
         }
 
-        tx_msg.can_id = can_data.can_id;
-        tx_msg.dlc = can_data.dlc;
-        tx_msg.message = can_data.message;
+        __asdk_can_service_record_wait(can_ch, tx_entry.frame.can_id,
+                                       (uint32_t)asdk_sys_get_time_ms() - tx_entry.enqueue_time_ms);
+
+        tx_msg.can_id = tx_entry.frame.can_id;
+        tx_msg.dlc = tx_entry.frame.dlc;
+        tx_msg.message = tx_entry.frame.message;
+
+        service_send_iteration_status = asdk_can_write(can_ch, tx_mailbox, &tx_msg);
+    }
 
-        service_send_iteration_status = asdk_can_write(can_ch, 0, &tx_msg);
+    if (ASDK_CAN_SUCCESS == service_send_iteration_status)
+    {
+        service_send_iteration_status = ASDK_MW_CAN_SERVICE_SUCCESS;
     }
 
     return service_send_iteration_status;
 }
 
+asdk_errorcode_t asdk_can_service_receive_claim(uint8_t can_ch, asdk_can_frame_t **frame)
+{
+    size_t num_slots = 1;
+
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    if (NULL == frame)
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_NULL_PTR;
+    }
+
+    /* oldest frame of the receive pending queue, accessed in-place */
+    *frame = (asdk_can_frame_t *)ring_buffer_claim_read(&(can_rx_buffer[can_ch]), &num_slots);
+
+    if (NULL == *frame)
+    {
+        return ASDK_MW_CAN_SERVICE_RX_QUEUE_EMPTY;
+    }
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_can_service_receive_release(uint8_t can_ch)
+{
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    /* hand the slot back to the receive interrupt */
+    ring_buffer_release_read(&(can_rx_buffer[can_ch]), 1);
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
 asdk_errorcode_t asdk_can_service_receive_iteration(uint8_t can_ch)
 {
     asdk_errorcode_t service_receive_iteration_status = ASDK_MW_CAN_SERVICE_SUCCESS;
-    asdk_can_frame_t rx_frame;
-    uint32_t num_blocks = 0;
+    asdk_can_frame_t *rx_frame = NULL;
     asdk_can_message_t rx_msg = {0};
+    asdk_can_service_rx_handler_t rx_handler = NULL;
+
+    /* get frame from receive pending queue */
+    service_receive_iteration_status = asdk_can_service_receive_claim(can_ch, &rx_frame);
+
+    if (ASDK_MW_CAN_SERVICE_SUCCESS != service_receive_iteration_status)
+    {
+        return service_receive_iteration_status;
+    }
+
+    rx_handler = __asdk_can_service_find_rx_handler(can_ch, rx_frame->can_id);
+
+    /* decode in the slot with the handler of the CAN ID, else callback to user */
+    if (NULL != rx_handler)
+    {
+        rx_handler(can_ch, rx_frame);
+    }
+    else if (NULL != service_user_callback)
+    {
+        rx_msg.can_id = rx_frame->can_id;
+        rx_msg.dlc = rx_frame->dlc;
+        rx_msg.message = rx_frame->message;
+
+        service_user_callback(can_ch, ASDK_CAN_RX_EVENT, &rx_msg);
+    }
+
+    return asdk_can_service_receive_release(can_ch);
+}
+
+asdk_errorcode_t asdk_can_service_register_rx_handler(uint8_t can_ch, uint32_t can_id, asdk_can_service_rx_handler_t handler)
+{
+    asdk_can_service_rx_dispatch_t *rx_dispatch = NULL;
+    uint8_t index;
 
     if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
     {
         return ASDK_CAN_ERROR_INVALID_CHANNEL;
     }
 
-    /* get data from receive pending queue */
-    num_blocks = ring_buffer_read(&(can_rx_buffer[can_ch]), (uint8_t *)&rx_frame, 1);
+    if (NULL == handler)
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_NULL_PTR;
+    }
 
-    if (num_blocks == 0) {
-        return ASDK_MW_CAN_SERVICE_RX_QUEUE_EMPTY;
+    // extended IDs are reported through the service callback
+    if (MAX_STD_CANID < can_id)
+    {
+        return ASDK_MW_CAN_SERVICE_INVALID_CAN_DATA;
     }
 
-    /* callback to user with received message */
-    if (NULL != service_user_callback)
+    /* replace the handler if the channel already has one */
+    for (index = can_rx_dispatch[can_id]; 0 != index; index = can_rx_handlers[index - 1].next)
     {
-        rx_msg.can_id = rx_frame.can_id;
-        rx_msg.dlc = rx_frame.dlc;
-        rx_msg.message = rx_frame.message;
+        if (can_rx_handlers[index - 1].can_ch == can_ch)
+        {
+            can_rx_handlers[index - 1].handler = handler;
+            return ASDK_MW_CAN_SERVICE_SUCCESS;
+        }
+    }
 
-        service_user_callback(can_ch, ASDK_CAN_RX_EVENT, &rx_msg);
+    if (ASDK_CAN_SERVICE_RX_HANDLER_MAX <= can_rx_handler_count)
+    {
+        return ASDK_MW_CAN_SERVICE_RX_HANDLER_TABLE_FULL;
+    }
+
+    rx_dispatch = &can_rx_handlers[can_rx_handler_count++];
+    rx_dispatch->handler = handler;
+    rx_dispatch->can_ch = can_ch;
+    rx_dispatch->next = can_rx_dispatch[can_id];
+
+    can_rx_dispatch[can_id] = can_rx_handler_count;
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_can_service_send_batch(uint8_t can_ch, uint32_t max_frames, uint32_t time_budget_ms, uint32_t *num_frames)
+{
+    asdk_errorcode_t service_send_batch_status = ASDK_MW_CAN_SERVICE_SUCCESS;
+    int64_t start_time_ms = asdk_sys_get_time_ms();
+    uint32_t num_sent = 0;
+
+    /* push frames until the controller is busy, queue is empty or budget is used */
+    while (num_sent < max_frames)
+    {
+        service_send_batch_status = asdk_can_service_send_iteration(can_ch);
+
+        if (ASDK_MW_CAN_SERVICE_SUCCESS != service_send_batch_status)
+        {
+            break;
+        }
+
+        num_sent++;
+
+        if (__asdk_can_service_budget_expired(start_time_ms, time_budget_ms))
+        {
+            break;
+        }
+    }
+
+    if (NULL != num_frames)
+    {
+        *num_frames = num_sent;
+    }
+
+    /* running out of frames or mailboxes ends a batch normally */
+    if ((ASDK_MW_CAN_SERVICE_TX_QUEUE_EMPTY == service_send_batch_status) ||
+        (ASDK_MW_CAN_SERVICE_TX_BUSY == service_send_batch_status))
+    {
+        service_send_batch_status = ASDK_MW_CAN_SERVICE_SUCCESS;
+    }
+
+    return service_send_batch_status;
+}
+
+asdk_errorcode_t asdk_can_service_receive_batch(uint8_t can_ch, uint32_t max_frames, uint32_t time_budget_ms, uint32_t *num_frames)
+{
+    asdk_errorcode_t service_receive_batch_status = ASDK_MW_CAN_SERVICE_SUCCESS;
+    int64_t start_time_ms = asdk_sys_get_time_ms();
+    uint32_t num_received = 0;
+
+    /* drain frames until the queue is empty or budget is used */
+    while (num_received < max_frames)
+    {
+        service_receive_batch_status = asdk_can_service_receive_iteration(can_ch);
+
+        if (ASDK_MW_CAN_SERVICE_SUCCESS != service_receive_batch_status)
+        {
+            break;
+        }
+
+        num_received++;
+
+        if (__asdk_can_service_budget_expired(start_time_ms, time_budget_ms))
+        {
+            break;
+        }
+    }
+
+    if (NULL != num_frames)
+    {
+        *num_frames = num_received;
+    }
+
+    if (ASDK_MW_CAN_SERVICE_RX_QUEUE_EMPTY == service_receive_batch_status)
+    {
+        service_receive_batch_status = ASDK_MW_CAN_SERVICE_SUCCESS;
+    }
+
+    return service_receive_batch_status;
+}
+
+asdk_errorcode_t asdk_can_service_get_stats(uint8_t can_ch, asdk_can_service_stats_t *stats)
+{
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    if (NULL == stats)
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_NULL_PTR;
+    }
+
+    stats->tx_high_water_mark = can_service_stats[can_ch].tx_high_water_mark;
+    stats->rx_high_water_mark = can_service_stats[can_ch].rx_high_water_mark;
+    stats->tx_drop_count = can_service_stats[can_ch].tx_drop_count;
+    stats->rx_drop_count = can_service_stats[can_ch].rx_drop_count;
+    stats->pool_size = MAX_POOL_SIZE;
+    stats->tx_coalesced_count = can_service_stats[can_ch].tx_coalesced_count;
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_can_service_reset_stats(uint8_t can_ch)
+{
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    ASDK_ENTER_CRITICAL_SECTION()
+    can_service_stats[can_ch].tx_high_water_mark = 0;
+    can_service_stats[can_ch].rx_high_water_mark = 0;
+    can_service_stats[can_ch].tx_drop_count = 0;
+    can_service_stats[can_ch].rx_drop_count = 0;
+    can_service_stats[can_ch].tx_coalesced_count = 0;
+    ASDK_EXIT_CRITICAL_SECTION()
+
+    can_wait_stats_count[can_ch] = 0;
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_can_service_set_tx_order(uint8_t can_ch, asdk_can_service_tx_order_t tx_order)
+{
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    if (ASDK_CAN_SERVICE_TX_ORDER_MAX <= tx_order)
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_INVALID_TX_ORDER;
+    }
+
+    /* both orders share the tx pool, queued frames would be lost */
+    if ((0 != can_tx_heap_count[can_ch]) ||
+        (0 != ring_buffer_get_used_capacity(&(can_tx_buffer[can_ch]))))
+    {
+        return ASDK_MW_CAN_SERVICE_TX_BUSY;
+    }
+
+    can_tx_order[can_ch] = tx_order;
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_can_service_get_wait_stats(uint8_t can_ch, asdk_can_service_wait_stats_t *wait_stats, uint32_t max_entries, uint32_t *num_entries)
+{
+    uint32_t count;
+
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    if ((NULL == wait_stats) || (NULL == num_entries))
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_NULL_PTR;
+    }
+
+    count = can_wait_stats_count[can_ch];
+
+    if (count > max_entries)
+    {
+        count = max_entries;
+    }
+
+    memcpy(wait_stats, can_wait_stats[can_ch], count * sizeof(asdk_can_service_wait_stats_t));
+    *num_entries = count;
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_can_service_periodic_register(uint8_t can_ch, const asdk_can_service_periodic_config_t *config, uint8_t *handle)
+{
+    asdk_can_service_periodic_t *periodic = NULL;
+
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    if ((NULL == config) || (NULL == handle))
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_NULL_PTR;
+    }
+
+    if (ASDK_CAN_SERVICE_PERIODIC_MAX <= can_periodic_count)
+    {
+        return ASDK_MW_CAN_SERVICE_PERIODIC_TABLE_FULL;
+    }
+
+    periodic = &can_periodic[can_periodic_count];
+    memset(periodic, 0, sizeof(asdk_can_service_periodic_t));
+    periodic->config = *config;
+    periodic->can_ch = can_ch;
+
+    *handle = can_periodic_count++;
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_can_service_periodic_update(uint8_t handle, const uint8_t *data, uint8_t dlc)
+{
+    asdk_can_service_periodic_t *periodic = NULL;
+
+    if (can_periodic_count <= handle)
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_INVALID_HANDLE;
+    }
+
+    if (NULL == data)
+    {
+        return ASDK_MW_CAN_SERVICE_ERROR_NULL_PTR;
+    }
+
+    if (sizeof(periodic->data) < dlc)
+    {
+        return ASDK_MW_CAN_SERVICE_INVALID_CAN_DATA;
+    }
+
+    periodic = &can_periodic[handle];
+
+    /* a newer update replaces the one not sent yet */
+    if (periodic->pending)
+    {
+        can_service_stats[periodic->can_ch].tx_coalesced_count++;
+    }
+
+    memcpy(periodic->data, data, dlc);
+    periodic->dlc = dlc;
+
+    /* compared against what is on the bus, A sent, B then A again is no change */
+    periodic->changed = (!periodic->sent_once) || (periodic->sent_dlc != dlc) ||
+                        (0 != memcmp(periodic->sent_data, data, dlc));
+
+    periodic->valid = true;
+    periodic->pending = true;
+
+    return ASDK_MW_CAN_SERVICE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_can_service_periodic_iteration(uint8_t can_ch)
+{
+    asdk_errorcode_t periodic_iteration_status = ASDK_MW_CAN_SERVICE_SUCCESS;
+    asdk_can_service_periodic_t *periodic = NULL;
+    asdk_can_message_t tx_msg = {0};
+    uint32_t now_ms = (uint32_t)asdk_sys_get_time_ms();
+
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    for (uint8_t i = 0; i < can_periodic_count; i++)
+    {
+        periodic = &can_periodic[i];
+
+        if ((periodic->can_ch != can_ch) || !__asdk_can_service_periodic_due(periodic, now_ms))
+        {
+            continue;
+        }
+
+        tx_msg.can_id = periodic->config.can_id;
+        tx_msg.dlc = periodic->dlc;
+        tx_msg.message = periodic->data;
+
+        periodic_iteration_status = asdk_can_service_send(can_ch, &tx_msg);
+
+        // transmit queue full, retry on next iteration
+        if (ASDK_MW_CAN_SERVICE_SUCCESS != periodic_iteration_status)
+        {
+            break;
+        }
+
+        memcpy(periodic->sent_data, periodic->data, periodic->dlc);
+        periodic->sent_dlc = periodic->dlc;
+
+        /* a frame sent on change leaves the cycle alone, a late iteration
+           does not shift it either unless a whole cycle was missed */
+        if (!periodic->sent_once)
+        {
+            periodic->next_cycle_ms = now_ms + periodic->config.cycle_time_ms;
+        }
+        else if (0 <= (int32_t)(now_ms - periodic->next_cycle_ms))
+        {
+            periodic->next_cycle_ms += periodic->config.cycle_time_ms;
+
+            if (0 <= (int32_t)(now_ms - periodic->next_cycle_ms))
+            {
+                periodic->next_cycle_ms = now_ms + periodic->config.cycle_time_ms;
+            }
+        }
+
+        periodic->last_sent_ms = now_ms;
+        periodic->sent_once = true;
+        periodic->changed = false;
+        periodic->pending = false;
     }
 
-    return service_receive_iteration_status;
+    return periodic_iteration_status;
 }
@@ -49,23 +49,72 @@
 
 ==============================================================================*/
 
+/* number of CAN IDs tracked for transmit queue wait time, per channel */
+#define ASDK_CAN_SERVICE_WAIT_STATS_MAX 16
+
+/* number of messages handled by the periodic transmit scheduler, all channels */
+#define ASDK_CAN_SERVICE_PERIODIC_MAX 16
+
+/* number of per CAN ID receive handlers, all channels */
+#define ASDK_CAN_SERVICE_RX_HANDLER_MAX 32
+
 /*==============================================================================
 
                       DEFINITIONS AND TYPES : ENUMS
 
 ==============================================================================*/
 
+/* order in which queued frames are handed to the CAN controller */
+typedef enum {
+    ASDK_CAN_SERVICE_TX_ORDER_FIFO = 0,    /*!< Oldest frame first (default). */
+    ASDK_CAN_SERVICE_TX_ORDER_ID_PRIORITY, /*!< Lowest CAN ID first, oldest first among equal IDs. */
+    ASDK_CAN_SERVICE_TX_ORDER_MAX,
+} asdk_can_service_tx_order_t;
+
 /*==============================================================================
 
                    DEFINITIONS AND TYPES : STRUCTURES
 
 ==============================================================================*/
 
+/* asdk_can_frame_t is defined by the CAN DAL (asdk_can.h) */
+
 typedef struct {
-    uint32_t can_id;  /*!< The CAN message identifier (CAN ID). */
-    uint8_t dlc;      /*!< Length of the message. */
-    uint8_t message[8]; /*!< A pointer to a buffer for holding data. */
-} asdk_can_frame_t;
+    uint32_t tx_high_water_mark; /*!< Maximum number of frames held in the transmit queue. */
+    uint32_t rx_high_water_mark; /*!< Maximum number of frames held in the receive queue. */
+    uint32_t tx_drop_count;      /*!< Frames rejected because the transmit queue was full. */
+    uint32_t rx_drop_count;      /*!< Frames dropped because the receive queue was full. */
+    uint32_t pool_size;          /*!< Capacity of each queue in frames. */
+    uint32_t tx_coalesced_count; /*!< Periodic message updates absorbed without a frame of their own. */
+} asdk_can_service_stats_t;
+
+typedef struct {
+    uint32_t can_id;        /*!< CAN ID the statistics belong to. */
+    uint32_t frame_count;   /*!< Frames of this ID handed to the controller. */
+    uint32_t max_wait_ms;   /*!< Longest time a frame waited in the transmit queue. */
+    uint32_t total_wait_ms; /*!< Sum of wait times, divide by frame_count for the average. */
+} asdk_can_service_wait_stats_t;
+
+/* one transmitted message of the periodic scheduler, several may share a
+   CAN ID, e.g. multiplexed payloads told apart by their first byte */
+typedef struct {
+    uint32_t can_id;          /*!< CAN ID of the message. */
+    uint32_t cycle_time_ms;   /*!< Cyclic transmission period, 0 disables cyclic transmission. */
+    uint32_t min_interval_ms; /*!< Minimum gap between two frames sent on change, 0 for none. */
+    bool send_on_change;      /*!< Send as soon as the data differs from the last sent frame. */
+} asdk_can_service_periodic_config_t;
+
+/*==============================================================================
+
+                           CALLBACK FUNCTION TYPES
+
+==============================================================================*/
+
+/* decoder for one CAN ID, runs on the receive slot which is released on return */
+typedef void (*asdk_can_service_rx_handler_t)(uint8_t can_ch, const asdk_can_frame_t *frame);
+
+/* called from interrupt context after a frame entered the receive queue */
+typedef void (*asdk_can_service_rx_notify_t)(uint8_t can_ch);
 
 /*==============================================================================
 
@@ -81,8 +130,34 @@ typedef struct {
 
 asdk_errorcode_t asdk_can_service_init(uint8_t can_ch, asdk_can_config_t can_config);
 asdk_errorcode_t asdk_can_service_install_callback(asdk_can_callback_t user_callback);
+asdk_errorcode_t asdk_can_service_install_rx_notify(asdk_can_service_rx_notify_t rx_notify);
 asdk_errorcode_t asdk_can_service_send(uint8_t can_ch, asdk_can_message_t *msg);
 asdk_errorcode_t asdk_can_service_send_iteration(uint8_t can_ch);
 asdk_errorcode_t asdk_can_service_receive_iteration(uint8_t can_ch);
+asdk_errorcode_t asdk_can_service_receive_claim(uint8_t can_ch, asdk_can_frame_t **frame);
+asdk_errorcode_t asdk_can_service_receive_release(uint8_t can_ch);
+
+/* dispatch frames of a standard CAN ID to handler instead of the service callback,
+   registering the same CAN ID again replaces the handler */
+asdk_errorcode_t asdk_can_service_register_rx_handler(uint8_t can_ch, uint32_t can_id, asdk_can_service_rx_handler_t handler);
+
+/* process up to max_frames per call, time_budget_ms = 0 disables the time limit */
+asdk_errorcode_t asdk_can_service_send_batch(uint8_t can_ch, uint32_t max_frames, uint32_t time_budget_ms, uint32_t *num_frames);
+asdk_errorcode_t asdk_can_service_receive_batch(uint8_t can_ch, uint32_t max_frames, uint32_t time_budget_ms, uint32_t *num_frames);
+
+asdk_errorcode_t asdk_can_service_get_stats(uint8_t can_ch, asdk_can_service_stats_t *stats);
+asdk_errorcode_t asdk_can_service_reset_stats(uint8_t can_ch);
+
+/* select transmit order, allowed only while the transmit queue is empty */
+asdk_errorcode_t asdk_can_service_set_tx_order(uint8_t can_ch, asdk_can_service_tx_order_t tx_order);
+
+/* periodic transmit scheduler, update the data any time and let the
+   iteration decide when a frame is due, all calls from the same context */
+asdk_errorcode_t asdk_can_service_periodic_register(uint8_t can_ch, const asdk_can_service_periodic_config_t *config, uint8_t *handle);
+asdk_errorcode_t asdk_can_service_periodic_update(uint8_t handle, const uint8_t *data, uint8_t dlc);
+asdk_errorcode_t asdk_can_service_periodic_iteration(uint8_t can_ch);
+
+/* copies wait time statistics of up to max_entries CAN IDs, in order of first transmission */
+asdk_errorcode_t asdk_can_service_get_wait_stats(uint8_t can_ch, asdk_can_service_wait_stats_t *wait_stats, uint32_t max_entries, uint32_t *num_entries);
 
 #endif /* ASDK_CAN_SERVICE_H */
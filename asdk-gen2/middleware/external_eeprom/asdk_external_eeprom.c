@@ -26,6 +26,7 @@
 ==============================================================================*/
 
 #include "asdk_external_eeprom.h"
+#include "asdk_platform.h"
 
 /*==============================================================================
 
@@ -33,6 +34,34 @@
 
 ==============================================================================*/
 
+#if (0U == ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH) || (ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH > 128U) || \
+	(0U != (ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH & (ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH - 1U)))
+#error "ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH must be a power of 2, up to 128."
+#endif
+
+/* Free running queue positions are wrapped into the slot array */
+#define EEPROM_QUEUE_SLOT(pos) ((pos) & (ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH - 1U))
+
+/*==============================================================================
+
+					  LOCAL DEFINITIONS AND TYPES : ENUMS
+
+==============================================================================*/
+
+/*!
+ * @brief States of the transaction engine of an EEPROM instance. The I2C interrupt
+ * owns the engine while a transfer is on the bus, the application owns it otherwise.
+ *
+ * Implements : eeprom_engine_state_t
+ */
+typedef enum {
+	EEPROM_ENGINE_IDLE = 0,	 /* Nothing on the bus, queue empty */
+	EEPROM_ENGINE_WRITE,	 /* Page write on the bus */
+	EEPROM_ENGINE_READ_ADDR, /* Address phase of a page read on the bus */
+	EEPROM_ENGINE_READ_DATA, /* Data phase of a page read on the bus */
+	EEPROM_ENGINE_POLL,		 /* Frame in tx_buffer NACKed or not started, retried by the iteration */
+} eeprom_engine_state_t;
+
 /*==============================================================================
 
 					LOCAL DEFINITIONS AND TYPES : STRUCTURES
@@ -40,19 +69,18 @@
 ==============================================================================*/
 
 /*!
- * @brief An data structure for EEPROM read/write management.
+ * @brief An data structure for a queued EEPROM read/write.
  *
- * Implements : eeprom_manager_t
+ * Implements : eeprom_transaction_t
  */
 typedef struct {
-	uint32_t address;		  /* Address where data will be read from or written to external EEPROM */
-	uint8_t *buffer;		  /* Pointer to the buffer where data will be read from or written to external EEPROM */
-	uint32_t bytes_remaining; /* Number of bytes remaining for read or write */
-	uint32_t length;		  /* Length of the data to be read or write */
-	uint32_t index;			  /* Index value used for tracking purposes */
-	bool is_op_pending;		  /* Flag indicating whether a read or write operation is pending or not */
-	bool is_cb_pending;		  /* Flag indicating whether a callback is issued or not */
-} eeprom_manager_t;
+	uint32_t address;								/* EEPROM address the transaction starts at */
+	uint8_t *buffer;								/* Application buffer read from or written to */
+	uint32_t length;								/* Length of the data to be read or written */
+	asdk_external_eeprom_transaction_cb_t callback; /* Completion callback, NULL for the config callback */
+	bool is_read;									/* Read or write */
+	volatile bool is_cancelled;						/* Complete with an error at the next page boundary */
+} eeprom_transaction_t;
 
 /*!
  * @brief An data structure for External EEPROM operation.
@@ -60,11 +88,21 @@ typedef struct {
  * Implements : ext_eeprom_t
  */
 typedef struct {
-	asdk_external_eeprom_config_t eeprom_config; /* Config from user */
-	eeprom_manager_t eeprom_write_mgr;			 /* Write manager */
-	eeprom_manager_t eeprom_read_mgr;			 /* Read manager */
-	bool read_complete;							 /* Flag indicating whether read operation is complete or not */
-	bool write_complete;						 /* Flag indicating whether write operation is complete or not */
+	asdk_external_eeprom_config_t eeprom_config;					 /* Config from user */
+	eeprom_transaction_t queue[ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH]; /* Transaction queue */
+	volatile uint8_t queue_head;									 /* Transaction being served, engine side */
+	volatile uint8_t queue_tail;									 /* Next free slot, application side */
+	volatile eeprom_engine_state_t state;							 /* Engine state */
+	uint32_t offset;		/* Bytes of the head transaction already transferred */
+	uint16_t chunk;			/* Data bytes of the page in tx_buffer */
+	uint16_t frame_length;	/* Bytes of tx_buffer sent for that page */
+	bool is_polling;		/* EEPROM NACKed the page, write cycle in progress */
+	int64_t poll_start_ms;	/* Time of the first NACK of the page */
+	uint8_t completed;		/* Queue position of the last completed transaction */
+	uint8_t blocking_ticket; /* Queue position of the transaction a blocking API waits for */
+	volatile bool blocking_done;
+	asdk_external_eeprom_status_t blocking_status;
+	asdk_external_eeprom_stats_t stats;
 } ext_eeprom_t;
 
 /* Static global variable to store External EEPROM configurations and manage read/write operations */
@@ -76,10 +114,19 @@ static ext_eeprom_t g_ext_eeprom[ASDK_EXTERNAL_EEPROM_MAX];
 
 ==============================================================================*/
 
-static asdk_errorcode_t __asdk_external_eeprom_page_write(uint8_t eeprom_index, uint32_t start_addr, void *buff,
-														  uint16_t wr_len);
-static asdk_errorcode_t __asdk_external_eeprom_page_read(uint8_t eeprom_index, uint32_t start_addr, void *buff,
-														 uint16_t rd_len);
+static asdk_errorcode_t __asdk_external_eeprom_validate(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
+														uint32_t length);
+static asdk_errorcode_t __asdk_external_eeprom_enqueue(uint8_t eeprom_index, bool is_read, uint32_t eeprom_addr,
+													   void *buff, uint32_t length,
+													   asdk_external_eeprom_transaction_cb_t callback);
+static void __asdk_external_eeprom_start_next(uint8_t eeprom_index);
+static void __asdk_external_eeprom_launch(uint8_t eeprom_index);
+static void __asdk_external_eeprom_advance(uint8_t eeprom_index);
+static void __asdk_external_eeprom_complete(uint8_t eeprom_index, asdk_external_eeprom_status_t status);
+static asdk_errorcode_t __asdk_external_eeprom_blocking(uint8_t eeprom_index, bool is_read, uint32_t eeprom_addr,
+														void *buff, uint32_t length, uint16_t wait_time_ms);
+static void __asdk_external_eeprom_blocking_callback(uint8_t eeprom_index, asdk_external_eeprom_status_t status,
+													 uint32_t eeprom_addr, void *buff, uint32_t length);
 static asdk_errorcode_t __asdk_i2c_eeprom_init(asdk_i2c_config_t *i2c_config);
 static void __asdk_i2c_eeprom_callback(asdk_i2c_num_t i2c_no, uint8_t *data, uint32_t data_size,
 									   asdk_i2c_status_t status);
@@ -108,9 +155,18 @@ asdk_errorcode_t __asdk_i2c_eeprom_init(asdk_i2c_config_t *i2c_config)
 	return asdk_i2c_init(i2c_config);
 }
 
+/*!
+ * @note Runs in the I2C interrupt. Chains the next page, or the next transaction,
+ * as soon as the bus reports completion.
+ */
 void __asdk_i2c_eeprom_callback(asdk_i2c_num_t i2c_no, uint8_t *data, uint32_t data_size, asdk_i2c_status_t status)
 {
-	static uint8_t eeprom_index = 0;
+	uint8_t eeprom_index = ASDK_EXTERNAL_EEPROM_MAX;
+	ext_eeprom_t *eeprom;
+	asdk_i2c_status_t i2c_status = ASDK_I2C_STATUS_UNDEFINED;
+
+	(void)data;
+	(void)data_size;
 
 	for (uint8_t i = 0; i < ASDK_EXTERNAL_EEPROM_MAX; i++) {
 		if (g_ext_eeprom[i].eeprom_config.protocol == ASDK_EXTERNAL_EEPROM_PROTOCOL_I2C) {
@@ -121,123 +177,300 @@ void __asdk_i2c_eeprom_callback(asdk_i2c_num_t i2c_no, uint8_t *data, uint32_t d
 		}
 	}
 
-	if (ASDK_I2C_STATUS_WR_COMPLETE == status) {
-		g_ext_eeprom[eeprom_index].write_complete = true;
+	if (eeprom_index >= ASDK_EXTERNAL_EEPROM_MAX)
+		return;
+
+	eeprom = &g_ext_eeprom[eeprom_index];
+
+	switch (status) {
+	case ASDK_I2C_STATUS_WR_COMPLETE:
+		if (EEPROM_ENGINE_WRITE == eeprom->state) {
+			eeprom->is_polling = false;
+			eeprom->offset += eeprom->chunk;
+			eeprom->stats.bytes_written += eeprom->chunk;
+			__asdk_external_eeprom_advance(eeprom_index);
+		} else if (EEPROM_ENGINE_READ_ADDR == eeprom->state) {
+			eeprom_transaction_t *trans = &eeprom->queue[EEPROM_QUEUE_SLOT(eeprom->queue_head)];
+			asdk_i2c_config_t *p_i2c_config = &eeprom->eeprom_config.protocol_config.i2c_config;
+
+			eeprom->is_polling = false;
+			eeprom->state = EEPROM_ENGINE_READ_DATA;
+			eeprom->stats.transfers++;
+
+			if (ASDK_I2C_STATUS_SUCCESS != asdk_i2c_master_read_non_blocking(p_i2c_config->i2c_no,
+																			  p_i2c_config->slave_Address,
+																			  &trans->buffer[eeprom->offset],
+																			  eeprom->chunk)) {
+				__asdk_external_eeprom_complete(eeprom_index, ASDK_EXTERNAL_EEPROM_STATUS_ERROR);
+				__asdk_external_eeprom_start_next(eeprom_index);
+			}
+		}
+		break;
 
-		if (g_ext_eeprom[eeprom_index].eeprom_write_mgr.is_cb_pending == true) {
-			g_ext_eeprom[eeprom_index].eeprom_config.eeprom_user_callback(ASDK_EXTERNAL_EEPROM_STATUS_WRITE_COMPLETE);
-			g_ext_eeprom[eeprom_index].eeprom_write_mgr.is_cb_pending = false;
+	case ASDK_I2C_STATUS_RD_COMPLETE:
+		if (EEPROM_ENGINE_READ_DATA == eeprom->state) {
+			eeprom->offset += eeprom->chunk;
+			eeprom->stats.bytes_read += eeprom->chunk;
+			__asdk_external_eeprom_advance(eeprom_index);
 		}
-	}
+		break;
+
+	case ASDK_I2C_STATUS_WR_IN_FIFO:
+		break;
 
-	if (ASDK_I2C_STATUS_RD_COMPLETE == status) {
-		g_ext_eeprom[eeprom_index].read_complete = true;
+	default:
+		if ((EEPROM_ENGINE_WRITE == eeprom->state) || (EEPROM_ENGINE_READ_ADDR == eeprom->state)) {
+			asdk_i2c_get_transfer_status(i2c_no, &i2c_status);
 
-		if (g_ext_eeprom[eeprom_index].eeprom_read_mgr.is_cb_pending == true) {
-			g_ext_eeprom[eeprom_index].eeprom_config.eeprom_user_callback(ASDK_EXTERNAL_EEPROM_STATUS_READ_COMPLETE);
-			g_ext_eeprom[eeprom_index].eeprom_read_mgr.is_cb_pending = false;
+			/* Address NACK: the EEPROM is in its write cycle, the page stays in tx_buffer for the next poll */
+			if (ASDK_I2C_STATUS_MASTER_ADDR_NACK == i2c_status) {
+				if (false == eeprom->is_polling) {
+					eeprom->is_polling = true;
+					eeprom->poll_start_ms = asdk_sys_get_time_ms();
+				}
+				eeprom->stats.ack_polls++;
+				eeprom->state = EEPROM_ENGINE_POLL;
+				break;
+			}
+		}
+
+		if (EEPROM_ENGINE_IDLE != eeprom->state) {
+			__asdk_external_eeprom_complete(eeprom_index, ASDK_EXTERNAL_EEPROM_STATUS_ERROR);
+			__asdk_external_eeprom_start_next(eeprom_index);
 		}
+		break;
 	}
 }
 
+static asdk_errorcode_t __asdk_external_eeprom_validate(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
+														uint32_t length)
+{
+	if (eeprom_index >= ASDK_EXTERNAL_EEPROM_MAX)
+		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX;
+
+	if (g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes <= eeprom_addr)
+		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS;
+
+	if ((0 == length) || ((g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes - eeprom_addr) < length))
+		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH;
+
+	if (NULL == buff)
+		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER;
+
+	return ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
+}
+
 /*!
- * @todo Add support for SPI protocol.
- * @note If called continously, blocked for write cycle time of EEPROM.
+ * @note Single producer: queue transactions from one context, or from the completion callbacks only.
  */
-static asdk_errorcode_t __asdk_external_eeprom_page_write(uint8_t eeprom_index, uint32_t start_addr, void *buff,
-														  uint16_t wr_len)
+static asdk_errorcode_t __asdk_external_eeprom_enqueue(uint8_t eeprom_index, bool is_read, uint32_t eeprom_addr,
+													   void *buff, uint32_t length,
+													   asdk_external_eeprom_transaction_cb_t callback)
 {
-	asdk_errorcode_t ret_val = ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
+	ext_eeprom_t *eeprom;
+	eeprom_transaction_t *trans;
+	asdk_errorcode_t ret_val = __asdk_external_eeprom_validate(eeprom_index, eeprom_addr, buff, length);
+
+	ASDK_DEV_ERROR_RETURN(ret_val, ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS);
 
-	if ((false == g_ext_eeprom[eeprom_index].read_complete) || (false == g_ext_eeprom[eeprom_index].write_complete))
+	eeprom = &g_ext_eeprom[eeprom_index];
+
+	if ((uint8_t)(eeprom->queue_tail - eeprom->queue_head) >= ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH)
 		return ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY;
 
-	g_ext_eeprom[eeprom_index].write_complete = false;
-
-	/* Copying EEPROM write address, MSB first */
-	for (uint8_t i = 0; i < g_ext_eeprom[eeprom_index].eeprom_config.addr_width; i++)
-		if (g_ext_eeprom[eeprom_index].eeprom_config.is_big_endian == true)
-			g_ext_eeprom[eeprom_index].eeprom_config.tx_buffer[i] = (start_addr >> (8 * i)) & 0xFF;
-		else
-			g_ext_eeprom[eeprom_index]
-				.eeprom_config.tx_buffer[g_ext_eeprom[eeprom_index].eeprom_config.addr_width - i - 1] =
-				(start_addr >> (8 * i)) & 0xFF;
-
-	/* Copying data from application buffer to static global buffer */
-	memcpy(&g_ext_eeprom[eeprom_index].eeprom_config.tx_buffer[g_ext_eeprom[eeprom_index].eeprom_config.addr_width],
-		   buff, wr_len);
-
-	if (ASDK_EXTERNAL_EEPROM_PROTOCOL_I2C == g_ext_eeprom[eeprom_index].eeprom_config.protocol) {
-		asdk_i2c_config_t *p_i2c_config = &g_ext_eeprom[eeprom_index].eeprom_config.protocol_config.i2c_config;
-		asdk_i2c_status_t i2c_status = ASDK_I2C_STATUS_UNDEFINED;
-
-		do {
-			ret_val = asdk_i2c_master_write_non_blocking(p_i2c_config->i2c_no, p_i2c_config->slave_Address,
-														 g_ext_eeprom[eeprom_index].eeprom_config.tx_buffer,
-														 g_ext_eeprom[eeprom_index].eeprom_config.addr_width + wr_len);
-			ASDK_DEV_ERROR_RETURN(ret_val, ASDK_I2C_STATUS_SUCCESS);
-			asdk_i2c_get_transfer_status(g_ext_eeprom[eeprom_index].eeprom_config.protocol_config.i2c_config.i2c_no,
-										 &i2c_status);
-		} while (i2c_status == ASDK_I2C_STATUS_MASTER_ADDR_NACK);
+	trans = &eeprom->queue[EEPROM_QUEUE_SLOT(eeprom->queue_tail)];
+	trans->address = eeprom_addr;
+	trans->buffer = buff;
+	trans->length = length;
+	trans->callback = callback;
+	trans->is_read = is_read;
+	trans->is_cancelled = false;
 
-		ret_val = ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
-	} else {
-		ret_val = ASDK_MW_EXTERNAL_EEPROM_ERROR_FEATURE_NOT_IMPLEMENTED;
+	/* Publish the slot before the engine can see it */
+	ASDK_MEMORY_BARRIER()
+	eeprom->queue_tail++;
+
+	/* An idle engine has no interrupt pending to pick the transaction up */
+	if (EEPROM_ENGINE_IDLE == eeprom->state)
+		__asdk_external_eeprom_start_next(eeprom_index);
+
+	return ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
+}
+
+/*!
+ * @brief Prepares the next page of the head transaction in tx_buffer and puts it on the bus.
+ * The address and page data are set up right after the previous page left the bus, while
+ * the EEPROM runs its write cycle, so the first ACK-poll already carries the next page.
+ */
+static void __asdk_external_eeprom_start_next(uint8_t eeprom_index)
+{
+	ext_eeprom_t *eeprom = &g_ext_eeprom[eeprom_index];
+	asdk_external_eeprom_config_t *config = &eeprom->eeprom_config;
+	eeprom_transaction_t *trans;
+	uint32_t address;
+	uint32_t chunk;
+
+	/* Not idle, so a transaction queued by a completion callback below does not restart the engine */
+	eeprom->state = EEPROM_ENGINE_POLL;
+
+	while (eeprom->queue_head != eeprom->queue_tail) {
+		trans = &eeprom->queue[EEPROM_QUEUE_SLOT(eeprom->queue_head)];
+
+		if (true == trans->is_cancelled) {
+			__asdk_external_eeprom_complete(eeprom_index, ASDK_EXTERNAL_EEPROM_STATUS_ERROR);
+			continue;
+		}
+
+		address = trans->address + eeprom->offset;
+		chunk = config->page_size_bytes - (address % config->page_size_bytes);
+
+		if (chunk > (trans->length - eeprom->offset))
+			chunk = trans->length - eeprom->offset;
+
+		/* Copying EEPROM address, MSB first */
+		for (uint8_t i = 0; i < config->addr_width; i++)
+			if (config->is_big_endian == true)
+				config->tx_buffer[i] = (address >> (8 * i)) & 0xFF;
+			else
+				config->tx_buffer[config->addr_width - i - 1] = (address >> (8 * i)) & 0xFF;
+
+		eeprom->chunk = (uint16_t)chunk;
+		eeprom->frame_length = config->addr_width;
+
+		if (false == trans->is_read) {
+			memcpy(&config->tx_buffer[config->addr_width], &trans->buffer[eeprom->offset], chunk);
+			eeprom->frame_length += (uint16_t)chunk;
+		}
+
+		__asdk_external_eeprom_launch(eeprom_index);
+		return;
 	}
 
-	return ret_val;
+	eeprom->state = EEPROM_ENGINE_IDLE;
 }
 
 /*!
  * @todo Add support for SPI protocol.
  */
-static asdk_errorcode_t __asdk_external_eeprom_page_read(uint8_t eeprom_index, uint32_t start_addr, void *buff,
-														 uint16_t rd_len)
+static void __asdk_external_eeprom_launch(uint8_t eeprom_index)
 {
-	asdk_errorcode_t ret_val = ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
-	uint8_t read_addr[g_ext_eeprom[eeprom_index].eeprom_config.addr_width];
+	ext_eeprom_t *eeprom = &g_ext_eeprom[eeprom_index];
+	asdk_i2c_config_t *p_i2c_config = &eeprom->eeprom_config.protocol_config.i2c_config;
+	bool is_read = eeprom->queue[EEPROM_QUEUE_SLOT(eeprom->queue_head)].is_read;
+
+	/* The interrupt may fire before the write call returns */
+	eeprom->state = is_read ? EEPROM_ENGINE_READ_ADDR : EEPROM_ENGINE_WRITE;
+	eeprom->stats.transfers++;
+
+	if (ASDK_I2C_STATUS_SUCCESS != asdk_i2c_master_write_non_blocking(p_i2c_config->i2c_no,
+																	   p_i2c_config->slave_Address,
+																	   eeprom->eeprom_config.tx_buffer,
+																	   eeprom->frame_length)) {
+		/* Bus not ready, retried by the iteration like a NACK */
+		if (false == eeprom->is_polling) {
+			eeprom->is_polling = true;
+			eeprom->poll_start_ms = asdk_sys_get_time_ms();
+		}
+		eeprom->state = EEPROM_ENGINE_POLL;
+	}
+}
 
-	if ((false == g_ext_eeprom[eeprom_index].read_complete) || (false == g_ext_eeprom[eeprom_index].write_complete))
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY;
+static void __asdk_external_eeprom_advance(uint8_t eeprom_index)
+{
+	ext_eeprom_t *eeprom = &g_ext_eeprom[eeprom_index];
+	eeprom_transaction_t *trans = &eeprom->queue[EEPROM_QUEUE_SLOT(eeprom->queue_head)];
 
-	g_ext_eeprom[eeprom_index].write_complete = false;
-	g_ext_eeprom[eeprom_index].read_complete = false;
+	if (eeprom->offset >= trans->length)
+		__asdk_external_eeprom_complete(eeprom_index, trans->is_read ? ASDK_EXTERNAL_EEPROM_STATUS_READ_COMPLETE
+																	 : ASDK_EXTERNAL_EEPROM_STATUS_WRITE_COMPLETE);
 
-	/* Copying EEPROM read address, MSB first */
-	for (uint8_t i = 0; i < g_ext_eeprom[eeprom_index].eeprom_config.addr_width; i++)
-		if (g_ext_eeprom[eeprom_index].eeprom_config.is_big_endian == true)
-			read_addr[i] = (start_addr >> (8 * i)) & 0xFF;
-		else
-			read_addr[g_ext_eeprom[eeprom_index].eeprom_config.addr_width - i - 1] = (start_addr >> (8 * i)) & 0xFF;
+	__asdk_external_eeprom_start_next(eeprom_index);
+}
 
-	if (ASDK_EXTERNAL_EEPROM_PROTOCOL_I2C == g_ext_eeprom[eeprom_index].eeprom_config.protocol) {
-		asdk_i2c_config_t *p_i2c_config = &g_ext_eeprom[eeprom_index].eeprom_config.protocol_config.i2c_config;
-		asdk_i2c_status_t i2c_status = ASDK_I2C_STATUS_UNDEFINED;
+/*!
+ * @brief Retires the head transaction. The slot is released before the callback runs so
+ * the callback can queue the next transaction.
+ */
+static void __asdk_external_eeprom_complete(uint8_t eeprom_index, asdk_external_eeprom_status_t status)
+{
+	ext_eeprom_t *eeprom = &g_ext_eeprom[eeprom_index];
+	eeprom_transaction_t trans = eeprom->queue[EEPROM_QUEUE_SLOT(eeprom->queue_head)];
+	uint32_t transferred = eeprom->offset;
 
-		ret_val = asdk_i2c_master_write_non_blocking(p_i2c_config->i2c_no, p_i2c_config->slave_Address, read_addr,
-													 g_ext_eeprom[eeprom_index].eeprom_config.addr_width);
-		ASDK_DEV_ERROR_RETURN(ret_val, ASDK_I2C_STATUS_SUCCESS);
+	eeprom->offset = 0;
+	eeprom->is_polling = false;
+	eeprom->stats.transactions++;
 
-		while (g_ext_eeprom[eeprom_index].write_complete == false) {
-			asdk_i2c_get_transfer_status(p_i2c_config->i2c_no, &i2c_status);
-			if (ASDK_I2C_STATUS_MASTER_ADDR_NACK == i2c_status) {
-				ret_val =
-					asdk_i2c_master_write_non_blocking(p_i2c_config->i2c_no, p_i2c_config->slave_Address, read_addr,
-													   g_ext_eeprom[eeprom_index].eeprom_config.addr_width);
-				ASDK_DEV_ERROR_RETURN(ret_val, ASDK_I2C_STATUS_SUCCESS);
-			}
-		}
+	if (ASDK_EXTERNAL_EEPROM_STATUS_ERROR == status)
+		eeprom->stats.errors++;
 
-		ret_val = asdk_i2c_master_read_non_blocking(p_i2c_config->i2c_no, p_i2c_config->slave_Address, buff, rd_len);
-		ASDK_DEV_ERROR_RETURN(ret_val, ASDK_I2C_STATUS_SUCCESS);
+	eeprom->completed = eeprom->queue_head;
+	eeprom->queue_head++;
 
-		ret_val = ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
+	if (NULL != trans.callback)
+		trans.callback(eeprom_index, status, trans.address, trans.buffer, transferred);
+	else if (NULL != eeprom->eeprom_config.eeprom_user_callback)
+		eeprom->eeprom_config.eeprom_user_callback(status);
+}
+
+static void __asdk_external_eeprom_blocking_callback(uint8_t eeprom_index, asdk_external_eeprom_status_t status,
+													 uint32_t eeprom_addr, void *buff, uint32_t length)
+{
+	ext_eeprom_t *eeprom = &g_ext_eeprom[eeprom_index];
+
+	(void)eeprom_addr;
+	(void)buff;
+	(void)length;
+
+	/* A transaction abandoned by an earlier timeout completes ahead of the awaited one */
+	if (eeprom->completed != eeprom->blocking_ticket)
+		return;
+
+	eeprom->blocking_status = status;
+	eeprom->blocking_done = true;
+}
+
+static asdk_errorcode_t __asdk_external_eeprom_blocking(uint8_t eeprom_index, bool is_read, uint32_t eeprom_addr,
+														void *buff, uint32_t length, uint16_t wait_time_ms)
+{
+	asdk_errorcode_t ret_val = ASDK_ERROR;
+	ext_eeprom_t *eeprom;
+	bool is_timed_out = false;
+	int64_t start_time_ms = asdk_sys_get_time_ms();
+
+	if (start_time_ms < 0)
+		return ASDK_SYS_ERROR_TIMER_INIT_FAILED;
+
+	ret_val = __asdk_external_eeprom_validate(eeprom_index, eeprom_addr, buff, length);
+	ASDK_DEV_ERROR_RETURN(ret_val, ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS);
+
+	eeprom = &g_ext_eeprom[eeprom_index];
+	eeprom->blocking_ticket = eeprom->queue_tail;
+	eeprom->blocking_done = false;
+
+	ret_val = __asdk_external_eeprom_enqueue(eeprom_index, is_read, eeprom_addr, buff, length,
+											 __asdk_external_eeprom_blocking_callback);
+	ASDK_DEV_ERROR_RETURN(ret_val, ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS);
 
-	} else {
-		ret_val = ASDK_MW_EXTERNAL_EEPROM_ERROR_FEATURE_NOT_IMPLEMENTED;
+	/* On timeout the page on the bus may still be read into buff, so the transaction is
+	   cancelled at its next page boundary and the wait goes on until the slot is released */
+	while (false == eeprom->blocking_done) {
+		asdk_external_eeprom_iteration(eeprom_index);
+
+		if ((false == is_timed_out) && (asdk_sys_get_time_ms() > start_time_ms + wait_time_ms)) {
+			asdk_sys_disable_interrupts();
+			if (false == eeprom->blocking_done) {
+				eeprom->queue[EEPROM_QUEUE_SLOT(eeprom->blocking_ticket)].is_cancelled = true;
+				is_timed_out = true;
+			}
+			asdk_sys_enable_interrupts();
+		}
 	}
 
-	return ret_val;
+	if (ASDK_EXTERNAL_EEPROM_STATUS_ERROR == eeprom->blocking_status)
+		return is_timed_out ? ASDK_MW_EXTERNAL_EEPROM_ERROR_TIMEOUT : ASDK_MW_EXTERNAL_EEPROM_ERROR_TRANSFER_FAILED;
+
+	return ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
 }
 
 /*!
@@ -288,144 +521,29 @@ asdk_errorcode_t asdk_external_eeprom_init(uint8_t eeprom_index, asdk_external_e
 		break;
 	}
 
-	/* Copy EEPROM configuration to global variable */
+	/* Copy EEPROM configuration to global variable and reset the transaction queue */
+	memset(&g_ext_eeprom[eeprom_index], 0, sizeof(ext_eeprom_t));
 	memcpy(&g_ext_eeprom[eeprom_index].eeprom_config, eeprom_config, sizeof(asdk_external_eeprom_config_t));
 
-	g_ext_eeprom[eeprom_index].read_complete = g_ext_eeprom[eeprom_index].write_complete = true;
-
 	return ret_val;
 }
 
 asdk_errorcode_t asdk_external_eeprom_non_blocking_read(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
 														uint32_t length)
 {
-	if ((g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes - 1) <= eeprom_addr)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS;
-
-	if (g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes < (eeprom_addr + length))
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH;
-
-	if (NULL == buff)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER;
-
-	if (g_ext_eeprom[eeprom_index].eeprom_read_mgr.is_op_pending == true)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY;
-
-	if (eeprom_index >= ASDK_EXTERNAL_EEPROM_MAX)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX;
-
-	g_ext_eeprom[eeprom_index].eeprom_read_mgr.address = eeprom_addr;
-	g_ext_eeprom[eeprom_index].eeprom_read_mgr.buffer = buff;
-	g_ext_eeprom[eeprom_index].eeprom_read_mgr.length =
-		g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes -
-		(g_ext_eeprom[eeprom_index].eeprom_read_mgr.address % g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes);
-
-	/* Check if read length is less than data length to be read */
-	if (length < g_ext_eeprom[eeprom_index].eeprom_read_mgr.length)
-		g_ext_eeprom[eeprom_index].eeprom_read_mgr.length = length;
-
-	g_ext_eeprom[eeprom_index].eeprom_read_mgr.bytes_remaining =
-		length - g_ext_eeprom[eeprom_index].eeprom_read_mgr.length;
-	g_ext_eeprom[eeprom_index].eeprom_read_mgr.is_op_pending = true;
-
-	return ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
+	return __asdk_external_eeprom_enqueue(eeprom_index, true, eeprom_addr, buff, length, NULL);
 }
 
 asdk_errorcode_t asdk_external_eeprom_blocking_read(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
 													uint32_t length, uint16_t wait_time_ms)
 {
-	asdk_errorcode_t ret_val = ASDK_ERROR;
-	eeprom_manager_t eeprom_read_mgr = { 0 };
-	int32_t start_time_ms = asdk_sys_get_time_ms();
-
-	if ((g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes - 1) <= eeprom_addr)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS;
-
-	if (g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes < (eeprom_addr + length))
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH;
-
-	if (NULL == buff)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER;
-
-	if (start_time_ms < 0)
-		return ASDK_SYS_ERROR_TIMER_INIT_FAILED;
-
-	if (eeprom_index >= ASDK_EXTERNAL_EEPROM_MAX)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX;
-
-	eeprom_read_mgr.address = eeprom_addr;
-	eeprom_read_mgr.buffer = buff;
-	eeprom_read_mgr.length = g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes -
-							 (eeprom_read_mgr.address % g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes);
-
-	/* Check if read length is less than data length to be read */
-	if (eeprom_read_mgr.length > length)
-		eeprom_read_mgr.length = length;
-
-	eeprom_read_mgr.bytes_remaining = length - eeprom_read_mgr.length;
-	eeprom_read_mgr.is_op_pending = true;
-
-	while (eeprom_read_mgr.is_op_pending == true) {
-		ret_val =
-			__asdk_external_eeprom_page_read(eeprom_index, eeprom_read_mgr.address,
-											 (eeprom_read_mgr.buffer + eeprom_read_mgr.index), eeprom_read_mgr.length);
-		ASDK_DEV_ERROR_RETURN(ret_val, ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS);
-
-		while ((g_ext_eeprom[eeprom_index].read_complete != true) &&
-			   (asdk_sys_get_time_ms() < start_time_ms + wait_time_ms))
-			;
-
-		if (asdk_sys_get_time_ms() > start_time_ms + wait_time_ms)
-			return ASDK_MW_EXTERNAL_EEPROM_ERROR_TIMEOUT;
-
-		eeprom_read_mgr.index += eeprom_read_mgr.length;
-		eeprom_read_mgr.address += eeprom_read_mgr.length;
-		eeprom_read_mgr.length =
-			(eeprom_read_mgr.bytes_remaining >= g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes)
-				? g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes
-				: eeprom_read_mgr.bytes_remaining;
-		eeprom_read_mgr.bytes_remaining -= eeprom_read_mgr.length;
-
-		if ((eeprom_read_mgr.bytes_remaining == 0) && (eeprom_read_mgr.length == 0))
-			eeprom_read_mgr.is_op_pending = false;
-	}
-
-	return ret_val;
+	return __asdk_external_eeprom_blocking(eeprom_index, true, eeprom_addr, buff, length, wait_time_ms);
 }
 
 asdk_errorcode_t asdk_external_eeprom_non_blocking_write(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
 														 uint32_t length)
 {
-	if ((g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes - 1) <= eeprom_addr)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS;
-
-	if (g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes < (eeprom_addr + length))
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH;
-
-	if (NULL == buff)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER;
-
-	if (true == g_ext_eeprom[eeprom_index].eeprom_write_mgr.is_op_pending)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY;
-
-	if (eeprom_index >= ASDK_EXTERNAL_EEPROM_MAX)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX;
-
-	g_ext_eeprom[eeprom_index].eeprom_write_mgr.address = eeprom_addr;
-	g_ext_eeprom[eeprom_index].eeprom_write_mgr.buffer = buff;
-	g_ext_eeprom[eeprom_index].eeprom_write_mgr.length = g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes -
-														 (g_ext_eeprom[eeprom_index].eeprom_write_mgr.address %
-														  g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes);
-
-	/* Check if write length is less than data length to be written */
-	if (length < g_ext_eeprom[eeprom_index].eeprom_write_mgr.length)
-		g_ext_eeprom[eeprom_index].eeprom_write_mgr.length = length;
-
-	g_ext_eeprom[eeprom_index].eeprom_write_mgr.bytes_remaining =
-		length - g_ext_eeprom[eeprom_index].eeprom_write_mgr.length;
-	g_ext_eeprom[eeprom_index].eeprom_write_mgr.is_op_pending = true;
-
-	return ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
+	return __asdk_external_eeprom_enqueue(eeprom_index, false, eeprom_addr, buff, length, NULL);
 }
 
 /*!
@@ -434,126 +552,67 @@ asdk_errorcode_t asdk_external_eeprom_non_blocking_write(uint8_t eeprom_index, u
 asdk_errorcode_t asdk_external_eeprom_blocking_write(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
 													 uint32_t length, uint16_t wait_time_ms)
 {
-	asdk_errorcode_t ret_val = ASDK_ERROR;
-	eeprom_manager_t eeprom_write_mgr = { 0 };
-	int32_t start_time_ms = asdk_sys_get_time_ms();
-
-	if ((g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes - 1) <= eeprom_addr)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS;
+	return __asdk_external_eeprom_blocking(eeprom_index, false, eeprom_addr, buff, length, wait_time_ms);
+}
 
-	if (g_ext_eeprom[eeprom_index].eeprom_config.memory_size_bytes < (eeprom_addr + length))
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH;
+asdk_errorcode_t asdk_external_eeprom_queue_read(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
+												 uint32_t length, asdk_external_eeprom_transaction_cb_t callback)
+{
+	return __asdk_external_eeprom_enqueue(eeprom_index, true, eeprom_addr, buff, length, callback);
+}
 
-	if (NULL == buff)
-		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER;
+asdk_errorcode_t asdk_external_eeprom_queue_write(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
+												  uint32_t length, asdk_external_eeprom_transaction_cb_t callback)
+{
+	return __asdk_external_eeprom_enqueue(eeprom_index, false, eeprom_addr, buff, length, callback);
+}
 
-	if (start_time_ms < 0)
-		return ASDK_SYS_ERROR_TIMER_INIT_FAILED;
+/*!
+ * @note Only acts while the engine is idle or polling, i.e. when no I2C interrupt is pending.
+ */
+asdk_errorcode_t asdk_external_eeprom_iteration(uint8_t eeprom_index)
+{
+	ext_eeprom_t *eeprom;
 
 	if (eeprom_index >= ASDK_EXTERNAL_EEPROM_MAX)
 		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX;
 
-	eeprom_write_mgr.address = eeprom_addr;
-	eeprom_write_mgr.buffer = buff;
-	eeprom_write_mgr.length = g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes -
-							  (eeprom_write_mgr.address % g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes);
-
-	/* Check if write length is less than data length to be written */
-	if (eeprom_write_mgr.length > length)
-		eeprom_write_mgr.length = length;
-
-	eeprom_write_mgr.bytes_remaining = length - eeprom_write_mgr.length;
-	eeprom_write_mgr.is_op_pending = true;
-
-	while (eeprom_write_mgr.is_op_pending == true) {
-		ret_val = __asdk_external_eeprom_page_write(eeprom_index, eeprom_write_mgr.address,
-													(eeprom_write_mgr.buffer + eeprom_write_mgr.index),
-													eeprom_write_mgr.length);
-		ASDK_DEV_ERROR_RETURN(ret_val, ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS);
-
-		while ((g_ext_eeprom[eeprom_index].write_complete != true) &&
-			   (asdk_sys_get_time_ms() < start_time_ms + wait_time_ms))
-			;
-
-		if (asdk_sys_get_time_ms() > start_time_ms + wait_time_ms)
-			return ASDK_MW_EXTERNAL_EEPROM_ERROR_TIMEOUT;
-
-		eeprom_write_mgr.index += eeprom_write_mgr.length;
-		eeprom_write_mgr.address += eeprom_write_mgr.length;
-		eeprom_write_mgr.length =
-			(eeprom_write_mgr.bytes_remaining >= g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes)
-				? g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes
-				: eeprom_write_mgr.bytes_remaining;
-		eeprom_write_mgr.bytes_remaining -= eeprom_write_mgr.length;
-
-		if ((eeprom_write_mgr.bytes_remaining == 0) && (eeprom_write_mgr.length == 0))
-			eeprom_write_mgr.is_op_pending = false;
+	eeprom = &g_ext_eeprom[eeprom_index];
+
+	switch (eeprom->state) {
+	case EEPROM_ENGINE_IDLE:
+		if (eeprom->queue_head != eeprom->queue_tail)
+			__asdk_external_eeprom_start_next(eeprom_index);
+		break;
+
+	case EEPROM_ENGINE_POLL:
+		if ((true == eeprom->queue[EEPROM_QUEUE_SLOT(eeprom->queue_head)].is_cancelled) ||
+			(asdk_sys_get_time_ms() > eeprom->poll_start_ms + ASDK_EXTERNAL_EEPROM_ACK_POLL_TIMEOUT_MS)) {
+			__asdk_external_eeprom_complete(eeprom_index, ASDK_EXTERNAL_EEPROM_STATUS_ERROR);
+			__asdk_external_eeprom_start_next(eeprom_index);
+		} else {
+			__asdk_external_eeprom_launch(eeprom_index);
+		}
+		break;
+
+	default:
+		break;
 	}
 
-	return ret_val;
+	return ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
 }
 
-/*!
- * @note If calling frequency is more than EEPROM's write cycle time,
- * then this API shall be blocked for previous write cycle to finish.
- */
-asdk_errorcode_t asdk_external_eeprom_iteration(uint8_t eeprom_index)
+asdk_errorcode_t asdk_external_eeprom_get_stats(uint8_t eeprom_index, asdk_external_eeprom_stats_t *stats)
 {
-	asdk_errorcode_t ret_val = ASDK_ERROR;
-
 	if (eeprom_index >= ASDK_EXTERNAL_EEPROM_MAX)
 		return ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX;
 
-	if (true == g_ext_eeprom[eeprom_index].eeprom_write_mgr.is_op_pending) {
-		ret_val = __asdk_external_eeprom_page_write(
-			eeprom_index, g_ext_eeprom[eeprom_index].eeprom_write_mgr.address,
-			(g_ext_eeprom[eeprom_index].eeprom_write_mgr.buffer + g_ext_eeprom[eeprom_index].eeprom_write_mgr.index),
-			g_ext_eeprom[eeprom_index].eeprom_write_mgr.length);
-		ASDK_DEV_ERROR_RETURN(ret_val, ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS);
-
-		g_ext_eeprom[eeprom_index].eeprom_write_mgr.index += g_ext_eeprom[eeprom_index].eeprom_write_mgr.length;
-		g_ext_eeprom[eeprom_index].eeprom_write_mgr.address += g_ext_eeprom[eeprom_index].eeprom_write_mgr.length;
-		g_ext_eeprom[eeprom_index].eeprom_write_mgr.length =
-			(g_ext_eeprom[eeprom_index].eeprom_write_mgr.bytes_remaining >=
-			 g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes)
-				? g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes
-				: g_ext_eeprom[eeprom_index].eeprom_write_mgr.bytes_remaining;
-		g_ext_eeprom[eeprom_index].eeprom_write_mgr.bytes_remaining -=
-			g_ext_eeprom[eeprom_index].eeprom_write_mgr.length;
-
-		if ((0 == g_ext_eeprom[eeprom_index].eeprom_write_mgr.bytes_remaining) &&
-			(0 == g_ext_eeprom[eeprom_index].eeprom_write_mgr.length)) {
-			g_ext_eeprom[eeprom_index].eeprom_write_mgr.buffer = NULL;
-			g_ext_eeprom[eeprom_index].eeprom_write_mgr.address = ~0;
-			g_ext_eeprom[eeprom_index].eeprom_write_mgr.index = 0;
-			g_ext_eeprom[eeprom_index].eeprom_write_mgr.is_op_pending = false;
-			g_ext_eeprom[eeprom_index].eeprom_write_mgr.is_cb_pending = true;
-		}
-	} else if (g_ext_eeprom[eeprom_index].eeprom_read_mgr.is_op_pending == true) {
-		ret_val = __asdk_external_eeprom_page_read(
-			eeprom_index, g_ext_eeprom[eeprom_index].eeprom_read_mgr.address,
-			(g_ext_eeprom[eeprom_index].eeprom_read_mgr.buffer + g_ext_eeprom[eeprom_index].eeprom_read_mgr.index),
-			g_ext_eeprom[eeprom_index].eeprom_read_mgr.length);
-		ASDK_DEV_ERROR_RETURN(ret_val, ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS);
-
-		g_ext_eeprom[eeprom_index].eeprom_read_mgr.index += g_ext_eeprom[eeprom_index].eeprom_read_mgr.length;
-		g_ext_eeprom[eeprom_index].eeprom_read_mgr.address += g_ext_eeprom[eeprom_index].eeprom_read_mgr.length;
-		g_ext_eeprom[eeprom_index].eeprom_read_mgr.length =
-			(g_ext_eeprom[eeprom_index].eeprom_read_mgr.bytes_remaining >=
-			 g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes)
-				? g_ext_eeprom[eeprom_index].eeprom_config.page_size_bytes
-				: g_ext_eeprom[eeprom_index].eeprom_read_mgr.bytes_remaining;
-		g_ext_eeprom[eeprom_index].eeprom_read_mgr.bytes_remaining -= g_ext_eeprom[eeprom_index].eeprom_read_mgr.length;
-
-		if ((g_ext_eeprom[eeprom_index].eeprom_read_mgr.bytes_remaining == 0) &&
-			(g_ext_eeprom[eeprom_index].eeprom_read_mgr.length == 0)) {
-			g_ext_eeprom[eeprom_index].eeprom_read_mgr.buffer = NULL;
-			g_ext_eeprom[eeprom_index].eeprom_read_mgr.address = ~0;
-			g_ext_eeprom[eeprom_index].eeprom_read_mgr.index = 0;
-			g_ext_eeprom[eeprom_index].eeprom_read_mgr.is_op_pending = false;
-			g_ext_eeprom[eeprom_index].eeprom_read_mgr.is_cb_pending = true;
-		}
-	}
+	if (NULL == stats)
+		return ASDK_MW_EXTERNAL_EEPROM_ERROR_NULL_PTR;
 
-	return ret_val;
+	asdk_sys_disable_interrupts();
+	*stats = g_ext_eeprom[eeprom_index].stats;
+	asdk_sys_enable_interrupts();
+
+	return ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS;
 }
@@ -44,6 +44,16 @@
 #define ASDK_EXTERNAL_EEPROM_MAX 1U
 #endif
 
+/* Transactions queued per EEPROM instance, must be a power of 2 */
+#ifndef ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH
+#define ASDK_EXTERNAL_EEPROM_QUEUE_DEPTH 8U
+#endif
+
+/* Longest write cycle tolerated while ACK-polling, in milliseconds */
+#ifndef ASDK_EXTERNAL_EEPROM_ACK_POLL_TIMEOUT_MS
+#define ASDK_EXTERNAL_EEPROM_ACK_POLL_TIMEOUT_MS 20U
+#endif
+
 /*==============================================================================
 
 					  DEFINITIONS AND TYPES : ENUMS
@@ -66,6 +76,7 @@ typedef enum {
 typedef enum {
 	ASDK_EXTERNAL_EEPROM_STATUS_WRITE_COMPLETE = 0,
 	ASDK_EXTERNAL_EEPROM_STATUS_READ_COMPLETE,
+	ASDK_EXTERNAL_EEPROM_STATUS_ERROR, /* Transaction aborted on a bus error, ACK-poll timeout or cancel */
 	ASDK_EXTERNAL_EEPROM_STATUS_MAX,
 	ASDK_EXTERNAL_EEPROM_STATUS_UNDEFINED = ASDK_EXTERNAL_EEPROM_STATUS_MAX,
 } asdk_external_eeprom_status_t;
@@ -94,6 +105,19 @@ typedef union {
  */
 typedef void (*asdk_external_eeprom_callback_fun_t)(asdk_external_eeprom_status_t status);
 
+/*!
+ * @brief Completion callback of a queued transaction, called from the I2C interrupt
+ * or from asdk_external_eeprom_iteration().
+ *
+ * @param [in] eeprom_index Index of external EEPROM.
+ * @param [in] status Completion status of the transaction.
+ * @param [in] eeprom_addr EEPROM address the transaction started at.
+ * @param [in] buff Application buffer of the transaction.
+ * @param [in] length Number of bytes transferred.
+ */
+typedef void (*asdk_external_eeprom_transaction_cb_t)(uint8_t eeprom_index, asdk_external_eeprom_status_t status,
+													  uint32_t eeprom_addr, void *buff, uint32_t length);
+
 /*!
  * @brief An data structure for External EEPROM configuration.
  * @note Currently only supports I2C protocol.
@@ -115,6 +139,20 @@ typedef struct {
 	asdk_external_eeprom_callback_fun_t eeprom_user_callback; /* Callback function for External EEPROM  */
 } asdk_external_eeprom_config_t;
 
+/*!
+ * @brief Transfer counters of an External EEPROM instance, see asdk_external_eeprom_get_stats().
+ *
+ * Implements : asdk_external_eeprom_stats_t
+ */
+typedef struct {
+	uint32_t bytes_written;	 /* Data bytes acknowledged by the EEPROM */
+	uint32_t bytes_read;	 /* Data bytes read from the EEPROM */
+	uint32_t transactions;	 /* Transactions completed, including failed ones */
+	uint32_t transfers;		 /* I2C transfers issued, ACK-polls included */
+	uint32_t ack_polls;		 /* Transfers NACKed by the EEPROM during its write cycle */
+	uint32_t errors;		 /* Transactions completed with ASDK_EXTERNAL_EEPROM_STATUS_ERROR */
+} asdk_external_eeprom_stats_t;
+
 /*==============================================================================
 
 						   EXTERNAL DECLARATIONS
@@ -151,7 +189,9 @@ asdk_errorcode_t asdk_external_eeprom_init(uint8_t eeprom_index, asdk_external_e
 /*!
   @brief
   This fucntion reads data from External EEPROM in a non-blocking manner.
-  @note Call asdk_external_eeprom_iteration() in a loop for completing this read operation.
+  @note Queued like asdk_external_eeprom_queue_read(), completion is reported through
+		eeprom_user_callback of the configuration. Keep calling asdk_external_eeprom_iteration()
+		until then.
 
   @param uint8_t eeprom_index - Index of external EEPROM.
   @param uint32_t eeprom_addr - EEPROM address to be read.
@@ -163,7 +203,7 @@ asdk_errorcode_t asdk_external_eeprom_init(uint8_t eeprom_index, asdk_external_e
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER
-  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY when the transaction queue is full
 */
 asdk_errorcode_t asdk_external_eeprom_non_blocking_read(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
 														uint32_t length);
@@ -174,6 +214,9 @@ asdk_errorcode_t asdk_external_eeprom_non_blocking_read(uint8_t eeprom_index, ui
 /*!
   @brief
   This fucntion reads data from External EEPROM in a blocking manner.
+  @note Waits for the transactions queued before it. On timeout the read is cancelled
+		at the next page boundary and the function returns once the page on the bus is
+		done, buff is no longer used after it returns.
 
   @param uint8_t eeprom_index - Index of external EEPROM.
   @param uint32_t eeprom_addr - EEPROM address to be read.
@@ -186,7 +229,9 @@ asdk_errorcode_t asdk_external_eeprom_non_blocking_read(uint8_t eeprom_index, ui
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER
-  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY when the transaction queue is full
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_TIMEOUT
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_TRANSFER_FAILED
 */
 asdk_errorcode_t asdk_external_eeprom_blocking_read(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
 													uint32_t length, uint16_t wait_time_ms);
@@ -197,8 +242,11 @@ asdk_errorcode_t asdk_external_eeprom_blocking_read(uint8_t eeprom_index, uint32
 /*!
   @brief
   This function wirtes data to External EEPROM in a non-blocking manner.
-  @note Call asdk_external_eeprom_iteration() in a loop for completing this write operation.
+  @note Queued like asdk_external_eeprom_queue_write(), completion is reported through
+		eeprom_user_callback of the configuration. Keep calling asdk_external_eeprom_iteration()
+		until then.
 
+  @param uint8_t eeprom_index - Index of external EEPROM.
   @param uint32_t eeprom_addr - EEPROM address to be written.
   @param uint8_t *buff - Pointer to the buffer containing the data to be written.
   @param uint32_t length - Number of bytes to be written.
@@ -208,7 +256,7 @@ asdk_errorcode_t asdk_external_eeprom_blocking_read(uint8_t eeprom_index, uint32
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER
-  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY when the transaction queue is full
 */
 asdk_errorcode_t asdk_external_eeprom_non_blocking_write(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
 														 uint32_t length);
@@ -219,6 +267,9 @@ asdk_errorcode_t asdk_external_eeprom_non_blocking_write(uint8_t eeprom_index, u
 /*!
   @brief
   This function wirtes data to External EEPROM in a blocking manner.
+  @note Waits for the transactions queued before it. On timeout the write is cancelled
+		at the next page boundary and the function returns once the page on the bus is
+		done, buff is no longer used after it returns.
 
   @param uint8_t eeprom_index - Index of external EEPROM.
   @param uint32_t eeprom_addr - EEPROM address to be written.
@@ -231,7 +282,9 @@ asdk_errorcode_t asdk_external_eeprom_non_blocking_write(uint8_t eeprom_index, u
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER
-  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY when the transaction queue is full
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_TIMEOUT
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_TRANSFER_FAILED
 */
 asdk_errorcode_t asdk_external_eeprom_blocking_write(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
 													 uint32_t length, uint16_t wait_time_ms);
@@ -241,18 +294,86 @@ asdk_errorcode_t asdk_external_eeprom_blocking_write(uint8_t eeprom_index, uint3
 /*----------------------------------------------------------------------------*/
 /*!
   @brief
-  This function writes and read data pending in the global write buffer to External EEPROM
-  and from EEPROM to user read buffer.
+  This function services the transaction queue: it starts the next transaction when
+  the bus is idle and retries the page the EEPROM NACKed during its write cycle.
+  Page transfers chain from the I2C interrupt, so the calling rate only bounds how
+  fast an ACK-poll is retried.
+
+  @param uint8_t eeprom_index - Index of external EEPROM.
+
+  @return asdk_errorcode_t - Error code.
+  @retval ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX
+*/
+asdk_errorcode_t asdk_external_eeprom_iteration(uint8_t eeprom_index);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_external_eeprom_queue_read */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function queues a read of any length. It is split at page boundaries and
+  completes through the callback once the last page is read.
+
+  @param uint8_t eeprom_index - Index of external EEPROM.
+  @param uint32_t eeprom_addr - EEPROM address to be read.
+  @param void *buff - Buffer to store the read data, owned by the queue until completion.
+  @param uint32_t length - Number of bytes to be read.
+  @param asdk_external_eeprom_transaction_cb_t callback - Completion callback, may be NULL.
+
+  @return asdk_errorcode_t - Error code.
+  @retval ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY when the transaction queue is full
+*/
+asdk_errorcode_t asdk_external_eeprom_queue_read(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
+												 uint32_t length, asdk_external_eeprom_transaction_cb_t callback);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_external_eeprom_queue_write */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function queues a write of any length. It is split at page boundaries, each
+  page is prepared while the EEPROM is still busy with the previous write cycle and
+  is ACK-polled onto the bus as soon as the EEPROM accepts it.
 
   @param uint8_t eeprom_index - Index of external EEPROM.
+  @param uint32_t eeprom_addr - EEPROM address to be written.
+  @param void *buff - Data to be written, owned by the queue until completion.
+  @param uint32_t length - Number of bytes to be written.
+  @param asdk_external_eeprom_transaction_cb_t callback - Completion callback, may be NULL.
 
   @return asdk_errorcode_t - Error code.
   @retval ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS
-  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_ADDRESS
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_LENGTH
   @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_BUFFER
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_BUSY when the transaction queue is full
 */
-asdk_errorcode_t asdk_external_eeprom_iteration(uint8_t eeprom_index);
+asdk_errorcode_t asdk_external_eeprom_queue_write(uint8_t eeprom_index, uint32_t eeprom_addr, void *buff,
+												  uint32_t length, asdk_external_eeprom_transaction_cb_t callback);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_external_eeprom_get_stats */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  This function copies the transfer counters of an EEPROM instance, for throughput
+  and write cycle measurements.
+
+  @param uint8_t eeprom_index - Index of external EEPROM.
+  @param asdk_external_eeprom_stats_t *stats - Counters since init.
+
+  @return asdk_errorcode_t - Error code.
+  @retval ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_INVALID_INDEX
+  @retval ASDK_MW_EXTERNAL_EEPROM_ERROR_NULL_PTR
+*/
+asdk_errorcode_t asdk_external_eeprom_get_stats(uint8_t eeprom_index, asdk_external_eeprom_stats_t *stats);
 
 #endif /* ASDK_EXTERNAL_EEPROM_H */
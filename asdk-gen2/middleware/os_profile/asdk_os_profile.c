@@ -0,0 +1,594 @@
+/*
+    @file
+    asdk_os_profile.c
+
+    @path
+    asdk-gen2/middleware/os_profile/asdk_os_profile.c
+
+    @Created on
+    Oct 17, 2026
+
+    @Author
+    Ather Energy Pvt Ltd.
+
+    @Copyright
+    Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+    @brief
+    This file implements the RTOS profiling module for Ather SDK (asdk)
+
+*/
+
+/*==============================================================================
+
+                           INCLUDE FILES
+
+==============================================================================*/
+
+/* standard includes ************************* */
+
+#include <string.h>
+
+/* asdk includes ***************************** */
+
+#include "asdk_error.h"
+
+/* middleware includes *********************** */
+
+#include "asdk_os_profile.h"
+
+/* rtos includes ***************************** */
+
+#include "os.h"
+
+/*==============================================================================
+
+                      LOCAL DEFINITIONS AND TYPES : MACROS
+
+==============================================================================*/
+
+/* the kernel computes per task usage and stack itself only with its debug list */
+#if (OS_CFG_DBG_EN == 0u) && (OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_APP_HOOKS_EN > 0u)
+#define OS_PROFILE_STAT_HOOK_EN 1
+#else
+#define OS_PROFILE_STAT_HOOK_EN 0
+#endif
+
+/*==============================================================================
+
+                        LOCAL AND EXTERNAL DEFINITIONS
+
+==============================================================================*/
+
+/* static variables ************************** */
+
+static OS_TCB *os_profile_tasks[ASDK_OS_PROFILE_TASK_MAX];
+
+#if (OS_CFG_APP_HOOKS_EN > 0u)
+static OS_APP_HOOK_TCB os_profile_prev_create_hook;
+static OS_APP_HOOK_TCB os_profile_prev_del_hook;
+#if (OS_PROFILE_STAT_HOOK_EN > 0)
+static OS_APP_HOOK_VOID os_profile_prev_stat_hook;
+#endif
+#endif
+
+/* ISR timing, in OS_TS_GET() counts */
+static volatile uint8_t os_profile_isr_nesting;
+static CPU_TS os_profile_isr_start;
+static uint8_t os_profile_isr_nesting_max;
+static uint32_t os_profile_isr_count;
+static uint32_t os_profile_isr_time_total;
+static uint32_t os_profile_isr_time_max;
+
+/* serialized frame, see asdk_os_profile_dump() */
+static uint8_t os_profile_dump_buffer[ASDK_OS_PROFILE_DUMP_MAX_SIZE];
+
+/*==============================================================================
+
+                        LOCAL FUNCTION PROTOTYPES
+
+==============================================================================*/
+
+static asdk_errorcode_t __os_profile_add_task(OS_TCB *p_tcb);
+static void __os_profile_remove_task(OS_TCB *p_tcb);
+static void __os_profile_fill_task(OS_TCB *p_tcb, asdk_os_profile_task_t *task);
+static uint8_t *__os_profile_put_u16(uint8_t *p, uint16_t value);
+static uint8_t *__os_profile_put_u32(uint8_t *p, uint32_t value);
+static uint16_t __os_profile_fletcher16(const uint8_t *data, uint32_t len);
+
+#if (OS_CFG_APP_HOOKS_EN > 0u)
+static void __os_profile_task_create_hook(OS_TCB *p_tcb);
+static void __os_profile_task_del_hook(OS_TCB *p_tcb);
+#if (OS_PROFILE_STAT_HOOK_EN > 0)
+static void __os_profile_stat_hook(void);
+#endif
+#endif
+
+/*==============================================================================
+
+                        EXTERNAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+asdk_errorcode_t asdk_os_profile_init(void)
+{
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    memset(os_profile_tasks, 0, sizeof(os_profile_tasks));
+
+#if (OS_CFG_APP_HOOKS_EN > 0u)
+    /* chain, the application may have installed its own hooks */
+    if (OS_AppTaskCreateHookPtr != __os_profile_task_create_hook)
+    {
+        os_profile_prev_create_hook = OS_AppTaskCreateHookPtr;
+        OS_AppTaskCreateHookPtr = __os_profile_task_create_hook;
+    }
+    if (OS_AppTaskDelHookPtr != __os_profile_task_del_hook)
+    {
+        os_profile_prev_del_hook = OS_AppTaskDelHookPtr;
+        OS_AppTaskDelHookPtr = __os_profile_task_del_hook;
+    }
+#if (OS_PROFILE_STAT_HOOK_EN > 0)
+    if (OS_AppStatTaskHookPtr != __os_profile_stat_hook)
+    {
+        os_profile_prev_stat_hook = OS_AppStatTaskHookPtr;
+        OS_AppStatTaskHookPtr = __os_profile_stat_hook;
+    }
+#endif
+#endif
+    CPU_CRITICAL_EXIT();
+
+    asdk_os_profile_reset();
+
+    /* kernel tasks are created by OSInit() */
+    (void)__os_profile_add_task(&OSIdleTaskTCB);
+#if (OS_CFG_STAT_TASK_EN > 0u)
+    (void)__os_profile_add_task(&OSStatTaskTCB);
+#endif
+#if (OS_CFG_TMR_EN > 0u)
+    (void)__os_profile_add_task(&OSTmrTaskTCB);
+#endif
+
+    return ASDK_MW_OS_PROFILE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_os_profile_register_task(OS_TCB *p_tcb)
+{
+    if (NULL == p_tcb)
+    {
+        return ASDK_MW_OS_PROFILE_ERROR_NULL_PTR;
+    }
+
+    return __os_profile_add_task(p_tcb);
+}
+
+void asdk_os_profile_isr_enter(void)
+{
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    if (0 == os_profile_isr_nesting)
+    {
+        os_profile_isr_start = OS_TS_GET();
+        os_profile_isr_count++;
+    }
+
+    if (os_profile_isr_nesting < UINT8_MAX)
+    {
+        os_profile_isr_nesting++;
+    }
+
+    if (os_profile_isr_nesting_max < os_profile_isr_nesting)
+    {
+        os_profile_isr_nesting_max = os_profile_isr_nesting;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+void asdk_os_profile_isr_exit(void)
+{
+    CPU_TS isr_time;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    if (os_profile_isr_nesting > 0)
+    {
+        os_profile_isr_nesting--;
+
+        if (0 == os_profile_isr_nesting)
+        {
+            isr_time = OS_TS_GET() - os_profile_isr_start;
+            os_profile_isr_time_total += (uint32_t)isr_time;
+
+            if (os_profile_isr_time_max < (uint32_t)isr_time)
+            {
+                os_profile_isr_time_max = (uint32_t)isr_time;
+            }
+        }
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+asdk_errorcode_t asdk_os_profile_get_system(asdk_os_profile_system_t *system)
+{
+#if (OS_CFG_TS_EN > 0u)
+    CPU_ERR cpu_err;
+#endif
+    CPU_SR_ALLOC();
+
+    if (NULL == system)
+    {
+        return ASDK_MW_OS_PROFILE_ERROR_NULL_PTR;
+    }
+
+    memset(system, 0, sizeof(asdk_os_profile_system_t));
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_STAT_TASK_EN > 0u)
+    system->cpu_usage = OSStatTaskCPUUsage;
+    system->cpu_usage_max = OSStatTaskCPUUsageMax;
+#endif
+#if (OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u)
+    system->ctx_sw_count = OSTaskCtxSwCtr;
+#endif
+    system->task_count = OSTaskQty;
+    system->isr_nesting_max = os_profile_isr_nesting_max;
+    system->isr_count = os_profile_isr_count;
+    system->isr_time_total = os_profile_isr_time_total;
+    system->isr_time_max = os_profile_isr_time_max;
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
+    system->isr_stk_used = OSISRStkUsed * sizeof(CPU_STK);
+    system->isr_stk_free = OSISRStkFree * sizeof(CPU_STK);
+#endif
+    CPU_CRITICAL_EXIT();
+
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    system->int_dis_time_max = (uint32_t)CPU_IntDisMeasMaxGet();
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    system->ts_freq_hz = CPU_TS_TmrFreqGet(&cpu_err);
+    if (CPU_ERR_NONE != cpu_err)
+    {
+        system->ts_freq_hz = 0;
+    }
+#endif
+
+    return ASDK_MW_OS_PROFILE_SUCCESS;
+}
+
+asdk_errorcode_t asdk_os_profile_get_tasks(asdk_os_profile_task_t *tasks, uint8_t max_tasks, uint8_t *num_tasks)
+{
+    uint8_t count = 0;
+    CPU_SR_ALLOC();
+
+    if ((NULL == tasks) || (NULL == num_tasks))
+    {
+        return ASDK_MW_OS_PROFILE_ERROR_NULL_PTR;
+    }
+
+    CPU_CRITICAL_ENTER();
+    for (uint8_t i = 0; (i < ASDK_OS_PROFILE_TASK_MAX) && (count < max_tasks); i++)
+    {
+        if (NULL != os_profile_tasks[i])
+        {
+            __os_profile_fill_task(os_profile_tasks[i], &tasks[count]);
+            count++;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    *num_tasks = count;
+
+    return ASDK_MW_OS_PROFILE_SUCCESS;
+}
+
+void asdk_os_profile_reset(void)
+{
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    os_profile_isr_nesting_max = os_profile_isr_nesting;
+    os_profile_isr_count = 0;
+    os_profile_isr_time_total = 0;
+    os_profile_isr_time_max = 0;
+
+    for (uint8_t i = 0; i < ASDK_OS_PROFILE_TASK_MAX; i++)
+    {
+        if (NULL != os_profile_tasks[i])
+        {
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+            os_profile_tasks[i]->CPUUsageMax = 0;
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+            os_profile_tasks[i]->IntDisTimeMax = 0;
+#endif
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_STAT_TASK_EN > 0u)
+    OSStatResetFlag = DEF_TRUE;
+#endif
+}
+
+asdk_errorcode_t asdk_os_profile_dump(asdk_os_profile_write_t write)
+{
+    asdk_os_profile_system_t system;
+    asdk_os_profile_task_t task;
+    uint8_t *p = os_profile_dump_buffer;
+    uint8_t num_tasks = 0;
+    uint16_t payload_len = 0;
+    uint16_t checksum = 0;
+    uint32_t frame_len = 0;
+    CPU_SR_ALLOC();
+
+    if (NULL == write)
+    {
+        return ASDK_MW_OS_PROFILE_ERROR_NULL_PTR;
+    }
+
+    (void)asdk_os_profile_get_system(&system);
+
+    /* header, task count and length are patched once the tasks are written */
+    *p++ = ASDK_OS_PROFILE_DUMP_SYNC_0;
+    *p++ = ASDK_OS_PROFILE_DUMP_SYNC_1;
+    *p++ = ASDK_OS_PROFILE_DUMP_VERSION;
+    p += 3;
+
+    p = __os_profile_put_u16(p, system.cpu_usage);
+    p = __os_profile_put_u16(p, system.cpu_usage_max);
+    p = __os_profile_put_u32(p, system.ctx_sw_count);
+    p = __os_profile_put_u16(p, system.task_count);
+    *p++ = system.isr_nesting_max;
+    p = __os_profile_put_u32(p, system.isr_count);
+    p = __os_profile_put_u32(p, system.isr_time_total);
+    p = __os_profile_put_u32(p, system.isr_time_max);
+    p = __os_profile_put_u32(p, system.int_dis_time_max);
+    p = __os_profile_put_u32(p, system.isr_stk_used);
+    p = __os_profile_put_u32(p, system.isr_stk_free);
+    p = __os_profile_put_u32(p, system.ts_freq_hz);
+
+    for (uint8_t i = 0; i < ASDK_OS_PROFILE_TASK_MAX; i++)
+    {
+        /* one task at a time, keeps the critical section short */
+        CPU_CRITICAL_ENTER();
+        if (NULL == os_profile_tasks[i])
+        {
+            CPU_CRITICAL_EXIT();
+            continue;
+        }
+        __os_profile_fill_task(os_profile_tasks[i], &task);
+        CPU_CRITICAL_EXIT();
+
+        memcpy(p, task.name, ASDK_OS_PROFILE_NAME_LEN);
+        p += ASDK_OS_PROFILE_NAME_LEN;
+        *p++ = task.prio;
+        p = __os_profile_put_u16(p, task.cpu_usage);
+        p = __os_profile_put_u16(p, task.cpu_usage_max);
+        p = __os_profile_put_u32(p, task.ctx_sw_count);
+        p = __os_profile_put_u32(p, task.stk_used);
+        p = __os_profile_put_u32(p, task.stk_free);
+        p = __os_profile_put_u32(p, task.int_dis_time_max);
+        num_tasks++;
+    }
+
+    payload_len = ASDK_OS_PROFILE_DUMP_SYSTEM_SIZE + (num_tasks * ASDK_OS_PROFILE_DUMP_TASK_SIZE);
+    os_profile_dump_buffer[3] = num_tasks;
+    (void)__os_profile_put_u16(&os_profile_dump_buffer[4], payload_len);
+
+    frame_len = ASDK_OS_PROFILE_DUMP_HEADER_SIZE + payload_len;
+    checksum = __os_profile_fletcher16(&os_profile_dump_buffer[2], frame_len - 2);
+    p = __os_profile_put_u16(p, checksum);
+    frame_len += ASDK_OS_PROFILE_DUMP_CRC_SIZE;
+
+    if (write(os_profile_dump_buffer, frame_len) != frame_len)
+    {
+        return ASDK_MW_OS_PROFILE_DUMP_TRUNCATED;
+    }
+
+    return ASDK_MW_OS_PROFILE_SUCCESS;
+}
+
+/*==============================================================================
+
+                        LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+static asdk_errorcode_t __os_profile_add_task(OS_TCB *p_tcb)
+{
+    asdk_errorcode_t ret = ASDK_MW_OS_PROFILE_TASK_TABLE_FULL;
+    int8_t free_slot = -1;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    for (uint8_t i = 0; i < ASDK_OS_PROFILE_TASK_MAX; i++)
+    {
+        if (p_tcb == os_profile_tasks[i])
+        {
+            /* already tracked */
+            free_slot = -1;
+            ret = ASDK_MW_OS_PROFILE_SUCCESS;
+            break;
+        }
+
+        if ((NULL == os_profile_tasks[i]) && (free_slot < 0))
+        {
+            free_slot = (int8_t)i;
+        }
+    }
+
+    if (free_slot >= 0)
+    {
+        os_profile_tasks[free_slot] = p_tcb;
+        ret = ASDK_MW_OS_PROFILE_SUCCESS;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return ret;
+}
+
+static void __os_profile_remove_task(OS_TCB *p_tcb)
+{
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    for (uint8_t i = 0; i < ASDK_OS_PROFILE_TASK_MAX; i++)
+    {
+        if (p_tcb == os_profile_tasks[i])
+        {
+            os_profile_tasks[i] = NULL;
+            break;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+/* called with interrupts disabled */
+static void __os_profile_fill_task(OS_TCB *p_tcb, asdk_os_profile_task_t *task)
+{
+    memset(task, 0, sizeof(asdk_os_profile_task_t));
+
+#if (OS_CFG_DBG_EN > 0u)
+    if (NULL != p_tcb->NamePtr)
+    {
+        strncpy(task->name, p_tcb->NamePtr, ASDK_OS_PROFILE_NAME_LEN);
+    }
+#endif
+    task->prio = (uint8_t)p_tcb->Prio;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    task->cpu_usage = p_tcb->CPUUsage;
+    task->cpu_usage_max = p_tcb->CPUUsageMax;
+    task->ctx_sw_count = p_tcb->CtxSwCtr;
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+    task->stk_used = p_tcb->StkUsed * sizeof(CPU_STK);
+    task->stk_free = p_tcb->StkFree * sizeof(CPU_STK);
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    task->int_dis_time_max = (uint32_t)p_tcb->IntDisTimeMax;
+#endif
+}
+
+static uint8_t *__os_profile_put_u16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+
+    return p + 2;
+}
+
+static uint8_t *__os_profile_put_u32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+
+    return p + 4;
+}
+
+static uint16_t __os_profile_fletcher16(const uint8_t *data, uint32_t len)
+{
+    uint16_t sum1 = 0;
+    uint16_t sum2 = 0;
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+
+    return (uint16_t)((sum2 << 8) | sum1);
+}
+
+#if (OS_CFG_APP_HOOKS_EN > 0u)
+
+static void __os_profile_task_create_hook(OS_TCB *p_tcb)
+{
+    (void)__os_profile_add_task(p_tcb);
+
+    if (NULL != os_profile_prev_create_hook)
+    {
+        os_profile_prev_create_hook(p_tcb);
+    }
+}
+
+static void __os_profile_task_del_hook(OS_TCB *p_tcb)
+{
+    __os_profile_remove_task(p_tcb);
+
+    if (NULL != os_profile_prev_del_hook)
+    {
+        os_profile_prev_del_hook(p_tcb);
+    }
+}
+
+#if (OS_PROFILE_STAT_HOOK_EN > 0)
+
+/* runs in the statistic task, does for the tracked tasks what the kernel
+   does for its debug list when OS_CFG_DBG_EN is set */
+static void __os_profile_stat_hook(void)
+{
+    OS_TCB *p_tcb;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    uint64_t cycles_total = 0;
+    OS_CPU_USAGE usage;
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+    OS_ERR err;
+#endif
+    CPU_SR_ALLOC();
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    for (uint8_t i = 0; i < ASDK_OS_PROFILE_TASK_MAX; i++)
+    {
+        p_tcb = os_profile_tasks[i];
+        if (NULL != p_tcb)
+        {
+            p_tcb->CyclesTotalPrev = p_tcb->CyclesTotal;
+            p_tcb->CyclesTotal = 0;
+            cycles_total += p_tcb->CyclesTotalPrev;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+
+    for (uint8_t i = 0; i < ASDK_OS_PROFILE_TASK_MAX; i++)
+    {
+        p_tcb = os_profile_tasks[i];
+        if (NULL == p_tcb)
+        {
+            continue;
+        }
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+        usage = 0;
+        if (cycles_total > 0)
+        {
+            usage = (OS_CPU_USAGE)(((uint64_t)p_tcb->CyclesTotalPrev * 10000u) / cycles_total);
+        }
+        p_tcb->CPUUsage = usage;
+        if (p_tcb->CPUUsageMax < usage)
+        {
+            p_tcb->CPUUsageMax = usage;
+        }
+#endif
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+        OSTaskStkChk(p_tcb, &p_tcb->StkFree, &p_tcb->StkUsed, &err);
+#endif
+    }
+
+    if (NULL != os_profile_prev_stat_hook)
+    {
+        os_profile_prev_stat_hook();
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,246 @@
+/*
+    @file
+    asdk_os_profile.h
+
+    @path
+    asdk-gen2/middleware/os_profile/asdk_os_profile.h
+
+    @Created on
+    Oct 17, 2026
+
+    @Author
+    Ather Energy Pvt Ltd.
+
+    @Copyright
+    Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+    @brief
+    This file prototypes the RTOS profiling module of asdk ( Ather SDK ).
+    It exposes the per-task statistics maintained by uC-OS3 (CPU usage,
+    stack usage, context switches) along with interrupt timing, and
+    serializes them into a compact binary frame for the debug UART.
+*/
+
+#ifndef ASDK_OS_PROFILE_H
+#define ASDK_OS_PROFILE_H
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+/* standard includes ************************* */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* asdk includes ***************************** */
+
+#include "asdk_error.h"
+
+/* rtos includes ***************************** */
+
+#include "os.h"
+
+/*==============================================================================
+
+                      DEFINITIONS AND TYPES : MACROS
+
+==============================================================================*/
+
+/* number of tasks tracked by the profiler, including the kernel tasks */
+#ifndef ASDK_OS_PROFILE_TASK_MAX
+#define ASDK_OS_PROFILE_TASK_MAX 16U
+#endif
+
+/* task name characters kept in a snapshot, not NUL terminated when full */
+#define ASDK_OS_PROFILE_NAME_LEN 8U
+
+/* binary dump framing, see asdk_os_profile_dump() */
+#define ASDK_OS_PROFILE_DUMP_SYNC_0 0xA5U
+#define ASDK_OS_PROFILE_DUMP_SYNC_1 0x5AU
+#define ASDK_OS_PROFILE_DUMP_VERSION 1U
+
+#define ASDK_OS_PROFILE_DUMP_HEADER_SIZE 6U  /* sync(2), version(1), task count(1), payload length(2) */
+#define ASDK_OS_PROFILE_DUMP_SYSTEM_SIZE 39U /* serialized asdk_os_profile_system_t */
+#define ASDK_OS_PROFILE_DUMP_TASK_SIZE 29U   /* serialized asdk_os_profile_task_t */
+#define ASDK_OS_PROFILE_DUMP_CRC_SIZE 2U     /* fletcher-16 over version .. last task record */
+
+#define ASDK_OS_PROFILE_DUMP_MAX_SIZE (ASDK_OS_PROFILE_DUMP_HEADER_SIZE + \
+                                       ASDK_OS_PROFILE_DUMP_SYSTEM_SIZE + \
+                                       (ASDK_OS_PROFILE_TASK_MAX * ASDK_OS_PROFILE_DUMP_TASK_SIZE) + \
+                                       ASDK_OS_PROFILE_DUMP_CRC_SIZE)
+
+/*==============================================================================
+
+                   DEFINITIONS AND TYPES : STRUCTURES
+
+==============================================================================*/
+
+/*!
+ * @brief Snapshot of one task. CPU usage is in 0.01 % units (0 - 10000),
+ * stack figures are in bytes and times are in CPU timestamp counts.
+ *
+ * Implements : asdk_os_profile_task_t
+ */
+typedef struct {
+    char name[ASDK_OS_PROFILE_NAME_LEN]; /*!< Task name, truncated. */
+    uint8_t prio;                        /*!< Task priority. */
+    uint16_t cpu_usage;                  /*!< CPU usage over the last statistic task period. */
+    uint16_t cpu_usage_max;              /*!< Peak CPU usage. */
+    uint32_t ctx_sw_count;               /*!< Number of times the task was switched in. */
+    uint32_t stk_used;                   /*!< Stack high-water mark. */
+    uint32_t stk_free;                   /*!< Stack never touched since the task was created. */
+    uint32_t int_dis_time_max;           /*!< Longest interrupt disable time seen in the task. */
+} asdk_os_profile_task_t;
+
+/*!
+ * @brief Snapshot of system wide figures. Units follow asdk_os_profile_task_t,
+ * ISR figures are measured by asdk_os_profile_isr_enter()/exit().
+ *
+ * Implements : asdk_os_profile_system_t
+ */
+typedef struct {
+    uint16_t cpu_usage;        /*!< Total CPU usage. */
+    uint16_t cpu_usage_max;    /*!< Peak total CPU usage. */
+    uint32_t ctx_sw_count;     /*!< Total context switches. */
+    uint16_t task_count;       /*!< Tasks created in the kernel. */
+    uint8_t isr_nesting_max;   /*!< Deepest ISR nesting level seen. */
+    uint32_t isr_count;        /*!< Outermost ISR entries. */
+    uint32_t isr_time_total;   /*!< Time spent in ISRs, outermost entry to outermost exit. */
+    uint32_t isr_time_max;     /*!< Longest outermost ISR, nested ISRs included. */
+    uint32_t int_dis_time_max; /*!< Longest interrupt disable time, kernel wide. */
+    uint32_t isr_stk_used;     /*!< ISR stack high-water mark. */
+    uint32_t isr_stk_free;     /*!< ISR stack never touched. */
+    uint32_t ts_freq_hz;       /*!< Frequency of the CPU timestamp, 0 when not available. */
+} asdk_os_profile_system_t;
+
+/*==============================================================================
+
+                   DEFINITIONS AND TYPES : CALLBACKS
+
+==============================================================================*/
+
+/* sink for asdk_os_profile_dump(), returns the number of bytes accepted */
+typedef uint32_t (*asdk_os_profile_write_t)(const uint8_t *data, uint32_t len);
+
+/*==============================================================================
+
+                           EXTERNAL DECLARATIONS
+
+==============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_os_profile_init */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Initializes the profiler. Call it after OSInit() and before creating the
+  application tasks: tasks created afterwards are tracked automatically,
+  the kernel tasks are registered here.
+
+  @return asdk_errorcode_t
+  @retval ASDK_MW_OS_PROFILE_SUCCESS
+*/
+asdk_errorcode_t asdk_os_profile_init(void);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_os_profile_register_task */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Tracks a task that was created before asdk_os_profile_init().
+
+  @param [in] p_tcb Task control block.
+
+  @return asdk_errorcode_t
+  @retval ASDK_MW_OS_PROFILE_SUCCESS
+  @retval ASDK_MW_OS_PROFILE_ERROR_NULL_PTR
+  @retval ASDK_MW_OS_PROFILE_TASK_TABLE_FULL
+*/
+asdk_errorcode_t asdk_os_profile_register_task(OS_TCB *p_tcb);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_os_profile_isr_enter */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Marks the start of an ISR. Call it next to OSIntEnter() in the ISRs that
+  should be accounted for. Safe to nest.
+*/
+void asdk_os_profile_isr_enter(void);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_os_profile_isr_exit */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Marks the end of an ISR. Call it before OSIntExit().
+*/
+void asdk_os_profile_isr_exit(void);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_os_profile_get_system */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Takes a snapshot of the system wide figures.
+
+  @param [out] system Snapshot.
+
+  @return asdk_errorcode_t
+  @retval ASDK_MW_OS_PROFILE_SUCCESS
+  @retval ASDK_MW_OS_PROFILE_ERROR_NULL_PTR
+*/
+asdk_errorcode_t asdk_os_profile_get_system(asdk_os_profile_system_t *system);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_os_profile_get_tasks */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Takes a snapshot of the tracked tasks.
+
+  @param [out] tasks Array receiving one entry per task.
+  @param [in] max_tasks Capacity of the array.
+  @param [out] num_tasks Number of entries filled.
+
+  @return asdk_errorcode_t
+  @retval ASDK_MW_OS_PROFILE_SUCCESS
+  @retval ASDK_MW_OS_PROFILE_ERROR_NULL_PTR
+*/
+asdk_errorcode_t asdk_os_profile_get_tasks(asdk_os_profile_task_t *tasks, uint8_t max_tasks, uint8_t *num_tasks);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_os_profile_reset */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Clears the peak values and the ISR figures. The kernel statistics are
+  reset by the statistic task on its next run.
+*/
+void asdk_os_profile_reset(void);
+
+/*----------------------------------------------------------------------------*/
+/* Function : asdk_os_profile_dump */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Serializes a snapshot and hands it to the write function in one call.
+  Multi-byte fields are little endian, in the order of the structure
+  members. Frame layout:
+
+  | sync (A5 5A) | version | task count | payload length (2) |
+  | system record | task record * task count | fletcher-16 (2) |
+
+  @param [in] write Sink for the frame, e.g. the debug UART.
+
+  @return asdk_errorcode_t
+  @retval ASDK_MW_OS_PROFILE_SUCCESS
+  @retval ASDK_MW_OS_PROFILE_ERROR_NULL_PTR
+  @retval ASDK_MW_OS_PROFILE_DUMP_TRUNCATED when the sink did not take the whole frame
+*/
+asdk_errorcode_t asdk_os_profile_dump(asdk_os_profile_write_t write);
+
+#endif /* ASDK_OS_PROFILE_H */
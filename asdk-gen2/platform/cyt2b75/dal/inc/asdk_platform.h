@@ -13,6 +13,8 @@
 
 #define ASDK_EXIT_CRITICAL_SECTION()  asdk_sys_enable_interrupts();
 
+#define ASDK_MEMORY_BARRIER()         __DMB(); /*!< Orders memory accesses without masking interrupts */
+
 /*!
  * @brief An enumerator to represent CAN channels.
  *
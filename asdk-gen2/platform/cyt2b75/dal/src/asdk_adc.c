@@ -35,6 +35,8 @@
 #include "cy_device_headers.h"
 #include "adc/cy_adc.h"
 #include "sysint/cy_sysint.h"
+#include "dma/cy_pdma.h"
+#include "trigmux/cy_trigmux.h"
 #include "cy_device_headers.h"
 #include "cy_project.h"
 
@@ -56,6 +58,13 @@
 #define ASDK_ADC_INVALID_VALUE 0xFFFFu
 #define ADC_MAX_CH_NO 32u
 #define MAX_ADC_MOD 3u
+#define ADC_MAX_AVERAGE_SAMPLES 256u
+
+/* DMA descriptor limits, X and Y loops of 256 */
+#define ADC_DMA_LOOP_COUNT_MAX 256u
+
+/* logical channels of a SAR with a hard-wired done line to P-DMA0 */
+#define ADC_DMA_MAX_CH_DONE 16u
 
 /*==============================================================================
 
@@ -88,8 +97,15 @@ typedef struct
 {
     asdk_mcu_pin_t *grp_pins;
     uint8_t pin_count;
-    asdk_adc_conversion_status_t grp_status;
+    volatile asdk_adc_conversion_status_t grp_status;
     asdk_adc_callback_fn_t grp_callback;
+    asdk_adc_module_t adc_module;
+    uint8_t first_channel; /* group occupies logical channels first_channel .. first_channel + pin_count - 1 */
+
+    /* DMA mode, descriptors must stay in RAM while in use */
+    bool dma_enabled;
+    uint8_t dma_channel;
+    cy_stc_pdma_descr_t dma_descr[2];
 } asdk_adc_grp_private_handle_t;
 
 /*==============================================================================
@@ -104,9 +120,23 @@ static double asdk_adc_module_clock_hz = 0;
 
 static asdk_adc_callback_fn_t asdk_adc_application_callback = NULL;
 
+/* logical channels in use per module, one bit per channel */
+static uint32_t asdk_adc_used_channels[MAX_ADC_MOD];
+
 // Base pointer for the SAR ADC Modules
 volatile stc_PASS_SAR_t *const asdk_adc_module_cyt2b7[] = {PASS0_SAR0, PASS0_SAR1, PASS0_SAR2};
 
+/* One-to-one triggers of the SAR channel done lines to their hard-wired
+   P-DMA0 channels, pass[0].tr_sar_ch_done[] to cpuss.dw0_tr_in[] in the
+   device trigger table. Logical channel n of a SAR uses trigger and P-DMA0
+   channel base + n, for n below ADC_DMA_MAX_CH_DONE. */
+static const uint32_t adc_dma_trig[MAX_ADC_MOD] = {
+    TRIG_OUT_1TO1_0_PASS_CH_DONE0_TO_PDMA0,
+    TRIG_OUT_1TO1_0_PASS_CH_DONE32_TO_PDMA0,
+    TRIG_OUT_1TO1_0_PASS_CH_DONE64_TO_PDMA0};
+
+static const uint8_t adc_dma_chnl[MAX_ADC_MOD] = {0, 32, 48};
+
 static const asdk_adc_pin_map_t adc_pin_map[] = {
     {MCU_PIN_0, ASDK_ADC_CYT2B7_MODULE_INVALID, ASDK_ADC_INVALID_CHANNEL},
     {MCU_PIN_1, ASDK_ADC_CYT2B7_MODULE_INVALID, ASDK_ADC_INVALID_CHANNEL},
@@ -276,12 +306,34 @@ cy_stc_adc_channel_config_t adcChannelConfig = {
 
 static asdk_errorcode_t asdk_adc_config_input_check(asdk_adc_config_t *adc_config);
 
+static void asdk_adc_params_init(void);
+
 static asdk_errorcode_t asdk_adc_get_module_info(asdk_mcu_pin_t pin_num,
                                                  asdk_adc_module_t *adc_module,
                                                  cy_en_adc_pin_address_t *adc_channel);
 
 static asdk_errorcode_t asdk_adc_group_init(asdk_adc_config_t *adc_config);
 
+static asdk_errorcode_t asdk_adc_group_channel_alloc(asdk_adc_module_t adc_module_num,
+                                                     uint8_t channel_count,
+                                                     uint8_t *first_channel);
+
+static asdk_errorcode_t asdk_adc_group_channel_init(asdk_adc_module_t adc_module_num,
+                                                    uint8_t logical_channel,
+                                                    cy_en_adc_pin_address_t pin_address,
+                                                    bool is_group_start,
+                                                    bool is_group_end,
+                                                    asdk_adc_config_t *adc_config);
+
+static asdk_adc_grp_private_handle_t *asdk_adc_group_get_handle(void *adc_group_instance);
+
+static asdk_errorcode_t asdk_adc_group_dma_check(asdk_adc_config_t *adc_config);
+
+static asdk_errorcode_t asdk_adc_group_dma_init(asdk_adc_grp_private_handle_t *grp_handle,
+                                                asdk_adc_config_t *adc_config);
+
+static bool asdk_adc_group_isr(asdk_adc_module_t adc_module_num);
+
 static asdk_errorcode_t asdk_adc_single_init(asdk_adc_config_t *adc_config);
 
 static asdk_errorcode_t asdk_adc_module_init(asdk_adc_module_t adc_module_num);
@@ -303,6 +355,7 @@ static asdk_errorcode_t asdk_adc_channel_enable(asdk_adc_module_t adc_module_num
 static void ADC0_ISR(void);
 static void ADC1_ISR(void);
 static void ADC2_ISR(void);
+static void asdk_adc_group_dma_isr(void);
 
 /*==============================================================================
 
@@ -328,12 +381,15 @@ asdk_errorcode_t asdk_adc_init(asdk_adc_config_t *adc_config)
         return ASDK_ADC_ERROR_HW_TRIG_NOT_SUPPORTED;
     }
 
-    /* check if unsupported feature requested - dma */
-    if (true == adc_config->enable_dma)
+    /* check if unsupported feature requested - dma of single channels */
+    if ((true == adc_config->enable_dma) && (true != adc_config->enable_group))
     {
         return ASDK_ADC_ERROR_DMA_TRIG_NOT_SUPPORTED;
     }
 
+    /* reset the global variables on first init */
+    asdk_adc_params_init();
+
     /* check if group conversion enabled */
     if (true == adc_config->enable_group)
     {
@@ -464,19 +520,84 @@ asdk_errorcode_t asdk_adc_start_group_conversion_blocking(void *adc_group_instan
 /*! This function will start group conversion of all channel of that module. */
 asdk_errorcode_t asdk_adc_start_group_conversion_non_blocking(void *adc_group_instance)
 {
-    return ASDK_ADC_ERROR_FUNCTION_NOT_IMPLEMENTED;
+    asdk_adc_grp_private_handle_t *grp_handle = asdk_adc_group_get_handle(adc_group_instance);
+    cy_en_adc_status_t cy_error_code = CY_ADC_SUCCESS;
+    cy_stc_adc_group_status_t asdk_adc_grpstatus_cyt2b7;
+    volatile stc_PASS_SAR_CH_t *first_ch;
+
+    if (NULL == grp_handle)
+    {
+        return ASDK_ADC_ERROR_INVALID_GROUP_INSTANCE;
+    }
+
+    first_ch = &asdk_adc_module_cyt2b7[grp_handle->adc_module]->CH[grp_handle->first_channel];
+
+    cy_error_code = Cy_Adc_Channel_GetGroupStatus(first_ch, &asdk_adc_grpstatus_cyt2b7);
+    if ((CY_ADC_SUCCESS != cy_error_code) || (false != asdk_adc_grpstatus_cyt2b7.grpBusy))
+    {
+        return ASDK_ADC_ERROR_CONVERSION_FAIL;
+    }
+
+    grp_handle->grp_status = ASDK_ADC_CONVERSION_STATUS_ONGOING;
+
+    /* trigger the first channel, the rest of the group is chained in hardware */
+    Cy_Adc_Channel_SoftwareTrigger(first_ch);
+
+    return ASDK_SUCCESS;
 }
 
 /*! Get the status of ADC non blocking group conversion for all ADC channel. */
 asdk_errorcode_t asdk_adc_get_group_conversion_status_non_blocking(void *adc_group_instance, asdk_adc_conversion_status_t *status)
 {
-    return ASDK_ADC_ERROR_FUNCTION_NOT_IMPLEMENTED;
+    asdk_adc_grp_private_handle_t *grp_handle = asdk_adc_group_get_handle(adc_group_instance);
+
+    if (NULL == grp_handle)
+    {
+        return ASDK_ADC_ERROR_INVALID_GROUP_INSTANCE;
+    }
+
+    if (NULL == status)
+    {
+        return ASDK_ADC_ERROR_NULL_PTR;
+    }
+
+    *status = grp_handle->grp_status;
+
+    return ASDK_SUCCESS;
 }
 
 /*! Read the data of the all group channel of the ADC module. */
 asdk_errorcode_t asdk_adc_read_group_conversion_value_non_blocking(void *adc_group_instance, uint32_t *adc_data, uint8_t buffer_len)
 {
-    return ASDK_ADC_ERROR_FUNCTION_NOT_IMPLEMENTED;
+    asdk_adc_grp_private_handle_t *grp_handle = asdk_adc_group_get_handle(adc_group_instance);
+    cy_stc_adc_ch_status_t asdk_adc_channel_status_cyt2b7;
+    uint16_t result;
+
+    if (NULL == grp_handle)
+    {
+        return ASDK_ADC_ERROR_INVALID_GROUP_INSTANCE;
+    }
+
+    if (NULL == adc_data)
+    {
+        return ASDK_ADC_ERROR_NULL_PTR;
+    }
+
+    if (buffer_len < grp_handle->pin_count)
+    {
+        return ASDK_ADC_ERROR_INVALID_GROUP_INPUT;
+    }
+
+    /* in continuous mode the first channel is already converting again, its
+       result register is only replaced once that conversion completes */
+    for (uint8_t index = 0; index < grp_handle->pin_count; index++)
+    {
+        Cy_Adc_Channel_GetResult(&asdk_adc_module_cyt2b7[grp_handle->adc_module]->CH[grp_handle->first_channel + index],
+                                 &result, &asdk_adc_channel_status_cyt2b7);
+        adc_data[index] = result;
+    }
+
+    return ASDK_SUCCESS;
 }
 
 /*==============================================================================
@@ -567,10 +688,69 @@ static asdk_errorcode_t asdk_adc_get_module_info(asdk_mcu_pin_t pin_num,
     return ASDK_SUCCESS;
 }
 
+static void asdk_adc_params_init(void)
+{
+    /* check if init running for first time - reset the global variables */
+    if (false == is_adc_params_init)
+    {
+        is_adc_params_init = true;
+
+        /* reset all the pin num to invalid */
+        for (uint8_t index = 0; index < ASDK_ADC_MAX_TOTAL_CHANNELS; index++)
+        {
+            asdk_adc_active_pins[index] = MCU_PIN_NOT_DEFINED;
+        }
+    }
+}
+
 static asdk_errorcode_t asdk_adc_group_init(asdk_adc_config_t *adc_config)
 {
+    asdk_errorcode_t error_code = ASDK_SUCCESS;
     uint8_t free_group_handle = UINT8_MAX;
     asdk_mcu_pin_t empty_pin_index = ASDK_ADC_MAX_TOTAL_CHANNELS;
+    asdk_adc_module_t adc_module_num = ASDK_ADC_CYT2B7_MODULE_INVALID;
+    asdk_adc_module_t grp_module_num = ASDK_ADC_CYT2B7_MODULE_INVALID;
+    cy_en_adc_pin_address_t adc_channel_num = ASDK_ADC_INVALID_CHANNEL;
+    uint8_t first_channel = 0;
+    uint16_t average_samples = adc_config->average_samples;
+
+    /* averaging is done by the SAR over a power of 2 of conversions */
+    if ((ADC_MAX_AVERAGE_SAMPLES < average_samples) ||
+        (0u != (average_samples & (average_samples - 1u))))
+    {
+        return ASDK_ADC_ERROR_INVALID_GROUP_INPUT;
+    }
+
+    if (true == adc_config->enable_dma)
+    {
+        error_code = asdk_adc_group_dma_check(adc_config);
+        if (ASDK_SUCCESS != error_code)
+        {
+            return error_code;
+        }
+    }
+
+    /* a group is chained within one SAR module */
+    for (uint8_t index = 0; index < adc_config->pin_count; index++)
+    {
+        error_code = asdk_adc_get_module_info(adc_config->pin_nums[index], &adc_module_num, &adc_channel_num);
+        if (ASDK_SUCCESS != error_code)
+        {
+            return error_code;
+        }
+
+        if ((ASDK_ADC_CYT2B7_MODULE_INVALID != grp_module_num) && (grp_module_num != adc_module_num))
+        {
+            return ASDK_ADC_ERROR_INVALID_GROUP_INPUT;
+        }
+        grp_module_num = adc_module_num;
+
+        for (uint8_t index_l = 0; index_l < ASDK_ADC_MAX_TOTAL_CHANNELS; index_l++)
+        {
+            if (adc_config->pin_nums[index] == asdk_adc_active_pins[index_l])
+                return ASDK_ADC_ERROR_PIN_ALREADY_INITIALIZED;
+        }
+    }
 
     /* get free group handle */
     for (uint8_t index = 0; index < ASDK_ADC_MAX_GROUP_COUNT; index++)
@@ -604,14 +784,79 @@ static asdk_errorcode_t asdk_adc_group_init(asdk_adc_config_t *adc_config)
         return ASDK_ADC_ERROR_PIN_BUFFER_NOT_AVAILABLE;
     }
 
+    /* consecutive logical channels for the group */
+    error_code = asdk_adc_group_channel_alloc(grp_module_num, adc_config->pin_count, &first_channel);
+    if (ASDK_SUCCESS != error_code)
+    {
+        return error_code;
+    }
+
+    /* DMA is triggered by the done line of the last channel */
+    if ((true == adc_config->enable_dma) &&
+        (ADC_DMA_MAX_CH_DONE < (first_channel + adc_config->pin_count)))
+    {
+        return ASDK_ADC_ERROR_DMA_TRIG_NOT_SUPPORTED;
+    }
+
+    error_code = asdk_adc_module_init(grp_module_num);
+    if (ASDK_SUCCESS != error_code)
+    {
+        return error_code;
+    }
+
+    /* initialize adc hardware, one logical channel per pin */
+    for (uint8_t index = 0; index < adc_config->pin_count; index++)
+    {
+        bool is_group_end = ((index + 1u) == adc_config->pin_count);
+
+        (void)asdk_adc_get_module_info(adc_config->pin_nums[index], &adc_module_num, &adc_channel_num);
+
+        error_code = asdk_adc_group_channel_init(grp_module_num,
+                                                 first_channel + index,
+                                                 adc_channel_num,
+                                                 (0u == index),
+                                                 is_group_end,
+                                                 adc_config);
+        if (ASDK_SUCCESS != error_code)
+        {
+            return error_code;
+        }
+
+        /* only the last channel raises group done, to the DMA in DMA mode */
+        if (is_group_end && (true != adc_config->enable_dma))
+        {
+            error_code = asdk_adc_irq_init(grp_module_num,
+                                           (cy_en_adc_pin_address_t)(first_channel + index),
+                                           adc_config->intr_num,
+                                           adc_config->interrupt_priority,
+                                           adc_config->enable_group);
+            if (ASDK_SUCCESS != error_code)
+            {
+                return error_code;
+            }
+        }
+
+        /* pin mux settings */
+        asdk_pinmux_config_t adc_pinmux_pins[] = {
+            {.alternate_fun_id = ASDK_PINMUX_ALTFUN(ASDK_PINMUX_FUN_ADC, (ASDK_PINMUX_ADC_SUBFUN_MODULE0 + grp_module_num), adc_channel_num),
+             .MCU_pin_num = adc_config->pin_nums[index],
+             .pull_configuration = ASDK_GPIO_PULL_TYPE_ANALOG}};
+
+        error_code = asdk_set_pinmux(adc_pinmux_pins, (uint16_t)1U);
+        if (ASDK_PINMUX_SUCCESS != error_code)
+        {
+            return error_code;
+        }
+    }
+
     /* copy group info in the group instance */
     adc_grp_handle[free_group_handle].grp_pins = &asdk_adc_active_pins[empty_pin_index];
     adc_grp_handle[free_group_handle].pin_count = adc_config->pin_count;
     adc_grp_handle[free_group_handle].grp_callback = adc_config->grp_callback;
-    adc_grp_handle[free_group_handle].grp_status = ASDK_ADC_CONVERSION_STATUS_RESET;
-
-    /* return assigned instance */
-    adc_config->adc_group_instance = &adc_grp_handle[free_group_handle];
+    adc_grp_handle[free_group_handle].grp_status = ASDK_ADC_CONVERSION_STATUS_INIT;
+    adc_grp_handle[free_group_handle].adc_module = grp_module_num;
+    adc_grp_handle[free_group_handle].first_channel = first_channel;
+    adc_grp_handle[free_group_handle].dma_enabled = false;
 
     /* copy pin data into buffer */
     for (uint8_t index = 0; index < adc_config->pin_count; index++)
@@ -620,33 +865,214 @@ static asdk_errorcode_t asdk_adc_group_init(asdk_adc_config_t *adc_config)
         empty_pin_index++;
     }
 
-    /* initialize adc hardware for continuous conversion */
-    for (uint8_t index = 0; index <= adc_config->pin_count; index++)
+    if (true == adc_config->enable_dma)
+    {
+        error_code = asdk_adc_group_dma_init(&adc_grp_handle[free_group_handle], adc_config);
+        if (ASDK_SUCCESS != error_code)
+        {
+            return error_code;
+        }
+    }
+
+    /* enable channels, conversion starts on the first trigger */
+    for (uint8_t index = 0; index < adc_config->pin_count; index++)
     {
+        (void)asdk_adc_channel_enable(grp_module_num, (cy_en_adc_pin_address_t)(first_channel + index));
     }
 
+    /* return assigned instance */
+    adc_config->adc_group_instance = &adc_grp_handle[free_group_handle];
+
     return ASDK_SUCCESS;
 }
 
-static asdk_errorcode_t asdk_adc_single_init(asdk_adc_config_t *adc_config)
+static asdk_errorcode_t asdk_adc_group_channel_alloc(asdk_adc_module_t adc_module_num,
+                                                     uint8_t channel_count,
+                                                     uint8_t *first_channel)
 {
-    asdk_errorcode_t error_code = ASDK_SUCCESS;
-    asdk_adc_module_t adc_module_num = ASDK_ADC_CYT2B7_MODULE_INVALID;
-    cy_en_adc_pin_address_t adc_channel_num = ASDK_ADC_INVALID_CHANNEL;
-    asdk_mcu_pin_t empty_pin_index = ASDK_ADC_MAX_TOTAL_CHANNELS;
+    uint32_t mask;
 
-    /* check if init running for first time - reset the global variables */
-    if (false == is_adc_params_init)
+    if ((0u == channel_count) || (ADC_MAX_CH_NO < channel_count))
     {
-        is_adc_params_init = true;
+        return ASDK_ADC_ERROR_INVALID_PIN_COUNT;
+    }
 
-        /* reset all the pin num to invalid */
-        for (uint8_t index = 0; index < ASDK_ADC_MAX_TOTAL_CHANNELS; index++)
+    mask = (ADC_MAX_CH_NO == channel_count) ? UINT32_MAX : ((1UL << channel_count) - 1UL);
+
+    /* lowest run of free logical channels */
+    for (uint8_t first = 0; first <= (ADC_MAX_CH_NO - channel_count); first++)
+    {
+        if (0u == (asdk_adc_used_channels[adc_module_num] & (mask << first)))
         {
-            asdk_adc_active_pins[index] = MCU_PIN_NOT_DEFINED;
+            asdk_adc_used_channels[adc_module_num] |= (mask << first);
+            *first_channel = first;
+            return ASDK_SUCCESS;
+        }
+    }
+
+    return ASDK_ADC_ERROR_PIN_BUFFER_NOT_AVAILABLE;
+}
+
+static asdk_errorcode_t asdk_adc_group_channel_init(asdk_adc_module_t adc_module_num,
+                                                    uint8_t logical_channel,
+                                                    cy_en_adc_pin_address_t pin_address,
+                                                    bool is_group_start,
+                                                    bool is_group_end,
+                                                    asdk_adc_config_t *adc_config)
+{
+    cy_en_adc_status_t cyt2b7_error_code = CY_ADC_SUCCESS;
+    cy_stc_adc_channel_config_t grp_channel_config = adcChannelConfig;
+    uint8_t shift = 0;
+
+    grp_channel_config.pinAddress = pin_address;
+
+    /* the first channel is triggered, the next ones follow until group end */
+    if (is_group_start && adc_config->enable_continuous)
+    {
+        grp_channel_config.triggerSelection = CY_ADC_TRIGGER_CONTINUOUS;
+    }
+    else
+    {
+        grp_channel_config.triggerSelection = CY_ADC_TRIGGER_OFF;
+    }
+    grp_channel_config.isGroupEnd = is_group_end;
+    grp_channel_config.mask.grpDone = is_group_end && (true != adc_config->enable_dma);
+
+    if (1u < adc_config->average_samples)
+    {
+        while ((1u << shift) < adc_config->average_samples)
+        {
+            shift++;
+        }
+
+        grp_channel_config.postProcessingMode = CY_ADC_POST_PROCESSING_MODE_AVG;
+        grp_channel_config.averageCount = (uint8_t)(adc_config->average_samples - 1u);
+        grp_channel_config.rightShift = shift;
+    }
+
+    cyt2b7_error_code = Cy_Adc_Channel_Init(&asdk_adc_module_cyt2b7[adc_module_num]->CH[logical_channel],
+                                            &grp_channel_config);
+    if (CY_ADC_SUCCESS != cyt2b7_error_code)
+    {
+        return ASDK_ADC_ERROR_CHANNEL_INIT_FAIL;
+    }
+
+    return ASDK_SUCCESS;
+}
+
+static asdk_adc_grp_private_handle_t *asdk_adc_group_get_handle(void *adc_group_instance)
+{
+    for (uint8_t index = 0; index < ASDK_ADC_MAX_GROUP_COUNT; index++)
+    {
+        if ((adc_group_instance == &adc_grp_handle[index]) &&
+            (NULL != adc_grp_handle[index].grp_pins))
+        {
+            return &adc_grp_handle[index];
         }
     }
 
+    return NULL;
+}
+
+static asdk_errorcode_t asdk_adc_group_dma_check(asdk_adc_config_t *adc_config)
+{
+    uint32_t half = adc_config->dma_dest_len / 2u;
+
+    /* two halves, each a whole number of group scans */
+    if ((0u != (adc_config->dma_dest_len % 2u)) ||
+        (0u != (half % adc_config->pin_count)) ||
+        (ADC_DMA_LOOP_COUNT_MAX < (half / adc_config->pin_count)))
+    {
+        return ASDK_ADC_ERROR_INVALID_DMA_CONFIG;
+    }
+
+    if (ADC_DMA_MAX_CH_DONE < adc_config->pin_count)
+    {
+        return ASDK_ADC_ERROR_DMA_TRIG_NOT_SUPPORTED;
+    }
+
+    return ASDK_SUCCESS;
+}
+
+static asdk_errorcode_t asdk_adc_group_dma_init(asdk_adc_grp_private_handle_t *grp_handle,
+                                                asdk_adc_config_t *adc_config)
+{
+    volatile stc_PASS_SAR_t *sar = asdk_adc_module_cyt2b7[grp_handle->adc_module];
+    uint8_t last_channel = grp_handle->first_channel + grp_handle->pin_count - 1u;
+    uint32_t half = adc_config->dma_dest_len / 2u;
+    cy_stc_pdma_descr_config_t descr_config = {
+        .deact = CY_PDMA_RETDIG_IM,
+        .intrType = CY_PDMA_INTR_DESCR_CMPLT,
+        .trigoutType = CY_PDMA_TRIGOUT_DESCR_CMPLT,
+        .chStateAtCmplt = CY_PDMA_CH_ENABLED,
+        .triginType = CY_PDMA_TRIGIN_XLOOP,
+        .dataSize = CY_PDMA_HALFWORD,
+        .srcTxfrSize = CY_PDMA_TXFR_SIZE_WORD,
+        .destTxfrSize = CY_PDMA_TXFR_SIZE_WORD,
+        .descrType = CY_PDMA_2D_TRANSFER,
+        .srcAddr = (void *)&sar->CH[grp_handle->first_channel].unRESULT.u32Register,
+        .srcXincr = (int32_t)(sizeof(sar->CH[0]) / sizeof(uint32_t)),
+        .destXincr = 1,
+        .xCount = grp_handle->pin_count,
+        .srcYincr = 0,
+        .destYincr = (int32_t)grp_handle->pin_count,
+        .yCount = half / grp_handle->pin_count,
+    };
+    cy_stc_pdma_chnl_config_t chnl_config = {
+        .PDMA_Descriptor = &grp_handle->dma_descr[0],
+        .preemptable = false,
+        .priority = 0,
+        .enable = false,
+    };
+    cy_stc_sysint_irq_t irq_cfg = {
+        .intIdx = adc_config->intr_num,
+        .isEnabled = true,
+    };
+
+    if (ASDK_EXTI_INTR_MAX <= adc_config->intr_num)
+    {
+        return ASDK_ADC_ERROR_INVALID_INTR_NUM;
+    }
+
+    grp_handle->dma_channel = adc_dma_chnl[grp_handle->adc_module] + last_channel;
+    Cy_PDMA_Chnl_Disable(DW0, grp_handle->dma_channel);
+
+    /* each group done moves one scan, the halves are chained into a ring */
+    descr_config.destAddr = &adc_config->dma_dest[0];
+    descr_config.descrNext = &grp_handle->dma_descr[1];
+    Cy_PDMA_Descr_Init(&grp_handle->dma_descr[0], &descr_config);
+
+    descr_config.destAddr = &adc_config->dma_dest[half];
+    descr_config.descrNext = &grp_handle->dma_descr[0];
+    Cy_PDMA_Descr_Init(&grp_handle->dma_descr[1], &descr_config);
+
+    /* the done line pulses once per group, after the last result is written */
+    Cy_TrigMux_Connect1To1(adc_dma_trig[grp_handle->adc_module] + last_channel, 0, TRIGGER_TYPE_EDGE, 0);
+
+    Cy_PDMA_Chnl_Init(DW0, grp_handle->dma_channel, &chnl_config);
+    Cy_PDMA_Chnl_SetInterruptMask(DW0, grp_handle->dma_channel);
+
+    irq_cfg.sysIntSrc = (cy_en_intr_t)(cpuss_interrupts_dw0_0_IRQn + grp_handle->dma_channel);
+    Cy_SysInt_InitIRQ(&irq_cfg);
+    Cy_SysInt_SetSystemIrqVector(irq_cfg.sysIntSrc, asdk_adc_group_dma_isr);
+    NVIC_SetPriority(irq_cfg.intIdx, adc_config->interrupt_priority);
+    NVIC_EnableIRQ(irq_cfg.intIdx);
+
+    Cy_PDMA_Enable(DW0);
+    Cy_PDMA_Chnl_Enable(DW0, grp_handle->dma_channel);
+
+    grp_handle->dma_enabled = true;
+
+    return ASDK_SUCCESS;
+}
+
+static asdk_errorcode_t asdk_adc_single_init(asdk_adc_config_t *adc_config)
+{
+    asdk_errorcode_t error_code = ASDK_SUCCESS;
+    asdk_adc_module_t adc_module_num = ASDK_ADC_CYT2B7_MODULE_INVALID;
+    cy_en_adc_pin_address_t adc_channel_num = ASDK_ADC_INVALID_CHANNEL;
+    asdk_mcu_pin_t empty_pin_index = ASDK_ADC_MAX_TOTAL_CHANNELS;
+
     /* get available pin/channel index */
     for (uint8_t index = 0; index < ASDK_ADC_MAX_TOTAL_CHANNELS; index++)
     {
@@ -681,6 +1107,13 @@ static asdk_errorcode_t asdk_adc_single_init(asdk_adc_config_t *adc_config)
                 return ASDK_ADC_ERROR_PIN_ALREADY_INITIALIZED;
         }
 
+        /* logical channel may be taken by a group */
+        if ((adc_channel_num < ADC_MAX_CH_NO) &&
+            (0u != (asdk_adc_used_channels[adc_module_num] & (1UL << adc_channel_num))))
+        {
+            return ASDK_ADC_ERROR_CHANNEL_INIT_FAIL;
+        }
+
         /* initialize module */
         error_code = asdk_adc_module_init(adc_module_num);
         if (ASDK_SUCCESS != error_code)
@@ -728,6 +1161,11 @@ static asdk_errorcode_t asdk_adc_single_init(asdk_adc_config_t *adc_config)
 
         /* add pin number in the active pin list */
         asdk_adc_active_pins[empty_pin_index++] = adc_config->pin_nums[index];
+
+        if (adc_channel_num < ADC_MAX_CH_NO)
+        {
+            asdk_adc_used_channels[adc_module_num] |= (1UL << adc_channel_num);
+        }
     }
 
     return error_code;
@@ -853,6 +1291,86 @@ static asdk_errorcode_t asdk_adc_channel_enable(asdk_adc_module_t adc_module_num
     return ASDK_SUCCESS;
 }
 
+/* handles group done of the groups on the module, returns true when one was serviced */
+static bool asdk_adc_group_isr(asdk_adc_module_t adc_module_num)
+{
+    bool handled = false;
+    volatile stc_PASS_SAR_CH_t *last_ch;
+    cy_stc_adc_interrupt_source_t intrSource;
+    asdk_adc_callback_t callback_params;
+
+    for (uint8_t index = 0; index < ASDK_ADC_MAX_GROUP_COUNT; index++)
+    {
+        asdk_adc_grp_private_handle_t *grp_handle = &adc_grp_handle[index];
+
+        if ((NULL == grp_handle->grp_pins) || (adc_module_num != grp_handle->adc_module))
+        {
+            continue;
+        }
+
+        last_ch = &asdk_adc_module_cyt2b7[adc_module_num]->CH[grp_handle->first_channel + grp_handle->pin_count - 1u];
+
+        intrSource = (cy_stc_adc_interrupt_source_t){false};
+        Cy_Adc_Channel_GetInterruptMaskedStatus(last_ch, &intrSource);
+        if (!intrSource.grpDone)
+        {
+            continue;
+        }
+
+        Cy_Adc_Channel_ClearInterruptStatus(last_ch, &intrSource);
+        grp_handle->grp_status = ASDK_ADC_CONVERSION_STATUS_DONE;
+        handled = true;
+
+        if (NULL != grp_handle->grp_callback)
+        {
+            callback_params.adc_pin = grp_handle->grp_pins[0];
+            callback_params.callback_reason = ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE;
+            grp_handle->grp_callback(callback_params);
+        }
+    }
+
+    return handled;
+}
+
+/* shared handler of the group DMA channels, one call per filled half */
+static void asdk_adc_group_dma_isr(void)
+{
+    asdk_adc_callback_t callback_params;
+
+    for (uint8_t index = 0; index < ASDK_ADC_MAX_GROUP_COUNT; index++)
+    {
+        asdk_adc_grp_private_handle_t *grp_handle = &adc_grp_handle[index];
+
+        if ((NULL == grp_handle->grp_pins) || (true != grp_handle->dma_enabled))
+        {
+            continue;
+        }
+
+        if (0UL == Cy_PDMA_Chnl_GetInterruptStatusMasked(DW0, grp_handle->dma_channel))
+        {
+            continue;
+        }
+
+        Cy_PDMA_Chnl_ClearInterrupt(DW0, grp_handle->dma_channel);
+        grp_handle->grp_status = ASDK_ADC_CONVERSION_STATUS_DONE;
+
+        if (NULL != grp_handle->grp_callback)
+        {
+            /* the channel has moved on to the descriptor of the other half */
+            callback_params.adc_pin = grp_handle->grp_pins[0];
+            if (DW0->CH_STRUCT[grp_handle->dma_channel].unCH_CURR_PTR.u32Register == (uint32_t)&grp_handle->dma_descr[1])
+            {
+                callback_params.callback_reason = ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE_HALF;
+            }
+            else
+            {
+                callback_params.callback_reason = ASDK_ADC_CALLBACK_REASON_CONVERSION_COMPLETE;
+            }
+            grp_handle->grp_callback(callback_params);
+        }
+    }
+}
+
 /*----------------------------------------------------------------------------*/
 /* Function : ADC_ISR */
 /*----------------------------------------------------------------------------*/
@@ -873,6 +1391,12 @@ static void ADC0_ISR(void)
         .adc_pin = MCU_PIN_NOT_DEFINED,
         .callback_reason = ASDK_ADC_CALLBACK_REASON_INVALID};
 
+    /* CUR_CHAN has moved on when a continuous group restarted */
+    if (asdk_adc_group_isr(ASDK_ADC_CYT2B7_MODULE_0))
+    {
+        return;
+    }
+
     channel_no = asdk_adc_module_cyt2b7[ASDK_ADC_CYT2B7_MODULE_0]->unSTATUS.stcField.u5CUR_CHAN;
 
     /* Get interrupt source */
@@ -907,6 +1431,12 @@ static void ADC1_ISR(void)
         .adc_pin = MCU_PIN_NOT_DEFINED,
         .callback_reason = ASDK_ADC_CALLBACK_REASON_INVALID};
 
+    /* CUR_CHAN has moved on when a continuous group restarted */
+    if (asdk_adc_group_isr(ASDK_ADC_CYT2B7_MODULE_1))
+    {
+        return;
+    }
+
     channel_no = asdk_adc_module_cyt2b7[ASDK_ADC_CYT2B7_MODULE_1]->unSTATUS.stcField.u5CUR_CHAN;
 
     /* Get interrupt source */
@@ -941,6 +1471,12 @@ static void ADC2_ISR(void)
         .adc_pin = MCU_PIN_NOT_DEFINED,
         .callback_reason = ASDK_ADC_CALLBACK_REASON_INVALID};
 
+    /* CUR_CHAN has moved on when a continuous group restarted */
+    if (asdk_adc_group_isr(ASDK_ADC_CYT2B7_MODULE_2))
+    {
+        return;
+    }
+
     channel_no = asdk_adc_module_cyt2b7[ASDK_ADC_CYT2B7_MODULE_2]->unSTATUS.stcField.u5CUR_CHAN;
 
     /* Get interrupt source */
@@ -38,7 +38,7 @@
           * dedicated tx mailbox, requires id:mailbox mapping.
           * dedicated rx mailbox, requires id:mailbox mapping.
     6. [] enhancement:
-        [] * use remaining mailboxes for tx as tx reserve pool
+        [done] * use remaining mailboxes for tx as tx reserve pool
     7. [] handle can fd.
 */
 
@@ -79,6 +79,10 @@
 #define CAN_HW_RX_MAILBOX_MAX (64)      /*!< Number of dedicated Rx buffers */
 #define CAN_HW_RX_FIFO_SIZE (64)        /*!< Size of the Rx FIFO */
 #define CAN_HW_FILTER_ELEMENT_MAX (128) /*!< Size of the H/W filter table */
+#define CAN_TX_QUEUE_MAILBOX_MAX (8)    /*!< Number of dedicated Tx buffers usable as transmit queue */
+
+#define CAN_FRAME_MAX_DLC (8)           /*!< Data size of @ref asdk_can_frame_t */
+#define CAN_STD_ID_SHIFT (18)           /*!< Position of 11-bit ID within the 29-bit ID field of Rx element */
 
 /*==============================================================================
 
@@ -175,6 +179,9 @@ static void __asdk_cyt2b75_can_rxfifo_top_handler(uint8_t u8FifoNum, uint8_t u8B
 static void __asdk_cyt2b75_can_error_handler(cy_en_canfd_bus_error_t volatile errorcode);
 static void __asdk_cyt2b75_can_status_handler(cy_en_canfd_bus_error_status_t enCanFDStatus);
 
+// Rx slot helpers
+static inline void __asdk_cyt2b75_can_extract_frame(const cy_stc_canfd_rx_buffer_t *rx_element, asdk_can_frame_t *frame);
+
 /*==============================================================================
 
                         LOCAL AND EXTERNAL DEFINITIONS
@@ -197,11 +204,17 @@ static cy_stc_extid_filter_t ext_id_filter[CAN_HW_FILTER_ELEMENT_MAX] = {0};
 
 // Callbacks
 static asdk_can_callback_t can_callback = NULL;
+static asdk_can_rx_claim_t can_rx_claim = NULL;
+static asdk_can_rx_commit_t can_rx_commit = NULL;
 
 // DAL buffers
 static cy_stc_canfd_msg_t cyt2b75_can_rxfifo_msg = {0};
 static asdk_can_message_t can_rx_buffer = {0};
-static asdk_can_message_t can_tx_buffer = {0};
+
+// Tx queue, one frame per dedicated Tx buffer
+static asdk_can_frame_t can_tx_frame[ASDK_CAN_MODULE_CAN_CH_MAX][CAN_TX_QUEUE_MAILBOX_MAX] = {0};
+static volatile bool can_tx_in_flight[ASDK_CAN_MODULE_CAN_CH_MAX][CAN_TX_QUEUE_MAILBOX_MAX] = {0};
+static uint8_t can_tx_mailbox_count[ASDK_CAN_MODULE_CAN_CH_MAX] = {0};
 
 // Default assumptions
 // static uint8_t tx_mailbox = 0;
@@ -476,11 +489,22 @@ static inline asdk_errorcode_t __asdk_set_can_hw_filter(asdk_can_id_t id_type, a
     if (NULL != hw_filter.tx_mailboxes) // optional
     {
     }
-    else
+    else if (0 == hw_filter.no_of_tx_queue_mailbox)
     {
         // use mailbox 0 for Tx
         cyt_config->noOfTxBuffers = 1;
     }
+    else if (CAN_TX_QUEUE_MAILBOX_MAX >= hw_filter.no_of_tx_queue_mailbox)
+    {
+        /* The driver doesn't configure the Tx FIFO/Queue section of the
+           message RAM, so dedicated Tx buffers form the transmit queue.
+           Pending buffers are arbitrated by CAN ID, lowest first. */
+        cyt_config->noOfTxBuffers = hw_filter.no_of_tx_queue_mailbox;
+    }
+    else
+    {
+        return ASDK_CAN_ERROR_HW_FEATURE_NOT_SUPPORTED;
+    }
 
     if (NULL != hw_filter.rx_mailboxes) // optional
     {
@@ -498,9 +522,9 @@ static inline asdk_errorcode_t __asdk_set_can_hw_filter(asdk_can_id_t id_type, a
 
        Enhancement:
        3. When the tx mailbox is busy:
-         + Use the next available mailbox from the transmit reserve pool.
-           If all mailboxes of the pool are busy, return as busy in can_services.c file.
-           Else, use it for the current transmission. */
+         + Use the next available mailbox from the transmit queue, refer
+           asdk_can_get_free_tx_mailbox. If all mailboxes of the queue are
+           busy, return as busy in can_services.c file. */
 
     // Rx FIFO without filtering, accept all
     if (NULL == hw_filter.rx_fifo_acceptance_filter.can_ids)
@@ -562,13 +586,41 @@ static inline asdk_errorcode_t __asdk_set_can_hw_filter(asdk_can_id_t id_type, a
     cyt_config->rxFifo0Config.numberOfFifoElements = CAN_HW_RX_FIFO_SIZE;
     cyt_config->rxFifo0Config.topPointerLogicEnabled = true;
 
-    // use remaining mailboxes Tx
-    // Enhancement: use leftover mailboxes for Tx operation
-    // enable_tx_pool();
-
     return hw_filter_status;
 }
 
+/* Rx slot helpers */
+
+static inline void __asdk_cyt2b75_can_extract_frame(const cy_stc_canfd_rx_buffer_t *rx_element, asdk_can_frame_t *frame)
+{
+    uint32_t data_word;
+    uint8_t dlc = rx_element->r1_f.dlc;
+
+    // only classic CAN frames fit in the slot
+    if (dlc > CAN_FRAME_MAX_DLC)
+    {
+        dlc = CAN_FRAME_MAX_DLC;
+    }
+
+    if (rx_element->r0_f.xtd)
+    {
+        frame->can_id = rx_element->r0_f.id;
+    }
+    else
+    {
+        frame->can_id = rx_element->r0_f.id >> CAN_STD_ID_SHIFT;
+    }
+
+    frame->dlc = dlc;
+
+    // message RAM supports word access only
+    for (uint8_t i = 0; (i * 4) < dlc; i++)
+    {
+        data_word = rx_element->data_area_f[i];
+        memcpy(&frame->message[i * 4], &data_word, sizeof(data_word));
+    }
+}
+
 /* ISR handlers */
 
 static void asdk_cyt2b75_can0_isr(void)
@@ -617,23 +669,62 @@ static void asdk_cyt2b75_can5_isr(void)
 
 static void __asdk_cyt2b75_can_tx_handler(void)
 {
-    /* To identify which mailbox has completed transmission
-       the driver must indicate the mailbox as callback
-       parameter.
-
-       SDK driver doesn't support it yet. So to enable
-       such feature the driver must be modified.
+    asdk_can_message_t tx_msg = {0};
+    asdk_can_frame_t *tx_frame = NULL;
+    uint8_t can_ch = (uint8_t)active_interrupt_can_instance;
+    uint32_t pending = can_map[can_ch].cyt_can_base_address->M_TTCAN.unTXBRP.u32Register;
 
-       Hence, can_message = NULL */
+    /* The driver doesn't indicate the mailbox that completed
+       transmission. A mailbox in flight whose request is no
+       longer pending has completed, report each one. */
 
-    if (can_callback != NULL)
+    for (uint8_t mailbox = 0; mailbox < can_tx_mailbox_count[can_ch]; mailbox++)
     {
-        can_callback((uint8_t)active_interrupt_can_instance, ASDK_CAN_TX_COMPLETE_EVENT, &can_tx_buffer);
+        if ((!can_tx_in_flight[can_ch][mailbox]) || ((pending >> mailbox) & 1))
+        {
+            continue;
+        }
+
+        can_tx_in_flight[can_ch][mailbox] = false;
+
+        if (can_callback != NULL)
+        {
+            tx_frame = &can_tx_frame[can_ch][mailbox];
+            tx_msg.can_id = tx_frame->can_id;
+            tx_msg.dlc = tx_frame->dlc;
+            tx_msg.message = tx_frame->message;
+
+            can_callback(can_ch, ASDK_CAN_TX_COMPLETE_EVENT, &tx_msg);
+        }
     }
 }
 
 static void __asdk_cyt2b75_can_rx_handler(bool bRxFifoMsg, uint8_t u8MsgBufOrRxFifoNum, cy_stc_canfd_msg_t *pstcCanFDmsg)
 {
+    asdk_can_frame_t *rx_slot = NULL;
+
+    // message already extracted by the driver, copy it into the claimed slot
+    if (can_rx_claim != NULL)
+    {
+        rx_slot = can_rx_claim((uint8_t)active_interrupt_can_instance);
+
+        if (rx_slot != NULL)
+        {
+            rx_slot->can_id = pstcCanFDmsg->idConfig.identifier;
+            rx_slot->dlc = pstcCanFDmsg->dataConfig.dataLengthCode;
+
+            if (rx_slot->dlc > CAN_FRAME_MAX_DLC)
+            {
+                rx_slot->dlc = CAN_FRAME_MAX_DLC;
+            }
+
+            memcpy(rx_slot->message, pstcCanFDmsg->dataConfig.data, rx_slot->dlc);
+            can_rx_commit((uint8_t)active_interrupt_can_instance);
+        }
+
+        return;
+    }
+
     if (can_callback != NULL)
     {
         can_rx_buffer.can_id = pstcCanFDmsg->idConfig.identifier;
@@ -646,6 +737,22 @@ static void __asdk_cyt2b75_can_rx_handler(bool bRxFifoMsg, uint8_t u8MsgBufOrRxF
 
 static void __asdk_cyt2b75_can_rxfifo_top_handler(uint8_t u8FifoNum, uint8_t u8BufferSizeInWord, uint32_t *pu32RxBuf)
 {
+    asdk_can_frame_t *rx_slot = NULL;
+
+    // zero-copy: extract directly from Rx FIFO into the claimed slot
+    if (can_rx_claim != NULL)
+    {
+        rx_slot = can_rx_claim((uint8_t)active_interrupt_can_instance);
+
+        if (rx_slot != NULL)
+        {
+            __asdk_cyt2b75_can_extract_frame((cy_stc_canfd_rx_buffer_t *)pu32RxBuf, rx_slot);
+            can_rx_commit((uint8_t)active_interrupt_can_instance);
+        }
+
+        return;
+    }
+
     Cy_CANFD_ExtractMsgFromRXBuffer((cy_stc_canfd_rx_buffer_t *)pu32RxBuf,
                                     &cyt2b75_can_rxfifo_msg);
 
@@ -803,6 +910,9 @@ asdk_errorcode_t asdk_can_init(uint8_t can_ch, asdk_can_config_t *can_config)
         return ASDK_CAN_ERROR_INIT_FAILED;
     }
 
+    can_tx_mailbox_count[can_ch] = cyt_can_config.noOfTxBuffers;
+    memset((void *)can_tx_in_flight[can_ch], 0, sizeof(can_tx_in_flight[can_ch]));
+
     // ASDK_CAN_SUCCESS
     return can_init_status;
 }
@@ -844,6 +954,20 @@ asdk_errorcode_t asdk_can_install_callback(asdk_can_callback_t callback)
     return ASDK_CAN_SUCCESS;
 }
 
+/*!This function registers the handlers to receive frames in-place.*/
+asdk_errorcode_t asdk_can_install_rx_slot_handler(asdk_can_rx_claim_t claim, asdk_can_rx_commit_t commit)
+{
+    if ((NULL == claim) || (NULL == commit))
+    {
+        return ASDK_CAN_ERROR_NULL_PTR;
+    }
+
+    can_rx_commit = commit;
+    can_rx_claim = claim;
+
+    return ASDK_CAN_SUCCESS;
+}
+
 /*!This function puts the CAN module to sleep mode*/
 asdk_errorcode_t asdk_can_sleep(uint8_t can_ch)
 {
@@ -866,6 +990,40 @@ asdk_errorcode_t asdk_can_is_tx_busy(uint8_t can_ch, uint8_t virtual_mailbox_no,
     return ASDK_CAN_SUCCESS;
 }
 
+/*! This function finds the next mailbox of the transmit queue which can
+  accept a message.*/
+asdk_errorcode_t asdk_can_get_free_tx_mailbox(uint8_t can_ch, uint8_t *virtual_mailbox_no, bool *status)
+{
+    uint32_t pending = 0;
+    uint8_t mailbox = 0;
+
+    if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
+    {
+        return ASDK_CAN_ERROR_INVALID_CHANNEL;
+    }
+
+    if ((NULL == virtual_mailbox_no) || (NULL == status))
+    {
+        return ASDK_CAN_ERROR_NULL_PTR;
+    }
+
+    pending = can_map[can_ch].cyt_can_base_address->M_TTCAN.unTXBRP.u32Register;
+    pending &= (1UL << can_tx_mailbox_count[can_ch]) - 1;
+
+    /* Pending buffers with equal CAN ID are sent lowest buffer first,
+       so only hand out buffers above the highest pending one. Once the
+       top buffer is used, wait for the queue to drain before wrapping. */
+    if (0 != pending)
+    {
+        mailbox = (uint8_t)(32 - __builtin_clz(pending));
+    }
+
+    *virtual_mailbox_no = mailbox;
+    *status = (mailbox >= can_tx_mailbox_count[can_ch]);
+
+    return ASDK_CAN_SUCCESS;
+}
+
 /*!  This function fills the given message in a mailbox which is configured
   for transmission.*/
 asdk_errorcode_t asdk_can_write(uint8_t can_ch, uint8_t virtual_mailbox_no, asdk_can_message_t *can_message)
@@ -873,6 +1031,7 @@ asdk_errorcode_t asdk_can_write(uint8_t can_ch, uint8_t virtual_mailbox_no, asdk
     asdk_errorcode_t can_write_status = ASDK_CAN_SUCCESS;
     cy_en_canfd_status_t cy_can_status = CY_CANFD_SUCCESS;
     cy_stc_canfd_msg_t stcMsg = {0};
+    asdk_can_frame_t *tx_frame = NULL;
 
     if (ASDK_CAN_MODULE_CAN_CH_MAX <= can_ch)
     {
@@ -885,16 +1044,29 @@ asdk_errorcode_t asdk_can_write(uint8_t can_ch, uint8_t virtual_mailbox_no, asdk
     stcMsg.dataConfig.dataLengthCode = can_message->dlc;
     memcpy(stcMsg.dataConfig.data, can_message->message, stcMsg.dataConfig.dataLengthCode);
 
+    // keep a copy for reporting the transmit complete event
+    if (virtual_mailbox_no < can_tx_mailbox_count[can_ch])
+    {
+        tx_frame = &can_tx_frame[can_ch][virtual_mailbox_no];
+        tx_frame->can_id = can_message->can_id;
+        tx_frame->dlc = (can_message->dlc > CAN_FRAME_MAX_DLC) ? CAN_FRAME_MAX_DLC : can_message->dlc;
+        memcpy(tx_frame->message, can_message->message, tx_frame->dlc);
+    }
+
+    // request and in-flight flag must be seen together by the Tx interrupt
+    ASDK_ENTER_CRITICAL_SECTION()
+
     cy_can_status = Cy_CANFD_UpdateAndTransmitMsgBuffer(can_map[can_ch].cyt_can_base_address, virtual_mailbox_no, &stcMsg);
     if (cy_can_status != CY_CANFD_SUCCESS)
     {
         can_write_status = ASDK_CAN_ERROR_WRITE_FAILED;
     }
+    else if (NULL != tx_frame)
+    {
+        can_tx_in_flight[can_ch][virtual_mailbox_no] = true;
+    }
 
-    can_tx_buffer.can_id = can_message->can_id;
-    can_tx_buffer.dlc = can_message->dlc;
-    can_tx_buffer.message = can_message->message;
-    // memcpy(&can_tx_buffer.message, can_message->message, can_message->dlc);
+    ASDK_EXIT_CRITICAL_SECTION()
 
     return can_write_status;
 }
@@ -56,12 +56,89 @@ eeprom_global_variables_t g_eeprom_variables;
 
 ==============================================================================*/
 #define NUMBER_OF_FLASH_PAGES_PAGEx 8
+
+/* Largest global structure the RAM index can map */
+#ifndef EMULATED_EEPROM_MAX_STRUCT_SIZE
+#define EMULATED_EEPROM_MAX_STRUCT_SIZE ((uint32_t)4096)
+#endif
+
+#define EMULATED_EEPROM_RECORD_SIZE ((uint32_t)4)
+#define EMULATED_EEPROM_RECORDS_PER_PAGE (EMULATED_EEPROM_PAGE_SIZE / EMULATED_EEPROM_RECORD_SIZE)
+
+/* RAM index of the active page: record slot holding the latest value of each
+   2 byte virtual address, 0 when the address was never written (slot 0 is the
+   page status word) */
+static uint16_t eeprom_index[EMULATED_EEPROM_MAX_STRUCT_SIZE / 2];
+static uint32_t eeprom_index_page_base;
+static bool eeprom_index_valid;
+
+/* Journaled mode page layout: sequence number, page commit marker, records.
+   A commit record closes every batch, its high half holds the number of
+   records of the batch written right before it */
+#define EMULATED_EEPROM_NB_HEADER_SLOTS 2
+#define EMULATED_EEPROM_NB_PAGE_COMMITTED ((uint32_t)0xA5C35A3C)
+#define EMULATED_EEPROM_NB_COMMIT_TAG ((uint16_t)0xC3A5)
+#define EMULATED_EEPROM_NB_PAGE_BASE(page) (EEPROM_START_ADDRESS + ((uint32_t)(page) * EMULATED_EEPROM_PAGE_SIZE))
+
+#if (EMULATED_EEPROM_NB_PAGE_COUNT < 2) || ((EMULATED_EEPROM_NB_PAGE_COUNT * 0x4000) > (WORKFLASH_LARGE_END_ADDRESS + 1 - 0x14000000))
+#error "EMULATED_EEPROM_NB_PAGE_COUNT pages do not fit the large sectors of the work flash"
+#endif
+
 /*==============================================================================
 
                       LOCAL DEFINITIONS AND TYPES : ENUMS
 
 ==============================================================================*/
 
+typedef enum
+{
+    __EEPROM_NB_IDLE = 0,
+    __EEPROM_NB_PROGRAM,      /* batch records to the active page */
+    __EEPROM_NB_COMMIT,       /* batch commit record */
+    __EEPROM_NB_APPLY,        /* batch is durable, point the index at it */
+    __EEPROM_NB_ERASE,        /* next page of the ring, one sector per step */
+    __EEPROM_NB_HEADER,       /* sequence number of the next page */
+    __EEPROM_NB_COPY,         /* latest value of every address, batch included */
+    __EEPROM_NB_COPY_COMMIT,  /* commit record closing the copy */
+    __EEPROM_NB_PAGE_COMMIT,  /* page commit marker, the next page becomes valid */
+    __EEPROM_NB_SWITCH,       /* index the next page */
+} __eeprom_nb_state_e;
+
+/*==============================================================================
+
+                    LOCAL DEFINITIONS AND TYPES : STRUCTURES
+
+==============================================================================*/
+typedef struct
+{
+    uint16_t VirtAddress;
+    uint16_t Data;
+} eeprom_journal_entry_t;
+
+typedef struct
+{
+    bool enabled;
+    __eeprom_nb_state_e state;
+    uint8_t active_page;
+    uint8_t target_page;
+    uint8_t erase_sector;
+    uint32_t sequence;
+    uint32_t write_address;  /* next blank slot of the active page */
+    uint32_t batch_slot;     /* slot of the first batch record */
+    uint16_t batch_pos;
+    uint16_t copy_vaddr;
+    uint32_t copy_address;
+    uint16_t copy_count;
+} eeprom_nb_engine_t;
+
+/* writes waiting for the next batch, and the batch being programmed */
+static eeprom_journal_entry_t eeprom_journal[EMULATED_EEPROM_JOURNAL_SIZE];
+static uint16_t eeprom_journal_count;
+static eeprom_journal_entry_t eeprom_batch[EMULATED_EEPROM_JOURNAL_SIZE];
+static uint16_t eeprom_batch_count;
+static uint8_t eeprom_batch_map[EMULATED_EEPROM_MAX_STRUCT_SIZE / 16]; /* one bit per batch address */
+static eeprom_nb_engine_t eeprom_nb;
+
 /*==============================================================================
 
                             LOCAL FUNCTION PROTOTYPES
@@ -74,6 +151,18 @@ static inline uint16_t __asdk_emulated_eeprom_verifypagefullwritevariable(uint16
 static inline uint16_t __asdk_emulated_eeprom_pagetransfer(uint8_t *struct_member_add, uint8_t *structure_address, uint32_t struct_member_address, uint32_t g_structure_size);
 static inline bool __asdk_emulated_eeprom_verifypagefullyerased(uint32_t address);
 static inline cy_en_flashdrv_status_t __asdk_flash_blank_check(uint32_t address, uint32_t no_of_var);
+static void __asdk_emulated_eeprom_index_reset(uint32_t page_base);
+static uint32_t __asdk_emulated_eeprom_index_build(uint32_t page_base, uint8_t *structure_address);
+static bool __asdk_emulated_eeprom_lookup(uint16_t VirtualAddress, uint16_t *Data);
+static uint32_t __asdk_emulated_eeprom_first_blank_slot(uint32_t page_base, uint32_t first_slot);
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_erase_page(uint8_t page);
+static asdk_flash_operation_mode_t __asdk_emulated_eeprom_flash_mode(asdk_emulated_eeprom_operation_mode_t mode);
+static bool __asdk_emulated_eeprom_nb_find_legacy(uint8_t *legacy_page);
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_migrate(uint8_t legacy_page, uint8_t target_page, uint8_t *structure_address);
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_init(uint8_t *structure_address);
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_write(uint8_t *var_source, uint8_t *struct_source, uint32_t var_size);
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_program(uint32_t address, uint32_t word);
+static void __asdk_emulated_eeprom_nb_take_batch(void);
 
 /*******************************************************************************
  * Function __asdk_workflash_blank_check
@@ -146,6 +235,7 @@ static inline bool __asdk_emulated_eeprom_format()
     /* Mark Page0 as valid */
     g_eeprom_variables.Page_Status = VALID_PAGE;
     g_eeprom_variables.Destination_Address = (PAGE0_BASE_ADDRESS + 4);
+    __asdk_emulated_eeprom_index_reset(PAGE0_BASE_ADDRESS);
 
     asdk_flash_operation_config_t flash_write_config_t = {
         .size_in_bytes = 4,
@@ -199,62 +289,159 @@ static inline bool __asdk_emulated_eeprom_format()
  ****************************************************************************************/
 static inline bool __asdk_emulated_eeprom_verifypagefullyerased(uint32_t Address)
 {
-    bool ReadStatus = (bool)INITIAL_VALUE;
-    uint32_t AddressValue = PAGE0_BASE_ADDRESS;
-    cy_en_flashdrv_status_t Blank_Check_Status = CY_FLASH_DRV_SUCCESS;
+    uint32_t sector_size = INITIAL_VALUE_ZERO;
+    uint32_t page_end = PAGE0_END_ADDRESS;
 
-    /* Check each active page address starting from end */
     if ((PAGE0_BASE_ADDRESS <= Address) && (PAGE0_END_ADDRESS >= Address))
     {
-        while (Address <= PAGE0_END_ADDRESS)
+        page_end = PAGE0_END_ADDRESS;
+    }
+    else if ((PAGE1_BASE_ADDRESS <= Address) && (PAGE1_END_ADDRESS >= Address))
+    {
+        page_end = PAGE1_END_ADDRESS;
+    }
+    else
+    {
+        return false;
+    }
+
+    /* One ranged blank check per sector instead of one per word */
+    while (Address < page_end)
+    {
+        asdk_flash_get_sector_size(Address, &sector_size);
+        sector_size = sector_size - (Address % sector_size);
+
+        if (CY_FLASH_DRV_SUCCESS != __asdk_flash_blank_check(Address, sector_size / 4))
         {
+            return false;
+        }
 
-            /* Get the current location content to be compared with virtual address */
-            Blank_Check_Status = __asdk_flash_blank_check(Address, 1);
-            if (CY_FLASH_DRV_SUCCESS == Blank_Check_Status)
-            {
-                AddressValue = ERASED;
-            }
+        Address = Address + sector_size;
+    }
 
-            /* Compare the read address with the virtual address */
-            if (AddressValue != ERASED)
-            {
+    return true;
+}
+
+/**
+ * @brief  Clears the RAM index and points it at a page.
+ * @param  page_base: base address of the page the index describes
+ */
+static void __asdk_emulated_eeprom_index_reset(uint32_t page_base)
+{
+    for (uint32_t i = 0; i < (EMULATED_EEPROM_MAX_STRUCT_SIZE / 2); i++)
+    {
+        eeprom_index[i] = INITIAL_VALUE_ZERO;
+    }
 
-                /* In case variable value is read, reset ReadStatus flag */
-                ReadStatus = 0;
+    eeprom_index_page_base = page_base;
+    eeprom_index_valid = true;
+}
 
-                break;
-            }
-            /* Next address location */
-            Address = Address + 4;
+/**
+ * @brief  Finds the first blank record slot of a page. Records are appended
+ *   in order, so a binary search of single word blank checks is enough.
+ * @param  page_base: base address of the page
+ * @param  first_slot: first record slot after the page header
+ * @retval first blank slot, RECORDS_PER_PAGE when the page is full
+ */
+static uint32_t __asdk_emulated_eeprom_first_blank_slot(uint32_t page_base, uint32_t first_slot)
+{
+    uint32_t low = first_slot;
+    uint32_t high = EMULATED_EEPROM_RECORDS_PER_PAGE;
+
+    while (low < high)
+    {
+        uint32_t mid = low + ((high - low) / 2);
+
+        if (CY_FLASH_DRV_SUCCESS == __asdk_flash_blank_check(page_base + (mid * EMULATED_EEPROM_RECORD_SIZE), 1))
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1;
         }
     }
-    else if ((PAGE1_BASE_ADDRESS <= Address) && (PAGE1_END_ADDRESS >= Address))
+
+    return low;
+}
+
+/**
+ * @brief  Latest value of a 2 byte virtual address: journaled and in-flight
+ *   writes of the journaled mode first, then the active page.
+ * @param  VirtualAddress: even byte offset in the structure
+ * @param  Data: value read back
+ * @retval false when the address was never written
+ */
+static bool __asdk_emulated_eeprom_lookup(uint16_t VirtualAddress, uint16_t *Data)
+{
+    uint16_t slot = eeprom_index[VirtualAddress / 2];
+
+    for (uint16_t i = 0; i < eeprom_journal_count; i++)
     {
-        while (Address <= PAGE1_END_ADDRESS)
+        if (VirtualAddress == eeprom_journal[i].VirtAddress)
         {
-            Blank_Check_Status = __asdk_flash_blank_check(Address, 1);
-            if (CY_FLASH_DRV_SUCCESS == Blank_Check_Status)
-            {
-                AddressValue = ERASED;
-            }
+            *Data = eeprom_journal[i].Data;
+            return true;
+        }
+    }
 
-            /* Compare the read address with the virtual address */
-            if (AddressValue != ERASED)
-            {
+    for (uint16_t i = 0; i < eeprom_batch_count; i++)
+    {
+        if (VirtualAddress == eeprom_batch[i].VirtAddress)
+        {
+            *Data = eeprom_batch[i].Data;
+            return true;
+        }
+    }
+
+    if (INITIAL_VALUE_ZERO == slot)
+    {
+        return false;
+    }
 
-                /* In case variable value is read, reset ReadStatus flag */
-                ReadStatus = 0;
+    *Data = (*(volatile uint16_t *)(eeprom_index_page_base + (slot * EMULATED_EEPROM_RECORD_SIZE) + 2));
+    return true;
+}
 
-                break;
-            }
-            /* Next address location */
-            Address = Address + 4;
+/**
+ * @brief  Builds the RAM index of a valid page in one pass and copies the
+ *   latest value of every written virtual address into the structure.
+ *   Records are appended in order, so the first blank slot is found by a
+ *   binary search and the records ahead of it are read without blank checks.
+ * @param  page_base: base address of the valid page
+ * @param  structure_address: global structure to be updated
+ * @retval address of the first blank slot, next write destination
+ */
+static uint32_t __asdk_emulated_eeprom_index_build(uint32_t page_base, uint8_t *structure_address)
+{
+    uint32_t low = __asdk_emulated_eeprom_first_blank_slot(page_base, 1);
+    uint32_t index_size = g_eeprom_variables.Var_Size_Backup / 2;
+
+    __asdk_emulated_eeprom_index_reset(page_base);
+
+    for (uint32_t slot = 1; slot < low; slot++)
+    {
+        uint32_t record = *(volatile uint32_t *)(page_base + (slot * EMULATED_EEPROM_RECORD_SIZE));
+        uint16_t VirtualAddress = (uint16_t)(record & 0xFFFF);
+
+        if ((VirtualAddress / 2) < index_size)
+        {
+            eeprom_index[VirtualAddress / 2] = (uint16_t)slot;
         }
     }
-    /* Return ReadStatus value: (0: Page not erased, 1: Sector erased) */
-    return ReadStatus;
+
+    for (uint32_t i = 0; i < index_size; i++)
+    {
+        if (INITIAL_VALUE_ZERO != eeprom_index[i])
+        {
+            (*(uint16_t *)(structure_address + (i * 2))) = (*(volatile uint16_t *)(page_base + (eeprom_index[i] * EMULATED_EEPROM_RECORD_SIZE) + 2));
+        }
+    }
+
+    return page_base + (low * EMULATED_EEPROM_RECORD_SIZE);
 }
+
 /**
  * @brief  Find valid Page for write or read operation
  * @param  Operation: operation to achieve on the valid page.
@@ -405,6 +592,12 @@ static inline uint16_t __asdk_emulated_eeprom_verifypagefullwritevariable(uint16
             if (ASDK_FLASH_STATUS_SUCCESS == flash_error)
             {
                 FlashStatus = INITIAL_VALUE_ZERO;
+
+                /* latest copy of this address now lives in the new slot */
+                if ((VirtAddress / 2) < (EMULATED_EEPROM_MAX_STRUCT_SIZE / 2))
+                {
+                    eeprom_index[VirtAddress / 2] = (uint16_t)((g_eeprom_variables.Destination_Address - eeprom_index_page_base) / EMULATED_EEPROM_RECORD_SIZE);
+                }
             }
             else
             {
@@ -446,15 +639,12 @@ static inline uint16_t __asdk_emulated_eeprom_pagetransfer(uint8_t *var_source,
     uint32_t sector_size = INITIAL_VALUE_ZERO;
     uint32_t Base_Sector_Address = 0;
 
-    cy_en_flashdrv_status_t Blank_Check_Status = CY_FLASH_DRV_SUCCESS;
     uint8_t arr_for_page_transfer[g_eeprom_variables.Var_Size_Backup];
     uint32_t size_of_var_to_transfer = g_eeprom_variables.Var_Size_Backup;
     asdk_errorcode_t flash_error_status = ASDK_FLASH_STATUS_SUCCESS;
 
-    /*Variables for the addr offset  and var size to be 2bytes offset*/
-    addr_offset = struct_source - var_source;
-    var_size = var_size + (var_size % 2);
-    addr_offset = addr_offset - (addr_offset % 2);
+    /*Byte offset of the pending member, it is copied as is over the transferred data*/
+    addr_offset = var_source - struct_source;
 
     /*Get the Valid Page from which data will be transferred to the new page*/
     ValidPage = __asdk_emulated_eeprom_findvalidpage(READ_FROM_VALID_PAGE);
@@ -497,19 +687,21 @@ static inline uint16_t __asdk_emulated_eeprom_pagetransfer(uint8_t *var_source,
 
     /* Transfer data from Page1 to Page0 */
     // Logic for trasferring data from old page to new page
-    // Update the structure with the latest values.
+    // The index holds the latest slot of every address, never written ones keep the structure value.
     Oldpage = (OldPageID - 4);
-    Blank_Check_Status = __asdk_flash_blank_check(OldPageID, 1);
-    while (Blank_Check_Status)
+    for (VirtualAddress = 0; VirtualAddress < (g_eeprom_variables.Var_Size_Backup & ~1u); VirtualAddress += 2)
     {
-
-        VirtualAddress = (*(uint16_t *)OldPageID);
-        (*(uint16_t *)(arr_for_page_transfer + VirtualAddress)) = (((*(uint32_t *)(OldPageID)) >> 16) & 0xFFFF);
-        OldPageID = OldPageID + 4;
-        Blank_Check_Status = __asdk_flash_blank_check(OldPageID, 1);
+        if (INITIAL_VALUE_ZERO != eeprom_index[VirtualAddress / 2])
+        {
+            (*(uint16_t *)(arr_for_page_transfer + VirtualAddress)) = (*(volatile uint16_t *)(Oldpage + (eeprom_index[VirtualAddress / 2] * EMULATED_EEPROM_RECORD_SIZE) + 2));
+        }
+        else
+        {
+            (*(uint16_t *)(arr_for_page_transfer + VirtualAddress)) = (*(uint16_t *)((uint8_t *)g_eeprom_variables.structure_base_address_ptr + VirtualAddress));
+        }
     }
 
-    for (uint16_t i = 0; i < var_size; i++)
+    for (uint16_t i = 0; (i < var_size) && (addr_offset < g_eeprom_variables.Var_Size_Backup); i++)
     {
         arr_for_page_transfer[addr_offset] = var_source[i];
         addr_offset = addr_offset + 1;
@@ -525,7 +717,8 @@ static inline uint16_t __asdk_emulated_eeprom_pagetransfer(uint8_t *var_source,
         flash_write_config_t.source_addr = (uint32_t)(&Data_To_Write);
         flash_write_config_t.size_in_bytes = 4;
 
-        flash_error_status = asdk_flash_write_blocking(&flash_write_config_t, 10);
+        /* consecutive records, the flash DAL programs them a row at a time */
+        flash_error_status = asdk_flash_write_buffered(&flash_write_config_t, 10);
         if (ASDK_FLASH_STATUS_SUCCESS != flash_error_status)
         {
             FlashStatus = INITIAL_VALUE;
@@ -537,6 +730,25 @@ static inline uint16_t __asdk_emulated_eeprom_pagetransfer(uint8_t *var_source,
         Iteration_Loop = Iteration_Loop + 1;
     }
     g_eeprom_variables.Destination_Address = flash_write_config_t.destination_addr + 4;
+
+    /* every record must be in flash before the page is marked valid */
+    flash_error_status = asdk_flash_flush(10);
+    if (ASDK_FLASH_STATUS_SUCCESS != flash_error_status)
+    {
+        FlashStatus = INITIAL_VALUE;
+        return FlashStatus;
+    }
+
+    /* new page holds one record per address, in address order from slot 1 */
+    __asdk_emulated_eeprom_index_reset(NewPageAddress);
+    for (uint32_t i = 0; i < (Iteration_Loop - 1); i++)
+    {
+        if (i < (EMULATED_EEPROM_MAX_STRUCT_SIZE / 2))
+        {
+            eeprom_index[i] = (uint16_t)(i + 1);
+        }
+    }
+
     /* Set new Page status to VALID_PAGE status */
     flash_write_config_t.destination_addr = NewPageAddress;
     g_eeprom_variables.Page_Status = VALID_PAGE;
@@ -579,6 +791,626 @@ static inline uint16_t __asdk_emulated_eeprom_pagetransfer(uint8_t *var_source,
     return FlashStatus;
 }
 
+/*==============================================================================
+
+                      JOURNALED MODE : JOURNAL AND PAGE RING
+
+==============================================================================*/
+
+/**
+ * @brief  Flash driver mode of an emulated EEPROM mode, the journaled mode
+ *   programs through the flash completion interrupt.
+ * @param  mode: emulated EEPROM operation mode
+ * @retval flash operation mode, invalid modes are left to asdk_flash_init()
+ */
+static asdk_flash_operation_mode_t __asdk_emulated_eeprom_flash_mode(asdk_emulated_eeprom_operation_mode_t mode)
+{
+    if (ASDK_EMULATED_EEPROM_OPERATION_JOURNALED_MODE == mode)
+    {
+        return ASDK_FLASH_OPERATION_NON_BLOCKING_MODE;
+    }
+
+    return (asdk_flash_operation_mode_t)mode;
+}
+
+/**
+ * @brief  Starts programming one record word, the engine steps only once the
+ *   flash reports completion.
+ * @param  address: work flash address of the word
+ * @param  word: record to be programmed
+ * @retval ASDK_EMULATED_EEPROM_STATUS_BUSY when started, ASDK_EMULATED_EEPROM_STATUS_ERROR otherwise
+ */
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_program(uint32_t address, uint32_t word)
+{
+    asdk_flash_operation_config_t flash_write_config = {
+        .size_in_bytes = EMULATED_EEPROM_RECORD_SIZE,
+        .source_addr = (uint32_t)&word,
+        .destination_addr = address,
+    };
+
+    /* the flash driver copies the word before returning */
+    if (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_write_non_blocking(&flash_write_config))
+    {
+        return ASDK_EMULATED_EEPROM_STATUS_ERROR;
+    }
+
+    return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+}
+
+/**
+ * @brief  Moves the journal into the batch, writes issued from now on go to
+ *   the next batch.
+ */
+static void __asdk_emulated_eeprom_nb_take_batch(void)
+{
+    for (uint16_t i = 0; i < eeprom_journal_count; i++)
+    {
+        eeprom_batch[i] = eeprom_journal[i];
+    }
+
+    eeprom_batch_count = eeprom_journal_count;
+    eeprom_journal_count = 0;
+    eeprom_nb.batch_pos = 0;
+}
+
+/**
+ * @brief  Erases the sectors of a ring page that are not blank yet.
+ * @param  page: page of the ring
+ * @retval ASDK_EMULATED_EEPROM_STATUS_SUCCESS or ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL
+ */
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_erase_page(uint8_t page)
+{
+    uint32_t page_base = EMULATED_EEPROM_NB_PAGE_BASE(page);
+    uint32_t sector_size = INITIAL_VALUE_ZERO;
+
+    for (uint32_t address = page_base; address < (page_base + EMULATED_EEPROM_PAGE_SIZE); address += sector_size)
+    {
+        asdk_flash_get_sector_size(address, &sector_size);
+        if ((CY_FLASH_DRV_SUCCESS != __asdk_flash_blank_check(address, sector_size / 4)) &&
+            (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_erase_sector_blocking(address, 100)))
+        {
+            return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+        }
+    }
+
+    return ASDK_EMULATED_EEPROM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief  Finds the valid page of the two page format, Page0 or Page1
+ *   marked VALID_PAGE. When both are marked the one with a blank last record
+ *   is the active one, as in asdk_emulated_eeprom_init().
+ * @param  legacy_page: ring page holding it, PAGE0 or PAGE1
+ * @retval false when neither page is valid
+ */
+static bool __asdk_emulated_eeprom_nb_find_legacy(uint8_t *legacy_page)
+{
+    bool valid0 = (CY_FLASH_DRV_SUCCESS != __asdk_flash_blank_check(PAGE0_BASE_ADDRESS, 1)) &&
+                  (VALID_PAGE == (*(volatile uint32_t *)PAGE0_BASE_ADDRESS));
+    bool valid1 = (CY_FLASH_DRV_SUCCESS != __asdk_flash_blank_check(PAGE1_BASE_ADDRESS, 1)) &&
+                  (VALID_PAGE == (*(volatile uint32_t *)PAGE1_BASE_ADDRESS));
+
+    if (valid0 && valid1)
+    {
+        valid0 = (CY_FLASH_DRV_SUCCESS == __asdk_flash_blank_check(PAGE0_END_ADDRESS - 3, 1)) ||
+                 (CY_FLASH_DRV_SUCCESS != __asdk_flash_blank_check(PAGE1_END_ADDRESS - 3, 1));
+    }
+
+    *legacy_page = valid0 ? PAGE0 : PAGE1;
+
+    return (valid0 || valid1);
+}
+
+/**
+ * @brief  Moves the latest values of a two page format page into a fresh ring
+ *   page, so switching a device to the journaled mode keeps its data. The
+ *   page commit marker goes last: until it is programmed the old page is
+ *   untouched and a reset repeats the migration.
+ * @param  legacy_page: valid page of the two page format
+ * @param  target_page: ring page to be written, not the legacy one
+ * @param  structure_address: global structure, updated with the migrated values
+ * @retval ASDK_EMULATED_EEPROM_STATUS_SUCCESS or ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL
+ */
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_migrate(uint8_t legacy_page, uint8_t target_page, uint8_t *structure_address)
+{
+    uint32_t legacy_base = EMULATED_EEPROM_NB_PAGE_BASE(legacy_page);
+    uint32_t page_base = EMULATED_EEPROM_NB_PAGE_BASE(target_page);
+    uint32_t index_size = (g_eeprom_variables.Var_Size_Backup + 1) / 2;
+    uint32_t address = page_base + (EMULATED_EEPROM_NB_HEADER_SLOTS * EMULATED_EEPROM_RECORD_SIZE);
+    uint32_t sequence = 1;
+    uint32_t marker = EMULATED_EEPROM_NB_PAGE_COMMITTED;
+    uint32_t record = INITIAL_VALUE_ZERO;
+    uint16_t count = 0;
+    asdk_flash_operation_config_t flash_write_config = {
+        .size_in_bytes = EMULATED_EEPROM_RECORD_SIZE,
+        .source_addr = (uint32_t)&record,
+        .destination_addr = address,
+    };
+
+    /* latest slot of every address, the structure gets the values too */
+    (void)__asdk_emulated_eeprom_index_build(legacy_base, structure_address);
+
+    if (ASDK_EMULATED_EEPROM_STATUS_SUCCESS != __asdk_emulated_eeprom_nb_erase_page(target_page))
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+    }
+
+    flash_write_config.source_addr = (uint32_t)&sequence;
+    flash_write_config.destination_addr = page_base;
+    if (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_write_blocking(&flash_write_config, 10))
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+    }
+
+    /* one record per address and a commit record closing them, as a page copy */
+    flash_write_config.source_addr = (uint32_t)&record;
+    for (uint32_t i = 0; i < index_size; i++)
+    {
+        if (INITIAL_VALUE_ZERO == eeprom_index[i])
+        {
+            continue;
+        }
+
+        record = ((uint32_t)(*(volatile uint16_t *)(legacy_base + (eeprom_index[i] * EMULATED_EEPROM_RECORD_SIZE) + 2)) << 16) | (i * 2);
+        flash_write_config.destination_addr = address;
+        if (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_write_buffered(&flash_write_config, 10))
+        {
+            return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+        }
+
+        address += EMULATED_EEPROM_RECORD_SIZE;
+        count++;
+    }
+
+    record = ((uint32_t)count << 16) | EMULATED_EEPROM_NB_COMMIT_TAG;
+    flash_write_config.destination_addr = address;
+    if ((ASDK_FLASH_STATUS_SUCCESS != asdk_flash_write_buffered(&flash_write_config, 10)) ||
+        (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_flush(10)))
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+    }
+
+    flash_write_config.source_addr = (uint32_t)&marker;
+    flash_write_config.destination_addr = page_base + EMULATED_EEPROM_RECORD_SIZE;
+    if (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_write_blocking(&flash_write_config, 10))
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+    }
+
+    return ASDK_EMULATED_EEPROM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief  Finds the committed page with the highest sequence number and
+ *   indexes it. Records are applied per commit record, so the tail of a batch
+ *   cut by a reset is ignored. When no page is committed, the valid page of
+ *   the two page format is migrated into the ring, else page 0 is
+ *   formatted.
+ * @param  structure_address: global structure to be updated
+ * @retval ASDK_EMULATED_EEPROM_STATUS_SUCCESS or ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL
+ */
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_init(uint8_t *structure_address)
+{
+    uint32_t page_base = INITIAL_VALUE_ZERO;
+    uint32_t end_slot = INITIAL_VALUE_ZERO;
+    uint32_t index_size = (g_eeprom_variables.Var_Size_Backup + 1) / 2;
+    uint8_t legacy_page = PAGE0;
+    bool found = false;
+
+    eeprom_journal_count = 0;
+    eeprom_batch_count = 0;
+    eeprom_nb.state = __EEPROM_NB_IDLE;
+    eeprom_nb.sequence = INITIAL_VALUE_ZERO;
+
+    for (uint8_t page = 0; page < EMULATED_EEPROM_NB_PAGE_COUNT; page++)
+    {
+        page_base = EMULATED_EEPROM_NB_PAGE_BASE(page);
+
+        /* erased words read back with ECC errors, check before reading */
+        if ((CY_FLASH_DRV_SUCCESS == __asdk_flash_blank_check(page_base, 1)) ||
+            (CY_FLASH_DRV_SUCCESS == __asdk_flash_blank_check(page_base + 4, 1)))
+        {
+            continue;
+        }
+
+        uint32_t sequence = (*(volatile uint32_t *)page_base);
+        uint32_t marker = (*(volatile uint32_t *)(page_base + 4));
+
+        if ((EMULATED_EEPROM_NB_PAGE_COMMITTED == marker) && (VALID_PAGE != sequence) && (ERASED != sequence) &&
+            (!found || (sequence > eeprom_nb.sequence)))
+        {
+            eeprom_nb.active_page = page;
+            eeprom_nb.sequence = sequence;
+            found = true;
+        }
+    }
+
+    if (!found && __asdk_emulated_eeprom_nb_find_legacy(&legacy_page))
+    {
+        /* written by the blocking or non-blocking mode, keep its data */
+        eeprom_nb.active_page = (legacy_page + 1) % EMULATED_EEPROM_NB_PAGE_COUNT;
+        eeprom_nb.sequence = 1;
+        found = true;
+
+        if (ASDK_EMULATED_EEPROM_STATUS_SUCCESS != __asdk_emulated_eeprom_nb_migrate(legacy_page, eeprom_nb.active_page, structure_address))
+        {
+            return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+        }
+    }
+
+    if (!found)
+    {
+        /* fresh or foreign content, start the ring on page 0 */
+        page_base = EMULATED_EEPROM_NB_PAGE_BASE(0);
+
+        if (ASDK_EMULATED_EEPROM_STATUS_SUCCESS != __asdk_emulated_eeprom_nb_erase_page(0))
+        {
+            return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+        }
+
+        uint32_t header[EMULATED_EEPROM_NB_HEADER_SLOTS] = {1, EMULATED_EEPROM_NB_PAGE_COMMITTED};
+        asdk_flash_operation_config_t flash_write_config = {
+            .size_in_bytes = sizeof(header),
+            .source_addr = (uint32_t)header,
+            .destination_addr = page_base,
+        };
+
+        if (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_write_blocking(&flash_write_config, 10))
+        {
+            return ASDK_EMULATED_EEPROM_ERROR_INIT_FAIL;
+        }
+
+        eeprom_nb.active_page = 0;
+        eeprom_nb.sequence = 1;
+    }
+
+    page_base = EMULATED_EEPROM_NB_PAGE_BASE(eeprom_nb.active_page);
+    end_slot = __asdk_emulated_eeprom_first_blank_slot(page_base, EMULATED_EEPROM_NB_HEADER_SLOTS);
+
+    __asdk_emulated_eeprom_index_reset(page_base);
+
+    for (uint32_t slot = EMULATED_EEPROM_NB_HEADER_SLOTS; slot < end_slot; slot++)
+    {
+        uint32_t record = *(volatile uint32_t *)(page_base + (slot * EMULATED_EEPROM_RECORD_SIZE));
+        uint32_t count = record >> 16;
+
+        if ((EMULATED_EEPROM_NB_COMMIT_TAG != (uint16_t)(record & 0xFFFF)) || (count > (slot - EMULATED_EEPROM_NB_HEADER_SLOTS)))
+        {
+            continue;
+        }
+
+        /* the batch is the count records right before its commit record */
+        for (uint32_t k = slot - count; k < slot; k++)
+        {
+            uint16_t VirtualAddress = (uint16_t)((*(volatile uint32_t *)(page_base + (k * EMULATED_EEPROM_RECORD_SIZE))) & 0xFFFF);
+
+            if ((VirtualAddress / 2) < index_size)
+            {
+                eeprom_index[VirtualAddress / 2] = (uint16_t)k;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < index_size; i++)
+    {
+        if (INITIAL_VALUE_ZERO != eeprom_index[i])
+        {
+            uint16_t data = (*(volatile uint16_t *)(page_base + (eeprom_index[i] * EMULATED_EEPROM_RECORD_SIZE) + 2));
+
+            structure_address[i * 2] = (uint8_t)(data & 0xFF);
+            if (((i * 2) + 1) < g_eeprom_variables.Var_Size_Backup)
+            {
+                structure_address[(i * 2) + 1] = (uint8_t)(data >> 8);
+            }
+        }
+    }
+
+    /* a cut batch leaves programmed words behind, continue after them */
+    eeprom_nb.write_address = page_base + (end_slot * EMULATED_EEPROM_RECORD_SIZE);
+    eeprom_nb.enabled = true;
+
+    return ASDK_EMULATED_EEPROM_STATUS_SUCCESS;
+}
+
+/**
+ * @brief  Journals the 2 byte variables covering a structure member. The
+ *   values are taken from the structure, a variable already journaled is
+ *   overwritten in place.
+ * @param  var_source: structure member
+ * @param  struct_source: global structure
+ * @param  var_size: size of the member
+ * @retval ASDK_EMULATED_EEPROM_STATUS_SUCCESS, or ASDK_EMULATED_EEPROM_STATUS_BUSY when
+ *   the journal cannot take the whole member, nothing is journaled then
+ */
+static asdk_errorcode_t __asdk_emulated_eeprom_nb_write(uint8_t *var_source, uint8_t *struct_source, uint32_t var_size)
+{
+    uint32_t first = (uint32_t)(var_source - struct_source) & ~1u;
+    uint32_t end = (uint32_t)(var_source - struct_source) + var_size;
+    uint16_t needed = 0;
+
+    if ((var_source < struct_source) || (end > g_eeprom_variables.Var_Size_Backup))
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_INVALID_DATA_SIZE;
+    }
+
+    for (uint32_t VirtualAddress = first; VirtualAddress < end; VirtualAddress += 2)
+    {
+        uint16_t i = 0;
+
+        while ((i < eeprom_journal_count) && (VirtualAddress != eeprom_journal[i].VirtAddress))
+        {
+            i++;
+        }
+
+        if (i == eeprom_journal_count)
+        {
+            needed++;
+        }
+    }
+
+    if ((eeprom_journal_count + needed) > EMULATED_EEPROM_JOURNAL_SIZE)
+    {
+        return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+    }
+
+    for (uint32_t VirtualAddress = first; VirtualAddress < end; VirtualAddress += 2)
+    {
+        uint16_t i = 0;
+        uint16_t data = struct_source[VirtualAddress];
+
+        if ((VirtualAddress + 1) < g_eeprom_variables.Var_Size_Backup)
+        {
+            data |= (uint16_t)(struct_source[VirtualAddress + 1] << 8);
+        }
+        else
+        {
+            data |= 0xFF00;
+        }
+
+        while ((i < eeprom_journal_count) && (VirtualAddress != eeprom_journal[i].VirtAddress))
+        {
+            i++;
+        }
+
+        eeprom_journal[i].VirtAddress = (uint16_t)VirtualAddress;
+        eeprom_journal[i].Data = data;
+
+        if (i == eeprom_journal_count)
+        {
+            eeprom_journal_count++;
+        }
+    }
+
+    return ASDK_EMULATED_EEPROM_STATUS_SUCCESS;
+}
+
+/*Journaled mode engine step, one flash operation per call*/
+asdk_errorcode_t asdk_emulated_eeprom_iteration(void)
+{
+    uint32_t sector_size = INITIAL_VALUE_ZERO;
+    uint32_t page_base = INITIAL_VALUE_ZERO;
+    uint32_t index_size = INITIAL_VALUE_ZERO;
+
+    if (!eeprom_nb.enabled)
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_NOT_INITIALIZED;
+    }
+
+    if (!asdk_flash_is_operation_complete())
+    {
+        return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+    }
+
+    index_size = (g_eeprom_variables.Var_Size_Backup + 1) / 2;
+
+    /* states that start no flash operation fall through to the next one */
+    for (;;)
+    {
+        switch (eeprom_nb.state)
+        {
+        case __EEPROM_NB_IDLE:
+            if (0 == eeprom_journal_count)
+            {
+                return ASDK_EMULATED_EEPROM_STATUS_SUCCESS;
+            }
+
+            __asdk_emulated_eeprom_nb_take_batch();
+            page_base = EMULATED_EEPROM_NB_PAGE_BASE(eeprom_nb.active_page);
+
+            if ((eeprom_nb.write_address + ((eeprom_batch_count + 1) * EMULATED_EEPROM_RECORD_SIZE)) <= (page_base + EMULATED_EEPROM_PAGE_SIZE))
+            {
+                eeprom_nb.batch_slot = (eeprom_nb.write_address - page_base) / EMULATED_EEPROM_RECORD_SIZE;
+                eeprom_nb.state = __EEPROM_NB_PROGRAM;
+            }
+            else
+            {
+                /* page full, the batch travels with the copy to the next page of the ring */
+                for (uint32_t i = 0; i < sizeof(eeprom_batch_map); i++)
+                {
+                    eeprom_batch_map[i] = 0;
+                }
+                for (uint16_t i = 0; i < eeprom_batch_count; i++)
+                {
+                    eeprom_batch_map[eeprom_batch[i].VirtAddress / 16] |= (uint8_t)(1u << ((eeprom_batch[i].VirtAddress / 2) % 8));
+                }
+
+                eeprom_nb.target_page = (eeprom_nb.active_page + 1) % EMULATED_EEPROM_NB_PAGE_COUNT;
+                eeprom_nb.erase_sector = 0;
+                eeprom_nb.state = __EEPROM_NB_ERASE;
+            }
+            break;
+
+        case __EEPROM_NB_PROGRAM:
+            if (eeprom_nb.batch_pos < eeprom_batch_count)
+            {
+                eeprom_journal_entry_t *entry = &eeprom_batch[eeprom_nb.batch_pos];
+
+                if (ASDK_EMULATED_EEPROM_STATUS_BUSY != __asdk_emulated_eeprom_nb_program(eeprom_nb.write_address, ((uint32_t)entry->Data << 16) | entry->VirtAddress))
+                {
+                    return ASDK_EMULATED_EEPROM_STATUS_ERROR;
+                }
+
+                eeprom_nb.batch_pos++;
+                eeprom_nb.write_address += EMULATED_EEPROM_RECORD_SIZE;
+                return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+            }
+
+            eeprom_nb.state = __EEPROM_NB_COMMIT;
+            break;
+
+        case __EEPROM_NB_COMMIT:
+            if (ASDK_EMULATED_EEPROM_STATUS_BUSY != __asdk_emulated_eeprom_nb_program(eeprom_nb.write_address, ((uint32_t)eeprom_batch_count << 16) | EMULATED_EEPROM_NB_COMMIT_TAG))
+            {
+                return ASDK_EMULATED_EEPROM_STATUS_ERROR;
+            }
+
+            eeprom_nb.write_address += EMULATED_EEPROM_RECORD_SIZE;
+            eeprom_nb.state = __EEPROM_NB_APPLY;
+            return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+
+        case __EEPROM_NB_APPLY:
+            for (uint16_t i = 0; i < eeprom_batch_count; i++)
+            {
+                eeprom_index[eeprom_batch[i].VirtAddress / 2] = (uint16_t)(eeprom_nb.batch_slot + i);
+            }
+
+            eeprom_batch_count = 0;
+            eeprom_nb.state = __EEPROM_NB_IDLE;
+            break;
+
+        case __EEPROM_NB_ERASE:
+            if (eeprom_nb.erase_sector < NUMBER_OF_FLASH_PAGES_PAGEx)
+            {
+                /* sector 0 first, it takes the old header and commit marker with it */
+                page_base = EMULATED_EEPROM_NB_PAGE_BASE(eeprom_nb.target_page);
+                asdk_flash_get_sector_size(page_base, &sector_size);
+                page_base = page_base + (eeprom_nb.erase_sector * sector_size);
+
+                if (CY_FLASH_DRV_SUCCESS == __asdk_flash_blank_check(page_base, sector_size / 4))
+                {
+                    eeprom_nb.erase_sector++;
+                    break;
+                }
+
+                if (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_erase_sector_non_blocking(page_base))
+                {
+                    return ASDK_EMULATED_EEPROM_STATUS_ERROR;
+                }
+
+                eeprom_nb.erase_sector++;
+                return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+            }
+
+            eeprom_nb.state = __EEPROM_NB_HEADER;
+            break;
+
+        case __EEPROM_NB_HEADER:
+            page_base = EMULATED_EEPROM_NB_PAGE_BASE(eeprom_nb.target_page);
+
+            if (ASDK_EMULATED_EEPROM_STATUS_BUSY != __asdk_emulated_eeprom_nb_program(page_base, eeprom_nb.sequence + 1))
+            {
+                return ASDK_EMULATED_EEPROM_STATUS_ERROR;
+            }
+
+            eeprom_nb.copy_vaddr = 0;
+            eeprom_nb.copy_count = 0;
+            eeprom_nb.copy_address = page_base + (EMULATED_EEPROM_NB_HEADER_SLOTS * EMULATED_EEPROM_RECORD_SIZE);
+            eeprom_nb.state = __EEPROM_NB_COPY;
+            return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+
+        case __EEPROM_NB_COPY:
+            while ((eeprom_nb.copy_vaddr / 2) < index_size)
+            {
+                uint16_t VirtualAddress = eeprom_nb.copy_vaddr;
+                uint16_t slot = eeprom_index[VirtualAddress / 2];
+                uint16_t data = INITIAL_VALUE_ZERO;
+
+                eeprom_nb.copy_vaddr += 2;
+
+                /* batch value first, else the latest record of the old page */
+                if (eeprom_batch_map[VirtualAddress / 16] & (1u << ((VirtualAddress / 2) % 8)))
+                {
+                    for (uint16_t i = 0; i < eeprom_batch_count; i++)
+                    {
+                        if (VirtualAddress == eeprom_batch[i].VirtAddress)
+                        {
+                            data = eeprom_batch[i].Data;
+                        }
+                    }
+                }
+                else if (INITIAL_VALUE_ZERO != slot)
+                {
+                    data = (*(volatile uint16_t *)(eeprom_index_page_base + (slot * EMULATED_EEPROM_RECORD_SIZE) + 2));
+                }
+                else
+                {
+                    continue;
+                }
+
+                if (ASDK_EMULATED_EEPROM_STATUS_BUSY != __asdk_emulated_eeprom_nb_program(eeprom_nb.copy_address, ((uint32_t)data << 16) | VirtualAddress))
+                {
+                    eeprom_nb.copy_vaddr -= 2;
+                    return ASDK_EMULATED_EEPROM_STATUS_ERROR;
+                }
+
+                eeprom_nb.copy_count++;
+                eeprom_nb.copy_address += EMULATED_EEPROM_RECORD_SIZE;
+                return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+            }
+
+            eeprom_nb.state = __EEPROM_NB_COPY_COMMIT;
+            break;
+
+        case __EEPROM_NB_COPY_COMMIT:
+            if (ASDK_EMULATED_EEPROM_STATUS_BUSY != __asdk_emulated_eeprom_nb_program(eeprom_nb.copy_address, ((uint32_t)eeprom_nb.copy_count << 16) | EMULATED_EEPROM_NB_COMMIT_TAG))
+            {
+                return ASDK_EMULATED_EEPROM_STATUS_ERROR;
+            }
+
+            eeprom_nb.copy_address += EMULATED_EEPROM_RECORD_SIZE;
+            eeprom_nb.state = __EEPROM_NB_PAGE_COMMIT;
+            return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+
+        case __EEPROM_NB_PAGE_COMMIT:
+            page_base = EMULATED_EEPROM_NB_PAGE_BASE(eeprom_nb.target_page);
+
+            if (ASDK_EMULATED_EEPROM_STATUS_BUSY != __asdk_emulated_eeprom_nb_program(page_base + EMULATED_EEPROM_RECORD_SIZE, EMULATED_EEPROM_NB_PAGE_COMMITTED))
+            {
+                return ASDK_EMULATED_EEPROM_STATUS_ERROR;
+            }
+
+            eeprom_nb.state = __EEPROM_NB_SWITCH;
+            return ASDK_EMULATED_EEPROM_STATUS_BUSY;
+
+        case __EEPROM_NB_SWITCH:
+        {
+            /* copied in address order from the first record slot */
+            uint16_t slot = EMULATED_EEPROM_NB_HEADER_SLOTS;
+
+            for (uint32_t i = 0; i < index_size; i++)
+            {
+                if ((INITIAL_VALUE_ZERO != eeprom_index[i]) || (eeprom_batch_map[i / 8] & (1u << (i % 8))))
+                {
+                    eeprom_index[i] = slot++;
+                }
+            }
+
+            eeprom_index_page_base = EMULATED_EEPROM_NB_PAGE_BASE(eeprom_nb.target_page);
+            eeprom_nb.active_page = eeprom_nb.target_page;
+            eeprom_nb.sequence++;
+            eeprom_nb.write_address = eeprom_nb.copy_address;
+            eeprom_batch_count = 0;
+            eeprom_nb.state = __EEPROM_NB_IDLE;
+            break;
+        }
+
+        default:
+            eeprom_nb.state = __EEPROM_NB_IDLE;
+            break;
+        }
+    }
+}
+
 /*!Initlialization function for the emulated eeprom module*/
 uint32_t PageStatus0 = INVALID_PAGE;
 uint32_t PageStatus1 = INVALID_PAGE;
@@ -593,10 +1425,22 @@ asdk_errorcode_t asdk_emulated_eeprom_init(asdk_emulated_eeprom_init_deinit_conf
 
     uint32_t sector_size = 0;
 
+    if ((NULL == eeeprom_init_config) || (NULL == global_structure_address))
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_NULL_PTR;
+    }
+
+    /* the RAM index maps one slot per 2 bytes of the structure */
+    if (EMULATED_EEPROM_MAX_STRUCT_SIZE < global_structure_size)
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_INVALID_DATA_SIZE;
+    }
+
     /*Variable declaration*/
     asdk_flash_config_t flash_init_config = {
-        .flash_operation_mode = eeeprom_init_config->emulated_eeprom_operation_mode,
+        .flash_operation_mode = __asdk_emulated_eeprom_flash_mode(eeeprom_init_config->emulated_eeprom_operation_mode),
         .flash_type = eeeprom_init_config->flash_type_used,
+        .flash_interrupt_config.intr_num = eeeprom_init_config->intr_num,
     };
 
     /*Initialize the flash for eeprom emulation*/
@@ -611,8 +1455,12 @@ asdk_errorcode_t asdk_emulated_eeprom_init(asdk_emulated_eeprom_init_deinit_conf
     g_eeprom_variables.Var_Size_Backup = global_structure_size;
     g_eeprom_variables.structure_base_address_ptr = (uint32_t *)(global_structure_address);
 
-    uint32_t Page0Address = (PAGE0_BASE_ADDRESS + 4);
-    uint32_t Page1Address = (PAGE1_BASE_ADDRESS + 4);
+    /* journaled writes over the page ring, see asdk_emulated_eeprom_iteration() */
+    eeprom_nb.enabled = false;
+    if (ASDK_EMULATED_EEPROM_OPERATION_JOURNALED_MODE == eeeprom_init_config->emulated_eeprom_operation_mode)
+    {
+        return __asdk_emulated_eeprom_nb_init(global_structure_address);
+    }
 
     Blank_Check_Status = __asdk_flash_blank_check(PAGE0_BASE_ADDRESS, 1);
     if (CY_FLASH_DRV_SUCCESS == Blank_Check_Status)
@@ -648,19 +1496,8 @@ asdk_errorcode_t asdk_emulated_eeprom_init(asdk_emulated_eeprom_init_deinit_conf
     case ERASED:
         if (VALID_PAGE == PageStatus1)
         {
-            /*Copy the latest data from valid page to the structure passed as parameter*/
-            uint16_t VirtualAddress = 0;
-            Blank_Check_Status = __asdk_flash_blank_check(PAGE1_BASE_ADDRESS + 4, 1);
-            while (Blank_Check_Status)
-            {
-
-                VirtualAddress = (*(uint16_t *)Page1Address);
-                (*(uint16_t *)(global_structure_address + VirtualAddress)) = (((*(uint32_t *)(Page1Address)) >> 16) & 0xFFFF);
-                Page1Address = Page1Address + 4;
-                Blank_Check_Status = __asdk_flash_blank_check(Page1Address, 1);
-            }
-
-            g_eeprom_variables.Destination_Address = Page1Address;
+            /*Index the valid page and copy the latest data to the structure passed as parameter*/
+            g_eeprom_variables.Destination_Address = __asdk_emulated_eeprom_index_build(PAGE1_BASE_ADDRESS, global_structure_address);
 
             asdk_errorcode_t flash_error = ASDK_FLASH_STATUS_SUCCESS;
 
@@ -699,19 +1536,8 @@ asdk_errorcode_t asdk_emulated_eeprom_init(asdk_emulated_eeprom_init_deinit_conf
             Page1_Blank_Check_Status = __asdk_flash_blank_check(PAGE1_END_ADDRESS - 4, 1);
             if (CY_FLASH_DRV_SUCCESS == Page0_Blank_Check_Status)
             {
-                /*Copy the latest data from valid page to the structure passed as parameter*/
-                uint16_t VirtualAddress = 0;
-                Blank_Check_Status = __asdk_flash_blank_check(PAGE0_BASE_ADDRESS, 1);
-                while (Blank_Check_Status)
-                {
-
-                    VirtualAddress = (*(uint16_t *)Page0Address);
-                    (*(uint16_t *)(global_structure_address + VirtualAddress)) = (((*(uint32_t *)(Page0Address)) >> 16) & 0xFFFF);
-                    Page0Address = Page0Address + 4;
-                    Blank_Check_Status = __asdk_flash_blank_check(Page0Address, 1);
-                }
-
-                g_eeprom_variables.Destination_Address = Page0Address;
+                /*Index the valid page and copy the latest data to the structure passed as parameter*/
+                g_eeprom_variables.Destination_Address = __asdk_emulated_eeprom_index_build(PAGE0_BASE_ADDRESS, global_structure_address);
 
                 asdk_errorcode_t flash_error = ASDK_FLASH_STATUS_SUCCESS;
 
@@ -735,19 +1561,8 @@ asdk_errorcode_t asdk_emulated_eeprom_init(asdk_emulated_eeprom_init_deinit_conf
             }
             else if (CY_FLASH_DRV_SUCCESS == Page1_Blank_Check_Status)
             {
-                /*Copy the latest data from valid page to the structure passed as parameter*/
-                uint16_t VirtualAddress = 0;
-                Blank_Check_Status = __asdk_flash_blank_check(PAGE1_BASE_ADDRESS + 4, 1);
-                while (Blank_Check_Status)
-                {
-
-                    VirtualAddress = (*(uint16_t *)Page1Address);
-                    (*(uint16_t *)(global_structure_address + VirtualAddress)) = (((*(uint32_t *)(Page1Address)) >> 16) & 0xFFFF);
-                    Page1Address = Page1Address + 4;
-                    Blank_Check_Status = __asdk_flash_blank_check(Page1Address, 1);
-                }
-
-                g_eeprom_variables.Destination_Address = Page1Address;
+                /*Index the valid page and copy the latest data to the structure passed as parameter*/
+                g_eeprom_variables.Destination_Address = __asdk_emulated_eeprom_index_build(PAGE1_BASE_ADDRESS, global_structure_address);
 
                 asdk_errorcode_t flash_error = ASDK_FLASH_STATUS_SUCCESS;
 
@@ -776,19 +1591,8 @@ asdk_errorcode_t asdk_emulated_eeprom_init(asdk_emulated_eeprom_init_deinit_conf
         }
         else if (ERASED == PageStatus1)
         {
-            /*Copy the latest data from valid page to the structure passed as parameter*/
-            uint16_t VirtualAddress = 0;
-            Blank_Check_Status = __asdk_flash_blank_check(PAGE0_BASE_ADDRESS + 4, 1);
-            while (Blank_Check_Status)
-            {
-
-                VirtualAddress = (*(uint16_t *)Page0Address);
-                (*(uint16_t *)(global_structure_address + VirtualAddress)) = (((*(uint32_t *)(Page0Address)) >> 16) & 0xFFFF);
-                Page0Address = Page0Address + 4;
-                Blank_Check_Status = __asdk_flash_blank_check(Page0Address, 1);
-            }
-
-            g_eeprom_variables.Destination_Address = Page0Address;
+            /*Index the valid page and copy the latest data to the structure passed as parameter*/
+            g_eeprom_variables.Destination_Address = __asdk_emulated_eeprom_index_build(PAGE0_BASE_ADDRESS, global_structure_address);
 
             asdk_errorcode_t flash_error = ASDK_FLASH_STATUS_SUCCESS;
 
@@ -829,11 +1633,12 @@ asdk_errorcode_t asdk_emulated_eeprom_deinit(asdk_emulated_eeprom_init_deinit_co
 
     /*Variable declaration*/
     asdk_flash_config_t flash_deinit_config = {
-        .flash_operation_mode = eeeprom_deinit_config->emulated_eeprom_operation_mode,
+        .flash_operation_mode = __asdk_emulated_eeprom_flash_mode(eeeprom_deinit_config->emulated_eeprom_operation_mode),
         .flash_type = eeeprom_deinit_config->flash_type_used,
     };
 
     (void)eeeprom_deinit_config->emulated_eeprom_size;
+    eeprom_nb.enabled = false;
 
     /*De-initialize the flash for eeprom emulation*/
     flash_error = asdk_flash_deinit(&flash_deinit_config);
@@ -855,6 +1660,16 @@ asdk_errorcode_t asdk_emulated_eeprom_deinit(asdk_emulated_eeprom_init_deinit_co
 /*Alternate to the write function*/
 asdk_errorcode_t asdk_emulated_eeprom_update(uint8_t *var_source, uint8_t *struct_source, uint32_t var_size, uint32_t struct_size)
 {
+    if (eeprom_nb.enabled)
+    {
+        if ((NULL == var_source) || (NULL == struct_source))
+        {
+            return ASDK_EMULATED_EEPROM_ERROR_NULL_PTR;
+        }
+
+        return __asdk_emulated_eeprom_nb_write(var_source, struct_source, var_size);
+    }
+
     /* Local Variables to store EMULATED_EEPROM status */
     asdk_errorcode_t ret_value = ASDK_EMULATED_EEPROM_STATUS_SUCCESS;
     uint32_t addr_offset = INITIAL_VALUE_ZERO;
@@ -948,6 +1763,16 @@ asdk_errorcode_t asdk_emulated_eeprom_update(uint8_t *var_source, uint8_t *struc
 /*User can update the structure or a member of the structure using this function*/
 asdk_errorcode_t asdk_emulated_eeprom_write(uint8_t *var_source, uint8_t *struct_source, uint32_t var_size, uint32_t struct_size)
 {
+    if (eeprom_nb.enabled)
+    {
+        if ((NULL == var_source) || (NULL == struct_source))
+        {
+            return ASDK_EMULATED_EEPROM_ERROR_NULL_PTR;
+        }
+
+        return __asdk_emulated_eeprom_nb_write(var_source, struct_source, var_size);
+    }
+
     /* Local Variables to store EMULATED_EEPROM status */
     asdk_errorcode_t ret_value = ASDK_EMULATED_EEPROM_STATUS_SUCCESS;
     uint32_t addr_offset = INITIAL_VALUE_ZERO;
@@ -955,6 +1780,7 @@ asdk_errorcode_t asdk_emulated_eeprom_write(uint8_t *var_source, uint8_t *struct
     addr_offset = var_source - struct_source;
     uint16_t Data_To_Write = INITIAL_VALUE_ZERO;
     int arr_index = INITIAL_VALUE_ZERO;
+    uint32_t member_size = var_size; /* whole member goes to the new page on a transfer */
 
     /********************************************************************/
     /*Updating the Variable Size and Address Offset if not 2Bytes aligned*/
@@ -1001,7 +1827,7 @@ asdk_errorcode_t asdk_emulated_eeprom_write(uint8_t *var_source, uint8_t *struct
     if (PAGE_FULL == Status)
     {
 
-        __asdk_emulated_eeprom_pagetransfer(var_source, struct_source, var_size, struct_size);
+        __asdk_emulated_eeprom_pagetransfer(var_source, struct_source, member_size, struct_size);
     }
 
     return ret_value;
@@ -1009,58 +1835,45 @@ asdk_errorcode_t asdk_emulated_eeprom_write(uint8_t *var_source, uint8_t *struct
 
 /*Emulated eeprom module read function.*/
 /*User can read either the entire structure or a member of that using this function*/
+/*Served from the RAM index, one flash read per 2 bytes and no page scan*/
+/*In journaled mode writes not yet in flash are served from the journal*/
 asdk_errorcode_t asdk_emulated_eeprom_read(uint8_t *read_back_var, uint8_t *structure_member_addr, uint8_t *global_structure_addr, uint32_t structure_member_size)
 {
-    uint16_t validpage = PAGE0;
-    uint32_t addressvalue = PAGE0_BASE_ADDRESS;
-    uint16_t readstatus = INITIAL_VALUE;
-    uint32_t address = EEPROM_START_ADDRESS, PageStartAddress = EEPROM_START_ADDRESS;
-    uint16_t VirtualAddress = global_structure_addr - structure_member_addr;
-    uint16_t read_back_index = INITIAL_VALUE_ZERO;
-    cy_en_flashdrv_status_t Blank_Check_Status = INITIAL_VALUE;
+    uint32_t VirtualAddress = INITIAL_VALUE_ZERO;
+    uint16_t data = INITIAL_VALUE_ZERO;
 
-    /* Get active Page for read operation */
-    validpage = __asdk_emulated_eeprom_findvalidpage(READ_FROM_VALID_PAGE);
+    if ((NULL == read_back_var) || (NULL == structure_member_addr) || (NULL == global_structure_addr))
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_NULL_PTR;
+    }
 
-    /* Check if there is no valid page */
-    if (validpage == NO_VALID_PAGE)
+    if (!eeprom_index_valid)
     {
-        return NO_VALID_PAGE;
+        return ASDK_EMULATED_EEPROM_ERROR_NOT_INITIALIZED;
     }
 
-    /* Get the valid Page start Address */
-    PageStartAddress = (uint32_t)(EEPROM_START_ADDRESS + (uint32_t)(validpage * EMULATED_EEPROM_PAGE_SIZE));
+    if ((structure_member_addr < global_structure_addr) ||
+        ((uint32_t)(structure_member_addr - global_structure_addr) + structure_member_size > g_eeprom_variables.Var_Size_Backup))
+    {
+        return ASDK_EMULATED_EEPROM_ERROR_INVALID_DATA_SIZE;
+    }
 
-    /*Get the address from which the valid variable sits*/
-    addressvalue = PageStartAddress + 4;
-    /* Get the valid Page end Address */
-    address = (uint32_t)((EEPROM_START_ADDRESS - 2) + (uint32_t)((1 + validpage) * EMULATED_EEPROM_PAGE_SIZE));
+    VirtualAddress = structure_member_addr - global_structure_addr;
 
-    /* Check each active page address starting from end */
-    while ((address > (PageStartAddress + 4)) && (0 < structure_member_size))
+    for (uint32_t i = 0; i < structure_member_size; i++, VirtualAddress++)
     {
-        /* Get the current location content to be compared with virtual address */
-        addressvalue = (*(volatile uint16_t *)address);
-
-        Blank_Check_Status = __asdk_flash_blank_check(PageStartAddress, 1);
-        if (false == Blank_Check_Status)
+        /* fetch the 2 byte record once for an aligned pair */
+        if ((0 == i) || (0 == (VirtualAddress % 2)))
         {
-
-            if (addressvalue == VirtualAddress)
-            {
-                (*(uint16_t *)(read_back_var + read_back_index)) = (((*(uint32_t *)(addressvalue)) >> 16) & 0xFFFF);
-                Blank_Check_Status = __asdk_flash_blank_check(addressvalue, 1);
-                addressvalue = addressvalue + 4;
-                read_back_index = read_back_index + 2;
-                structure_member_size = structure_member_size - 2;
-            }
-            else
+            /* variable never written */
+            if (!__asdk_emulated_eeprom_lookup((uint16_t)(VirtualAddress & ~1u), &data))
             {
-                addressvalue = addressvalue + 4;
+                return ASDK_EMULATED_EEPROM_STATUS_ERROR;
             }
         }
+
+        read_back_var[i] = (VirtualAddress % 2) ? (uint8_t)(data >> 8) : (uint8_t)(data & 0xFF);
     }
 
-    /* Return readstatus value: (0: variable exist, 1: variable doesn't exist) */
-    return readstatus;
-}
\ No newline at end of file
+    return ASDK_EMULATED_EEPROM_STATUS_SUCCESS;
+}
@@ -42,7 +42,7 @@
                         LOCAL AND EXTERNAL DEFINITIONS
 
 ==============================================================================*/
-static bool g_flashoperation_complete_flag = false;
+static volatile bool g_flashoperation_complete_flag = false;
 static bool g_nb_modeenabled = false;
 cy_un_flash_context_t sromContext = {0};
 
@@ -70,6 +70,17 @@ typedef enum{
 #define WORK_SMALL_SECTOR_SIZE_CYT2B7 CY_WORK_SES_SIZE_IN_BYTE // 128B
 #define SECTOR_SIZE_142 0x800                                  // Erase only 2kB at a time
 #define DATA_WRITE_SIZE 8
+#define NB_WRITE_MAX_SIZE 32 /* largest row programmed by one non-blocking write */
+
+/* write combining, rows of 256 bits are programmed in one operation on both flashes */
+#define ROW_BUFFER_SIZE 32
+#define ROW_BUFFER_FULL 0xFFFFFFFFU /* one dirty bit per byte of the row */
+#define WORK_PROGRAM_UNIT 4         /* smallest work flash program, one ECC word */
+#define CODE_PROGRAM_UNIT 8         /* smallest code flash program */
+
+#ifndef ASDK_FLASH_ROW_BUFFER_COUNT
+#define ASDK_FLASH_ROW_BUFFER_COUNT 2
+#endif
 
 
 
@@ -82,6 +93,24 @@ typedef enum{
 
 ==============================================================================*/
 
+/*==============================================================================
+
+                    LOCAL DEFINITIONS AND TYPES : STRUCTURES
+
+==============================================================================*/
+typedef struct
+{
+  uint32_t row_addr; /* ROW_BUFFER_SIZE aligned, valid while dirty is not 0 */
+  uint32_t dirty;    /* bytes written since the row was buffered */
+  uint32_t age;      /* buffered write sequence, the oldest row is evicted */
+  uint32_t data[ROW_BUFFER_SIZE / 4];
+} __asdk_flash_row_buffer_t;
+
+static __asdk_flash_row_buffer_t row_buffers[ASDK_FLASH_ROW_BUFFER_COUNT];
+static uint32_t row_buffer_age;
+static asdk_flash_write_stats_t write_stats;
+static uint32_t direct_program_ops; /* programs the buffered writes would have cost one by one */
+
 /*==============================================================================
 
                             LOCAL FUNCTION PROTOTYPES
@@ -99,9 +128,14 @@ typedef enum{
   @return False, CM0+ has not completed requested SROM API yet.
  
  *******************************************************************************/
-// static bool __asdk_Is_SROM_API_Completed();
 asdk_flash_callback_fun_t user_flash_callback_function;
+
+/* SROM reads the row from SRAM while a non-blocking program runs */
+static uint32_t nb_write_buffer[NB_WRITE_MAX_SIZE / 4];
 static inline __workflash_blanck_check_e __asdk_workflash_blank_check(asdk_flash_operation_config_t *flash_read_config);
+static asdk_errorcode_t __asdk_flash_program(uint32_t address, const uint32_t *data, uint32_t size);
+static asdk_errorcode_t __asdk_flash_row_buffer_flush(__asdk_flash_row_buffer_t *row);
+static asdk_errorcode_t __asdk_flash_row_buffer_sync(uint32_t address, uint32_t size, bool discard);
 
 /*******************************************************************************
  * Function __asdk_workflash_blank_check
@@ -144,6 +178,128 @@ static inline __workflash_blanck_check_e __asdk_workflash_blank_check(asdk_flash
 	}
 
 }
+/*******************************************************************************
+ * Function __asdk_flash_program
+ ****************************************************************************/
+/**
+ *
+ * Programs one aligned unit of 4 (work flash), 8 or 32 bytes in blocking mode.
+ *
+ *******************************************************************************/
+static asdk_errorcode_t __asdk_flash_program(uint32_t address, const uint32_t *data, uint32_t size)
+{
+  cy_stc_flash_programrow_config_t programRowConfig =
+      {
+          .blocking = CY_FLASH_PROGRAMROW_BLOCKING,
+          .skipBC = CY_FLASH_PROGRAMROW_SKIP_BLANK_CHECK,
+          .dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_32BIT,
+          .dataLoc = CY_FLASH_PROGRAMROW_DATA_LOCATION_SRAM,
+          .intrMask = CY_FLASH_PROGRAMROW_NOT_SET_INTR_MASK,
+          .destAddr = (uint32_t *)address,
+          .dataAddr = (uint32_t *)data,
+      };
+
+  if (ROW_BUFFER_SIZE == size)
+  {
+    programRowConfig.dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_256BIT;
+  }
+  else if (CODE_PROGRAM_UNIT == size)
+  {
+    programRowConfig.dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_64BIT;
+  }
+
+  write_stats.program_ops++;
+
+  if (CY_FLASH_DRV_SUCCESS != Cy_Flash_ProgramRow(&sromContext, &programRowConfig, CY_FLASH_DRIVER_BLOCKING))
+  {
+    return ASDK_FLASH_STATUS_ERROR;
+  }
+
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function __asdk_flash_row_buffer_flush
+ ****************************************************************************/
+/**
+ *
+ * Programs a buffered row and frees it. A full row takes one operation, a
+ * partial one is programmed per dirty unit so the words around it, which may
+ * already hold data, are never programmed twice.
+ *
+ *******************************************************************************/
+static asdk_errorcode_t __asdk_flash_row_buffer_flush(__asdk_flash_row_buffer_t *row)
+{
+  asdk_errorcode_t ret_value = ASDK_FLASH_STATUS_SUCCESS;
+  uint32_t unit = WORK_PROGRAM_UNIT;
+
+  if (0 == row->dirty)
+  {
+    return ASDK_FLASH_STATUS_SUCCESS;
+  }
+
+  if (ROW_BUFFER_FULL == row->dirty)
+  {
+    ret_value = __asdk_flash_program(row->row_addr, row->data, ROW_BUFFER_SIZE);
+  }
+  else
+  {
+    if (!((WORKFLASH_LARGE_START_ADDRESS <= row->row_addr) && (WORKFLASH_SMALL_END_ADDRESS >= row->row_addr)))
+    {
+      unit = CODE_PROGRAM_UNIT;
+    }
+
+    for (uint32_t offset = 0; (offset < ROW_BUFFER_SIZE) && (ASDK_FLASH_STATUS_SUCCESS == ret_value); offset += unit)
+    {
+      uint32_t unit_mask = ((1U << unit) - 1U) << offset;
+
+      if (0 != (row->dirty & unit_mask))
+      {
+        ret_value = __asdk_flash_program(row->row_addr + offset, &row->data[offset / 4], unit);
+      }
+    }
+  }
+
+  row->dirty = 0;
+
+  return ret_value;
+}
+
+/*******************************************************************************
+ * Function __asdk_flash_row_buffer_sync
+ ****************************************************************************/
+/**
+ *
+ * Keeps the row buffers coherent with a direct access to [address, address + size):
+ * overlapping rows are programmed first, or dropped when the range is being erased.
+ *
+ *******************************************************************************/
+static asdk_errorcode_t __asdk_flash_row_buffer_sync(uint32_t address, uint32_t size, bool discard)
+{
+  asdk_errorcode_t ret_value = ASDK_FLASH_STATUS_SUCCESS;
+
+  for (uint8_t i = 0; i < ASDK_FLASH_ROW_BUFFER_COUNT; i++)
+  {
+    __asdk_flash_row_buffer_t *row = &row_buffers[i];
+
+    if ((0 == row->dirty) || ((row->row_addr + ROW_BUFFER_SIZE) <= address) || (row->row_addr >= (address + size)))
+    {
+      continue;
+    }
+
+    if (discard)
+    {
+      row->dirty = 0;
+    }
+    else if (ASDK_FLASH_STATUS_SUCCESS == ret_value)
+    {
+      ret_value = __asdk_flash_row_buffer_flush(row);
+    }
+  }
+
+  return ret_value;
+}
+
 /*******************************************************************************
  * Function asdk_flashHandler
  ****************************************************************************/
@@ -162,21 +318,20 @@ static void asdk_flashHandler(void)
     CY_ASSERT(false);
   }
 
+  Cy_Flashc_InvalidateFlashCacheBuffer();
   g_flashoperation_complete_flag = true;
   // Call the user callback function
-  user_flash_callback_function();
-  Cy_Flashc_InvalidateFlashCacheBuffer();
+  if (NULL != user_flash_callback_function)
+  {
+    user_flash_callback_function();
+  }
 }
 
 /*A function for user to know whether CM0+ completed erase/program flash or not*/
-/*This function can be used when the non-blocking APIs are to be implemented in Flash*/
-/*Currently commenting out to remove warning*/
-// static bool __asdk_Is_SROM_API_Completed()
-// {
-//   bool api_status = false;
-//   api_status = g_flashoperation_complete_flag;
-//   return api_status;
-// }
+bool asdk_flash_is_operation_complete(void)
+{
+  return g_flashoperation_complete_flag;
+}
 
 /*Initlialization function for the Flash*/
 asdk_errorcode_t asdk_flash_init(asdk_flash_config_t *flash_config)
@@ -286,6 +441,22 @@ asdk_errorcode_t asdk_flash_read_blocking(asdk_flash_operation_config_t *flash_r
     return ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS;
   }
 
+  // Buffered writes not programmed yet are part of the flash content
+  for (uint8_t i = 0; i < ASDK_FLASH_ROW_BUFFER_COUNT; i++)
+  {
+    __asdk_flash_row_buffer_t *row = &row_buffers[i];
+
+    for (uint32_t n = 0; (0 != row->dirty) && (n < flash_read_config->size_in_bytes); n++)
+    {
+      uint32_t address = flash_read_config->source_addr + n;
+
+      if ((address >= row->row_addr) && (address < (row->row_addr + ROW_BUFFER_SIZE)) && (row->dirty & (1U << (address - row->row_addr))))
+      {
+        ((uint8_t *)flash_read_config->destination_addr)[n] = ((uint8_t *)row->data)[address - row->row_addr];
+      }
+    }
+  }
+
   return ret_value;
 }
 
@@ -318,6 +489,12 @@ asdk_errorcode_t asdk_flash_write_blocking(asdk_flash_operation_config_t *flash_
   totalSize = flash_write_config->size_in_bytes;
   uint32_t addressOfSource = (uint32_t)flash_write_config->source_addr;
 
+  // Buffered writes to the same rows go first
+  if (ASDK_FLASH_STATUS_SUCCESS != __asdk_flash_row_buffer_sync(addressToBeWritten, totalSize, false))
+  {
+    return ASDK_FLASH_STATUS_ERROR;
+  }
+
   // while (/*(totalSize != 0) && (CY_FLASH_DRV_SUCCESS != ProgramFlashStatus)*/true)
   while ((totalSize != 0) && (CY_FLASH_DRV_SUCCESS == ProgramFlashStatus))
 
@@ -339,7 +516,13 @@ asdk_errorcode_t asdk_flash_write_blocking(asdk_flash_operation_config_t *flash_
 
       programRowConfig.dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_32BIT;
       dataSizeToBeWritten = 4;
-      if (totalSize >= 4)
+      if ((totalSize >= ROW_BUFFER_SIZE) && (0 == (addressToBeWritten % ROW_BUFFER_SIZE)))
+      {
+        // Whole aligned rows in one operation
+        programRowConfig.dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_256BIT;
+        dataSizeToBeWritten = ROW_BUFFER_SIZE;
+      }
+      else if (totalSize >= 4)
       {
         programRowConfig.dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_32BIT;
         dataSizeToBeWritten = 4;
@@ -407,6 +590,135 @@ asdk_errorcode_t asdk_flash_write_blocking(asdk_flash_operation_config_t *flash_
 }
 
 
+/*!Buffered flash write, combines small writes into rows programmed once*/
+asdk_errorcode_t asdk_flash_write_buffered(asdk_flash_operation_config_t *flash_write_config, uint32_t timeout_ms)
+{
+  asdk_errorcode_t ret_value = ASDK_FLASH_STATUS_SUCCESS;
+  /*Timeout value is ignored since the timeout has been taken care in the driver of cyt*/
+  (void)timeout_ms;
+
+  if (NULL == flash_write_config)
+  {
+    return ASDK_FLASH_ERROR_NULL_PTR;
+  }
+
+  uint32_t address = flash_write_config->destination_addr;
+  uint32_t end = address + flash_write_config->size_in_bytes;
+  const uint8_t *source = (const uint8_t *)flash_write_config->source_addr;
+  bool work_flash = (WORKFLASH_LARGE_START_ADDRESS <= address) && (WORKFLASH_SMALL_END_ADDRESS >= end);
+  uint32_t unit = work_flash ? WORK_PROGRAM_UNIT : CODE_PROGRAM_UNIT;
+
+  if (!work_flash && !((CODE_LARGE_START_ADDR <= address) && (CODE_SMALL_END_ADDR >= end)))
+  {
+    return ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS;
+  }
+
+  // Programs a direct write would have issued, one per unit touched
+  if (end > address)
+  {
+    write_stats.buffered_writes++;
+    direct_program_ops += (((end - 1) / unit) - (address / unit)) + 1;
+  }
+
+  while ((address < end) && (ASDK_FLASH_STATUS_SUCCESS == ret_value))
+  {
+    uint32_t row_addr = address - (address % ROW_BUFFER_SIZE);
+    __asdk_flash_row_buffer_t *row = NULL;
+
+    // Same row, else a free buffer, else evict the oldest row
+    for (uint8_t i = 0; i < ASDK_FLASH_ROW_BUFFER_COUNT; i++)
+    {
+      if ((0 != row_buffers[i].dirty) && (row_addr == row_buffers[i].row_addr))
+      {
+        row = &row_buffers[i];
+        break;
+      }
+    }
+
+    if (NULL == row)
+    {
+      row = &row_buffers[0];
+      for (uint8_t i = 0; i < ASDK_FLASH_ROW_BUFFER_COUNT; i++)
+      {
+        if ((0 == row_buffers[i].dirty) || ((0 != row->dirty) && (row_buffers[i].age < row->age)))
+        {
+          row = &row_buffers[i];
+        }
+      }
+
+      ret_value = __asdk_flash_row_buffer_flush(row);
+      row->row_addr = row_addr;
+      memset(row->data, 0xFF, ROW_BUFFER_SIZE);
+    }
+
+    // Overlapping bytes take the latest value
+    for (; (address < end) && (address < (row_addr + ROW_BUFFER_SIZE)); address++, source++)
+    {
+      ((uint8_t *)row->data)[address - row_addr] = *source;
+      row->dirty |= (1U << (address - row_addr));
+    }
+
+    row->age = ++row_buffer_age;
+
+    if ((ROW_BUFFER_FULL == row->dirty) && (ASDK_FLASH_STATUS_SUCCESS == ret_value))
+    {
+      ret_value = __asdk_flash_row_buffer_flush(row);
+    }
+  }
+
+  return ret_value;
+}
+
+/*!Programs every buffered row*/
+asdk_errorcode_t asdk_flash_flush(uint32_t timeout_ms)
+{
+  asdk_errorcode_t ret_value = ASDK_FLASH_STATUS_SUCCESS;
+  /*Timeout value is ignored since the timeout has been taken care in the driver of cyt*/
+  (void)timeout_ms;
+
+  // Oldest first, rows are programmed in the order they were written
+  for (uint8_t n = 0; n < ASDK_FLASH_ROW_BUFFER_COUNT; n++)
+  {
+    __asdk_flash_row_buffer_t *row = NULL;
+
+    for (uint8_t i = 0; i < ASDK_FLASH_ROW_BUFFER_COUNT; i++)
+    {
+      if ((0 != row_buffers[i].dirty) && ((NULL == row) || (row_buffers[i].age < row->age)))
+      {
+        row = &row_buffers[i];
+      }
+    }
+
+    if (NULL == row)
+    {
+      break;
+    }
+
+    if (ASDK_FLASH_STATUS_SUCCESS != __asdk_flash_row_buffer_flush(row))
+    {
+      ret_value = ASDK_FLASH_STATUS_ERROR;
+    }
+  }
+
+  return ret_value;
+}
+
+/*!Write combining statistics*/
+asdk_errorcode_t asdk_flash_get_write_stats(asdk_flash_write_stats_t *stats)
+{
+  if (NULL == stats)
+  {
+    return ASDK_FLASH_ERROR_NULL_PTR;
+  }
+
+  *stats = write_stats;
+
+  // Rows still buffered count as saved until they are programmed
+  stats->program_ops_saved = (direct_program_ops > write_stats.program_ops) ? (direct_program_ops - write_stats.program_ops) : 0;
+
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
 /*!Flash erase the entire flash function*/
 asdk_errorcode_t asdk_flash_erase_all_sectors_blocking(uint32_t Base_Sector_Address, uint32_t timeout_ms)
 {
@@ -474,7 +786,8 @@ asdk_errorcode_t asdk_flash_erase_sector_blocking(uint32_t Base_Sector_Address,
       return ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS;
     }
 
-    (void)sector_size; //To avoid unwanted warning
+    // Buffered writes to the sector would be erased with it
+    __asdk_flash_row_buffer_sync(base_start, sector_size, true);
 
     eraseSectorConfig.Addr = (uint32_t *)(base_start);
     flash_sector_erase_status = Cy_Flash_EraseSector(NULL, &eraseSectorConfig, CY_FLASH_PROGRAMROW_BLOCKING);
@@ -534,10 +847,81 @@ asdk_errorcode_t asdk_flash_install_callback(asdk_flash_callback_fun_t callback_
 }
 
 
-/*Non-blocking flash write operation not implemented in cyt*/
+/*Non-blocking flash write, programs one row and returns, completion is reported by asdk_flashHandler*/
 asdk_errorcode_t asdk_flash_write_non_blocking(asdk_flash_operation_config_t *flash_write_config)
 {
-    return ASDK_FLASH_ERROR_FEATURE_NOT_IMPLEMENTED;
+  cy_en_flashdrv_status_t ProgramFlashStatus = CY_FLASH_DRV_SUCCESS;
+  cy_stc_flash_programrow_config_t programRowConfig =
+      {
+          .blocking = CY_FLASH_PROGRAMROW_NON_BLOCKING,
+          .skipBC = CY_FLASH_PROGRAMROW_SKIP_BLANK_CHECK,
+          .dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_32BIT,
+          .dataLoc = CY_FLASH_PROGRAMROW_DATA_LOCATION_SRAM,
+          .intrMask = CY_FLASH_PROGRAMROW_SET_INTR_MASK,
+          .destAddr = NULL,
+          .dataAddr = NULL,
+      };
+
+  if (NULL == flash_write_config)
+  {
+    return ASDK_FLASH_ERROR_NULL_PTR;
+  }
+
+  if (!g_nb_modeenabled)
+  {
+    return ASDK_FLASH_ERROR_INVALID_FLASH_OPERATION_MODE;
+  }
+
+  if (!g_flashoperation_complete_flag)
+  {
+    return ASDK_FLASH_STATUS_BUSY;
+  }
+
+  uint32_t addressToBeWritten = flash_write_config->destination_addr;
+  uint32_t totalSize = flash_write_config->size_in_bytes;
+
+  // Only work flash rows of one or eight words
+  if (!((WORKFLASH_LARGE_START_ADDRESS <= addressToBeWritten) && ((WORKFLASH_SMALL_END_ADDRESS) >= (addressToBeWritten + totalSize))))
+  {
+    return ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS;
+  }
+
+  if (4 == totalSize)
+  {
+    programRowConfig.dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_32BIT;
+  }
+  else if (NB_WRITE_MAX_SIZE == totalSize)
+  {
+    programRowConfig.dataSize = CY_FLASH_PROGRAMROW_DATA_SIZE_256BIT;
+  }
+  else
+  {
+    return ASDK_FLASH_ERROR_INVALID_DATA_SIZE;
+  }
+
+  if (0 != (addressToBeWritten % totalSize))
+  {
+    return ASDK_FLASH_ERROR_INVALID_DATA_ALIGNMENT;
+  }
+
+  if (ASDK_FLASH_STATUS_SUCCESS != __asdk_flash_row_buffer_sync(addressToBeWritten, totalSize, false))
+  {
+    return ASDK_FLASH_STATUS_ERROR;
+  }
+
+  memcpy(nb_write_buffer, (void *)flash_write_config->source_addr, totalSize);
+  programRowConfig.destAddr = (uint32_t *)addressToBeWritten;
+  programRowConfig.dataAddr = nb_write_buffer;
+
+  g_flashoperation_complete_flag = false;
+  ProgramFlashStatus = Cy_Flash_ProgramRow(&sromContext, &programRowConfig, CY_FLASH_DRIVER_NON_BLOCKING);
+  if (CY_FLASH_DRV_SUCCESS != ProgramFlashStatus)
+  {
+    g_flashoperation_complete_flag = true;
+    return ASDK_FLASH_STATUS_ERROR;
+  }
+
+  return ASDK_FLASH_STATUS_SUCCESS;
 }
 
 /*Non-blocking flash read operation not implemented in cyt*/
@@ -546,10 +930,48 @@ asdk_errorcode_t asdk_flash_read_non_blocking(asdk_flash_operation_config_t *fla
     return ASDK_FLASH_ERROR_FEATURE_NOT_IMPLEMENTED;
 }
 
-/*Non-blocking flash erase operation not implemented in CYT*/
+/*Non-blocking flash sector erase, completion is reported by asdk_flashHandler*/
 asdk_errorcode_t asdk_flash_erase_sector_non_blocking(uint32_t Base_Sector_Address)
 {
-    return ASDK_FLASH_ERROR_FEATURE_NOT_IMPLEMENTED;
+  cy_en_flashdrv_status_t flash_sector_erase_status = CY_FLASH_DRV_SUCCESS;
+  cy_stc_flash_erasesector_config_t eraseSectorConfig = {0};
+  uint32_t sector_size = 0;
+
+  if (!g_nb_modeenabled)
+  {
+    return ASDK_FLASH_ERROR_INVALID_FLASH_OPERATION_MODE;
+  }
+
+  if (!g_flashoperation_complete_flag)
+  {
+    return ASDK_FLASH_STATUS_BUSY;
+  }
+
+  if (ASDK_FLASH_STATUS_SUCCESS != asdk_flash_get_sector_size(Base_Sector_Address, &sector_size))
+  {
+    return ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS;
+  }
+
+  if (0 != (Base_Sector_Address % sector_size))
+  {
+    return ASDK_FLASH_ERROR_INVALID_DATA_ALIGNMENT;
+  }
+
+  __asdk_flash_row_buffer_sync(Base_Sector_Address, sector_size, true);
+
+  eraseSectorConfig.Addr = (uint32_t *)(Base_Sector_Address);
+  eraseSectorConfig.blocking = CY_FLASH_ERASESECTOR_NON_BLOCKING;
+  eraseSectorConfig.intrMask = CY_FLASH_ERASESECTOR_SET_INTR_MASK;
+
+  g_flashoperation_complete_flag = false;
+  flash_sector_erase_status = Cy_Flash_EraseSector(&sromContext, &eraseSectorConfig, CY_FLASH_DRIVER_NON_BLOCKING);
+  if (CY_FLASH_DRV_SUCCESS != flash_sector_erase_status)
+  {
+    g_flashoperation_complete_flag = true;
+    return ASDK_FLASH_STATUS_ERROR;
+  }
+
+  return ASDK_FLASH_STATUS_SUCCESS;
 }
 
 /*Non-blocking flash erase all sectors not implemented in CYT*/
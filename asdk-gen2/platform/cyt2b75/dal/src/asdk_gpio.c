@@ -131,7 +131,7 @@ static inline asdk_errorcode_t set_mode_configuration(asdk_gpio_mode_t gpio_mode
 static inline asdk_errorcode_t set_pull_configuration(asdk_gpio_pull_t gpio_pull, cy_stc_gpio_pin_config_t *cy_config_out);
 static inline asdk_errorcode_t set_speed_configuration(asdk_gpio_speed_t gpio_speed, cy_stc_gpio_pin_config_t *cy_config_out);
 static inline asdk_errorcode_t set_isr(asdk_gpio_config_t *gpio_cfg, cy_stc_gpio_pin_config_t *cy_config_out);
-static inline void gpio_isr(const dal_pin_t *port, cyt2b75_port_t port_no);
+static inline void gpio_isr(cyt2b75_port_t port_no);
 static void port0_isr(void);
 static void port2_isr(void);
 static void port3_isr(void);
@@ -202,6 +202,13 @@ static uint8_t port_mask[] = {
     0x1F, /* PORT_23, 5-pins */
 };
 
+/* Pins of each port initialized as input, latched by asdk_gpio_read_ports. */
+static uint8_t input_mask[CYT2B75_GPIO_PORT_MAX];
+
+/* Reverse of pin_map for the initialized pins, filled by asdk_gpio_init so
+   that the ISR and asdk_gpio_read_ports map PORT.PIN to the MCU pin directly. */
+static uint8_t port_pin_to_mcu_pin[CYT2B75_GPIO_PORT_MAX][CYT2B75_GPIO_PIN_MAX];
+
 /** 
  * @var dal_pin_t pin_map
     This table maps MCU pin number to actual GPIO port and pin number.
@@ -437,6 +444,19 @@ asdk_errorcode_t asdk_gpio_init(asdk_gpio_config_t *gpio_cfg)
         {
             ret_value = ASDK_GPIO_ERROR_INIT;
         }
+        else
+        {
+            port_pin_to_mcu_pin[cyt2b75_gpio->port][cyt2b75_gpio->pin] = (uint8_t)gpio_cfg->mcu_pin;
+
+            if (ASDK_GPIO_MODE_INPUT == gpio_cfg->gpio_mode)
+            {
+                input_mask[cyt2b75_gpio->port] |= (uint8_t)(1U << cyt2b75_gpio->pin);
+            }
+            else
+            {
+                input_mask[cyt2b75_gpio->port] &= (uint8_t)~(1U << cyt2b75_gpio->pin);
+            }
+        }
 
 
         /* enable interrupt */
@@ -485,6 +505,9 @@ asdk_errorcode_t asdk_gpio_deinit(asdk_mcu_pin_t pin_num)
     // clear interrupt mask reg.
     Cy_GPIO_SetInterruptMask(gpio_port[cyt2b75_gpio->port], cyt2b75_gpio->pin, 0);
 
+    // no longer part of the input snapshot
+    input_mask[cyt2b75_gpio->port] &= (uint8_t)~(1U << cyt2b75_gpio->pin);
+
     // clear out buffer reg.
     pin_mask = ~(1 << cyt2b75_gpio->pin); // clear the bit
     cyt2b75_port_reg = gpio_port[cyt2b75_gpio->port];
@@ -571,6 +594,50 @@ asdk_errorcode_t asdk_gpio_get_input_state(asdk_mcu_pin_t pin_num, asdk_gpio_sta
     return get_gpio_state(pin_num, gpio_state, true);
 }
 
+/*!This function latches the input pins of all ports in one pass. The ports
+  are sampled back to back first and mapped to MCU pins afterwards, so the
+  snapshot is as close to a single instant as the bus allows.*/
+asdk_errorcode_t asdk_gpio_read_ports(asdk_gpio_snapshot_t *snapshot)
+{
+    uint32_t port_state[CYT2B75_GPIO_PORT_MAX];
+    uint32_t high_pins = 0;
+    uint8_t port_no = 0;
+    uint8_t port_pin_num = 0;
+    uint8_t mcu_pin = 0;
+
+    if (NULL == snapshot)
+    {
+        return ASDK_GPIO_ERROR_NULL_PTR;
+    }
+
+    for (port_no = 0; port_no < CYT2B75_GPIO_PORT_MAX; port_no++)
+    {
+        port_state[port_no] = (0U != input_mask[port_no]) ? gpio_port[port_no]->unIN.u32Register : 0U;
+    }
+
+    for (uint8_t i = 0; i < ASDK_GPIO_SNAPSHOT_WORDS; i++)
+    {
+        snapshot->pins[i] = 0;
+    }
+
+    for (port_no = 0; port_no < CYT2B75_GPIO_PORT_MAX; port_no++)
+    {
+        high_pins = port_state[port_no] & input_mask[port_no];
+
+        // only the high pins need a bit set, lowest first
+        while (0U != high_pins)
+        {
+            port_pin_num = (uint8_t)__builtin_ctz(high_pins);
+            high_pins &= high_pins - 1U;
+
+            mcu_pin = port_pin_to_mcu_pin[port_no][port_pin_num];
+            snapshot->pins[mcu_pin / 32U] |= (1UL << (mcu_pin % 32U));
+        }
+    }
+
+    return ASDK_GPIO_SUCCESS;
+}
+
 /*!This function returns the current state of the given ECU output pin name.*/
 asdk_errorcode_t asdk_gpio_get_output_state(asdk_mcu_pin_t pin_num, asdk_gpio_state_t *gpio_state)
 {
@@ -871,156 +938,124 @@ static inline asdk_errorcode_t set_isr(asdk_gpio_config_t *gpio_cfg, cy_stc_gpio
 
 /* ISR handlers */
 
-static inline void gpio_isr(const dal_pin_t *port, cyt2b75_port_t port_no)
+static inline void gpio_isr(cyt2b75_port_t port_no)
 {
-    /* Get pin interrupt flag */
-    uint32_t interrupt_status = gpio_port[port_no]->unINTR_MASKED.u32Register;
-    uint8_t port_pin_num = 0;
-    uint32_t input_pin_state = 0;
+    volatile stc_GPIO_PRT_t *port_reg = gpio_port[port_no];
 
-    interrupt_status = interrupt_status & port_mask[port_no];
+    /* Get pin interrupt flags */
+    uint32_t interrupt_status = port_reg->unINTR_MASKED.u32Register & port_mask[port_no];
+    uint32_t input_state = 0;
+    uint8_t port_pin_num = 0;
 
-    if (interrupt_status)
+    if (0U == interrupt_status)
     {
-        for (port_pin_num = 0; port_pin_num < CYT2B75_GPIO_PIN_MAX; port_pin_num++)
-        {
-            if (interrupt_status & (1 << port_pin_num))
-            {
-                /* Clear external interrupt flag. */
-                Cy_GPIO_ClearInterrupt(gpio_port[port_no], port_pin_num);
+        return;
+    }
 
-                /* call user callback function */
-                if (user_gpio_callback_fun)
-                {
-                    input_pin_state = Cy_GPIO_Read(gpio_port[port_no], port_pin_num);
-                    user_gpio_callback_fun(port[port_pin_num].mcu_pin, input_pin_state);
-                }
+    /* Clear the external interrupt flags of all pending pins together, an
+       edge during the callbacks raises the interrupt again. Read back so the
+       clear has taken effect before the ISR returns. */
+    port_reg->unINTR.u32Register = interrupt_status;
+    (void)port_reg->unINTR.u32Register;
 
-                break;
-            }
+    input_state = port_reg->unIN.u32Register;
+
+    /* serve every pending pin in this entry, lowest pin first */
+    while (0U != interrupt_status)
+    {
+        port_pin_num = (uint8_t)__builtin_ctz(interrupt_status);
+        interrupt_status &= interrupt_status - 1U;
+
+        /* call user callback function */
+        if (user_gpio_callback_fun)
+        {
+            user_gpio_callback_fun((asdk_mcu_pin_t)port_pin_to_mcu_pin[port_no][port_pin_num],
+                                   (input_state >> port_pin_num) & 1U);
         }
     }
 }
 
 static void port0_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_2], CYT2B75_GPIO_PORT_0);
+    gpio_isr(CYT2B75_GPIO_PORT_0);
 }
 
 static void port2_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_6], CYT2B75_GPIO_PORT_2);
+    gpio_isr(CYT2B75_GPIO_PORT_2);
 }
 
 static void port3_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_10], CYT2B75_GPIO_PORT_3);
+    gpio_isr(CYT2B75_GPIO_PORT_3);
 }
 
 static void port5_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_14], CYT2B75_GPIO_PORT_5);
+    gpio_isr(CYT2B75_GPIO_PORT_5);
 }
 
 static void port6_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_18], CYT2B75_GPIO_PORT_6);
+    gpio_isr(CYT2B75_GPIO_PORT_6);
 }
 
 static void port7_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_29], CYT2B75_GPIO_PORT_7);
+    gpio_isr(CYT2B75_GPIO_PORT_7);
 }
 
 static void port8_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_35], CYT2B75_GPIO_PORT_8);
+    gpio_isr(CYT2B75_GPIO_PORT_8);
 }
 
 static void port11_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_38], CYT2B75_GPIO_PORT_11);
+    gpio_isr(CYT2B75_GPIO_PORT_11);
 }
 
 static void port12_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_45], CYT2B75_GPIO_PORT_12);
+    gpio_isr(CYT2B75_GPIO_PORT_12);
 }
 
 static void port13_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_52], CYT2B75_GPIO_PORT_13);
+    gpio_isr(CYT2B75_GPIO_PORT_13);
 }
 
 static void port14_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_60], CYT2B75_GPIO_PORT_14);
+    gpio_isr(CYT2B75_GPIO_PORT_14);
 }
 
 static void port17_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_64], CYT2B75_GPIO_PORT_17);
+    gpio_isr(CYT2B75_GPIO_PORT_17);
 }
 
 static void port18_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_67], CYT2B75_GPIO_PORT_18);
+    gpio_isr(CYT2B75_GPIO_PORT_18);
 }
 
 static void port19_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_77], CYT2B75_GPIO_PORT_19);
+    gpio_isr(CYT2B75_GPIO_PORT_19);
 }
 
 static void port21_isr(void)
 {
-    const dal_pin_t *port = &pin_map[MCU_PIN_81];
-
-    /* Get pin interrupt flag */
-    uint32_t interrupt_status = gpio_port[CYT2B75_GPIO_PORT_21]->unINTR_MASKED.u32Register;
-    uint8_t port_pin_num = 0;
-    uint32_t input_pin_state = 0;
-
-    interrupt_status = interrupt_status & port_mask[CYT2B75_GPIO_PORT_21];
-
-    if (interrupt_status)
-    {
-        for (port_pin_num = 0; port_pin_num < CYT2B75_GPIO_PIN_MAX; port_pin_num++)
-        {
-            if (interrupt_status & (1 << port_pin_num))
-            {
-                // between P21.3 & P21.5, there exists 5 undefined pins in pin_map
-                // so moving *port to MCU_PIN_85 for proper indexing of P21.5
-                if (port_pin_num == CYT2B75_GPIO_PIN_5)
-                {
-                    port = &pin_map[MCU_PIN_85];
-                }
-
-                /* Clear external interrupt flag. */
-                Cy_GPIO_ClearInterrupt(gpio_port[CYT2B75_GPIO_PORT_21], port_pin_num);
-
-                /* call user callback function */
-                if (user_gpio_callback_fun)
-                {
-                    input_pin_state = Cy_GPIO_Read(gpio_port[CYT2B75_GPIO_PORT_21], port_pin_num);
-                    user_gpio_callback_fun(port[port_pin_num].mcu_pin, input_pin_state);
-                }
-
-                break;
-            }
-        }
-    }
+    gpio_isr(CYT2B75_GPIO_PORT_21);
 }
 
 static void port22_isr(void)
 {
-    gpio_isr(&pin_map[MCU_PIN_91], CYT2B75_GPIO_PORT_22);
+    gpio_isr(CYT2B75_GPIO_PORT_22);
 }
 
 static void port23_isr(void)
 {
-    // P23.1...P23.2 are undefined
-    // so pin_map[MCU_PIN_92] properly indexes for P23.3
-
-    gpio_isr(&pin_map[MCU_PIN_92], CYT2B75_GPIO_PORT_23);
+    gpio_isr(CYT2B75_GPIO_PORT_23);
 }
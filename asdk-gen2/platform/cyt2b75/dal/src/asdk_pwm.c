@@ -51,6 +51,13 @@
 
 ==============================================================================*/
 
+/* what a channel has staged for asdk_pwm_commit */
+#define PWM_STAGE_DUTY 0x01u
+#define PWM_STAGE_DUTY_Q16 0x02u
+#define PWM_STAGE_PERIOD 0x04u
+
+#define PWM_STAGED_WORDS ((ASDK_PWM_MODULE_CH_MAX + 31u) / 32u)
+
 /*==============================================================================
 
                       LOCAL DEFINITIONS AND TYPES : ENUMS
@@ -71,6 +78,13 @@ enum
 
 ==============================================================================*/
 
+typedef struct
+{
+    uint32_t duty;          // counter clocks or Q16, see flags
+    uint32_t period_counts; // counter clocks
+    uint8_t flags;          // PWM_STAGE_*
+} asdk_cyt2b75_pwm_stage_t;
+
 /*==============================================================================
 
                             LOCAL FUNCTION PROTOTYPES
@@ -79,6 +93,9 @@ enum
 
 static void _asdk_cyt2b75_get_timer_group_and_channel(uint8_t asdk_timer_channel, uint8_t *cyt2b75_timer_group, uint8_t *cyt2b75_timer_channel);
 static bool _asdk_cyt2b75_is_period_valid(uint8_t timer_group, uint32_t period);
+static volatile stc_TCPWM_GRP_CNT_t *_asdk_cyt2b75_get_timer_base(asdk_pwm_channel_t asdk_timer_channel);
+static uint32_t _asdk_cyt2b75_duty_to_compare(uint8_t timer_group, uint64_t period_counts, uint32_t duty_q16);
+static uint32_t _asdk_cyt2b75_limit_compare(uint8_t timer_group, uint64_t compare_val);
 static asdk_errorcode_t _asdk_cyt2b75_init_pwm(uint8_t asdk_timer_channel, uint8_t cyt2b75_timer_group, uint8_t cyt2b75_timer_channel, asdk_pwm_config_t *pwm_config);
 
 uint8_t channel_number = 0;
@@ -192,6 +209,10 @@ static cy_stc_sysint_irq_t timer_irq_cfg = {0};
 static cy_en_intr_t timer_isr_src = disconnected_IRQn;
 static asdk_pwm_callback_t pwm_callback[ASDK_PWM_MODULE_CH_MAX] = {NULL};
 
+/* staged updates, applied through the CC0 and PERIOD buffer registers */
+static asdk_cyt2b75_pwm_stage_t pwm_stage[ASDK_PWM_MODULE_CH_MAX];
+static uint32_t pwm_staged[PWM_STAGED_WORDS]; // bit per channel with a staged update
+
 static timer_isr_t timer_isr[ASDK_PWM_MODULE_CH_MAX] = {
     group0_ch_0_isr,
     group0_ch_1_isr,
@@ -291,10 +312,10 @@ cy_stc_tcpwm_pwm_config_t cyt2b75_pwm_config =
         .runMode = CY_TCPWM_PWM_CONTINUOUS,
         .period = 1000 - 1ul,
         .period_buff = 0ul,
-        .enablePeriodSwap = false,
+        .enablePeriodSwap = true, // swaps only on the switch event of asdk_pwm_commit
         .compare0 = 49,
         .compare1 = 0ul,
-        .enableCompare0Swap = false,
+        .enableCompare0Swap = true,
         .enableCompare1Swap = false,
         .interruptSources = CY_TCPWM_INT_NONE,
         .invertPWMOut = 0ul,
@@ -404,6 +425,8 @@ asdk_errorcode_t asdk_pwm_deinit(asdk_pwm_channel_t pwm_ch)
     Cy_Tcpwm_Pwm_DeInit(&TCPWM0->GRP[cyt2b75_timer_group].CNT[cyt2b75_timer_channel]);
 
     pwm_callback[pwm_ch] = NULL;
+    pwm_stage[pwm_ch].flags = 0;
+    pwm_staged[pwm_ch / 32u] &= ~(1UL << (pwm_ch % 32u));
 
     return ASDK_PWM_SUCCESS;
 }
@@ -610,6 +633,233 @@ asdk_errorcode_t asdk_pwm_set_frequency(asdk_pwm_channel_t pwm_ch, asdk_pwm_cloc
     return ASDK_PWM_SUCCESS;
 }
 
+/*Updates the compare value of the PWM channel during runtime*/
+asdk_errorcode_t asdk_pwm_set_duty_counts(asdk_pwm_channel_t pwm_ch, uint32_t compare_counts)
+{
+    uint8_t cyt2b75_timer_group;
+    uint8_t cyt2b75_timer_channel;
+    uint32_t period_val;
+
+    /* validate channel */
+    if (ASDK_PWM_MODULE_CH_MAX <= pwm_ch)
+    {
+        return ASDK_PWM_ERROR_INVALID_CHANNEL;
+    }
+    else
+    {
+        // derive timer group and corresponding channel
+        _asdk_cyt2b75_get_timer_group_and_channel(pwm_ch, &cyt2b75_timer_group, &cyt2b75_timer_channel);
+    }
+
+    period_val = Cy_Tcpwm_Pwm_GetPeriod(&TCPWM0->GRP[cyt2b75_timer_group].CNT[cyt2b75_timer_channel]);
+
+    // the period register holds the period in counter clocks - 1
+    if ((0u != compare_counts) && ((compare_counts - 1u) > period_val))
+    {
+        return ASDK_PWM_ERROR_INVALID_DUTY_CYCLE;
+    }
+
+    Cy_Tcpwm_Pwm_SetCompare0(&TCPWM0->GRP[cyt2b75_timer_group].CNT[cyt2b75_timer_channel],
+                             _asdk_cyt2b75_limit_compare(cyt2b75_timer_group, compare_counts));
+
+    return ASDK_PWM_SUCCESS;
+}
+
+/*Updates the duty cycle of the PWM channel during runtime, with a resolution of one counter clock*/
+asdk_errorcode_t asdk_pwm_set_duty_q16(asdk_pwm_channel_t pwm_ch, uint32_t duty_q16)
+{
+    uint8_t cyt2b75_timer_group;
+    uint8_t cyt2b75_timer_channel;
+    uint32_t compare_val;
+    uint32_t period_val;
+
+    /* validate channel */
+    if (ASDK_PWM_MODULE_CH_MAX <= pwm_ch)
+    {
+        return ASDK_PWM_ERROR_INVALID_CHANNEL;
+    }
+    else
+    {
+        // derive timer group and corresponding channel
+        _asdk_cyt2b75_get_timer_group_and_channel(pwm_ch, &cyt2b75_timer_group, &cyt2b75_timer_channel);
+    }
+
+    if (ASDK_PWM_DUTY_Q16_MAX < duty_q16)
+    {
+        return ASDK_PWM_ERROR_INVALID_DUTY_CYCLE;
+    }
+
+    period_val = Cy_Tcpwm_Pwm_GetPeriod(&TCPWM0->GRP[cyt2b75_timer_group].CNT[cyt2b75_timer_channel]);
+    compare_val = _asdk_cyt2b75_duty_to_compare(cyt2b75_timer_group, (uint64_t)period_val + 1u, duty_q16);
+
+    Cy_Tcpwm_Pwm_SetCompare0(&TCPWM0->GRP[cyt2b75_timer_group].CNT[cyt2b75_timer_channel], compare_val);
+
+    return ASDK_PWM_SUCCESS;
+}
+
+/*Stages a compare value for asdk_pwm_commit*/
+asdk_errorcode_t asdk_pwm_stage_duty_counts(asdk_pwm_channel_t pwm_ch, uint32_t compare_counts)
+{
+    uint8_t cyt2b75_timer_group;
+    uint8_t cyt2b75_timer_channel;
+
+    /* validate channel */
+    if (ASDK_PWM_MODULE_CH_MAX <= pwm_ch)
+    {
+        return ASDK_PWM_ERROR_INVALID_CHANNEL;
+    }
+    else
+    {
+        // derive timer group and corresponding channel
+        _asdk_cyt2b75_get_timer_group_and_channel(pwm_ch, &cyt2b75_timer_group, &cyt2b75_timer_channel);
+    }
+
+    /* at most the longest period of the counter */
+    if ((0u != compare_counts) && !_asdk_cyt2b75_is_period_valid(cyt2b75_timer_group, compare_counts - 1u))
+    {
+        return ASDK_PWM_ERROR_INVALID_DUTY_CYCLE;
+    }
+
+    pwm_stage[pwm_ch].duty = compare_counts;
+    pwm_stage[pwm_ch].flags = (pwm_stage[pwm_ch].flags & ~PWM_STAGE_DUTY_Q16) | PWM_STAGE_DUTY;
+    pwm_staged[pwm_ch / 32u] |= (1UL << (pwm_ch % 32u));
+
+    return ASDK_PWM_SUCCESS;
+}
+
+/*Stages a duty cycle for asdk_pwm_commit, converted with the period it is committed with*/
+asdk_errorcode_t asdk_pwm_stage_duty_q16(asdk_pwm_channel_t pwm_ch, uint32_t duty_q16)
+{
+    /* validate channel */
+    if (ASDK_PWM_MODULE_CH_MAX <= pwm_ch)
+    {
+        return ASDK_PWM_ERROR_INVALID_CHANNEL;
+    }
+
+    if (ASDK_PWM_DUTY_Q16_MAX < duty_q16)
+    {
+        return ASDK_PWM_ERROR_INVALID_DUTY_CYCLE;
+    }
+
+    pwm_stage[pwm_ch].duty = duty_q16;
+    pwm_stage[pwm_ch].flags |= (PWM_STAGE_DUTY | PWM_STAGE_DUTY_Q16);
+    pwm_staged[pwm_ch / 32u] |= (1UL << (pwm_ch % 32u));
+
+    return ASDK_PWM_SUCCESS;
+}
+
+/*Stages a period for asdk_pwm_commit*/
+asdk_errorcode_t asdk_pwm_stage_period_counts(asdk_pwm_channel_t pwm_ch, uint32_t period_counts)
+{
+    uint8_t cyt2b75_timer_group;
+    uint8_t cyt2b75_timer_channel;
+
+    /* validate channel */
+    if (ASDK_PWM_MODULE_CH_MAX <= pwm_ch)
+    {
+        return ASDK_PWM_ERROR_INVALID_CHANNEL;
+    }
+    else
+    {
+        // derive timer group and corresponding channel
+        _asdk_cyt2b75_get_timer_group_and_channel(pwm_ch, &cyt2b75_timer_group, &cyt2b75_timer_channel);
+    }
+
+    /* validate period against counter resolution */
+    if ((0u == period_counts) || !_asdk_cyt2b75_is_period_valid(cyt2b75_timer_group, period_counts - 1u))
+    {
+        return ASDK_PWM_ERROR_INVALID_FREQUENCY;
+    }
+
+    pwm_stage[pwm_ch].period_counts = period_counts;
+    pwm_stage[pwm_ch].flags |= PWM_STAGE_PERIOD;
+    pwm_staged[pwm_ch / 32u] |= (1UL << (pwm_ch % 32u));
+
+    return ASDK_PWM_SUCCESS;
+}
+
+/*Applies the staged updates of all channels at their next terminal count*/
+asdk_errorcode_t asdk_pwm_commit(void)
+{
+    volatile stc_TCPWM_GRP_CNT_t *timer_base_reg;
+    asdk_cyt2b75_pwm_stage_t *stage;
+    uint8_t cyt2b75_timer_group;
+    uint8_t cyt2b75_timer_channel;
+    uint64_t period_counts; // a full 32-bit period is 2^32 clocks
+    uint32_t compare_val;
+    uint32_t pending;
+    uint8_t pwm_ch;
+
+    /* fill the buffer registers, the output does not change until the switch below */
+    for (uint8_t word = 0; word < PWM_STAGED_WORDS; word++)
+    {
+        pending = pwm_staged[word];
+
+        while (0u != pending)
+        {
+            pwm_ch = (uint8_t)((word * 32u) + __builtin_ctz(pending));
+            pending &= pending - 1u;
+
+            _asdk_cyt2b75_get_timer_group_and_channel(pwm_ch, &cyt2b75_timer_group, &cyt2b75_timer_channel);
+            timer_base_reg = &TCPWM0->GRP[cyt2b75_timer_group].CNT[cyt2b75_timer_channel];
+            stage = &pwm_stage[pwm_ch];
+
+            if (stage->flags & PWM_STAGE_PERIOD)
+            {
+                period_counts = stage->period_counts;
+            }
+            else
+            {
+                period_counts = (uint64_t)timer_base_reg->unPERIOD.u32Register + 1u;
+            }
+
+            if (stage->flags & PWM_STAGE_DUTY_Q16)
+            {
+                compare_val = _asdk_cyt2b75_duty_to_compare(cyt2b75_timer_group, period_counts, stage->duty);
+            }
+            else if (stage->flags & PWM_STAGE_DUTY)
+            {
+                // a compare value past the period keeps the output active, same as the period
+                compare_val = _asdk_cyt2b75_limit_compare(cyt2b75_timer_group,
+                                                          (stage->duty < period_counts) ? stage->duty : period_counts);
+            }
+            else
+            {
+                compare_val = timer_base_reg->unCC0.u32Register;
+            }
+
+            // both are swapped, so both buffers must hold the values to run with
+            timer_base_reg->unCC0_BUFF.u32Register = compare_val;
+            timer_base_reg->unPERIOD_BUFF.u32Register = (uint32_t)(period_counts - 1u);
+
+            stage->flags = 0;
+        }
+    }
+
+    /* the switch events are latched and swap in the buffers at the next
+       terminal count, issue them back to back so channels running in step
+       switch in the same period */
+    ASDK_ENTER_CRITICAL_SECTION()
+
+    for (uint8_t word = 0; word < PWM_STAGED_WORDS; word++)
+    {
+        pending = pwm_staged[word];
+        pwm_staged[word] = 0;
+
+        while (0u != pending)
+        {
+            pwm_ch = (uint8_t)((word * 32u) + __builtin_ctz(pending));
+            pending &= pending - 1u;
+
+            _asdk_cyt2b75_get_timer_base(pwm_ch)->unTR_CMD.stcField.u1CAPTURE0 = 1u;
+        }
+    }
+
+    ASDK_EXIT_CRITICAL_SECTION()
+
+    return ASDK_PWM_SUCCESS;
+}
+
 /* static functions ************************** */
 static void _asdk_cyt2b75_get_timer_group_and_channel(asdk_pwm_channel_t asdk_timer_channel, uint8_t *cyt2b75_timer_group, uint8_t *cyt2b75_timer_channel)
 {
@@ -630,6 +880,36 @@ static void _asdk_cyt2b75_get_timer_group_and_channel(asdk_pwm_channel_t asdk_ti
     }
 }
 
+static volatile stc_TCPWM_GRP_CNT_t *_asdk_cyt2b75_get_timer_base(asdk_pwm_channel_t asdk_timer_channel)
+{
+    uint8_t cyt2b75_timer_group;
+    uint8_t cyt2b75_timer_channel;
+
+    _asdk_cyt2b75_get_timer_group_and_channel(asdk_timer_channel, &cyt2b75_timer_group, &cyt2b75_timer_channel);
+
+    return &TCPWM0->GRP[cyt2b75_timer_group].CNT[cyt2b75_timer_channel];
+}
+
+static uint32_t _asdk_cyt2b75_duty_to_compare(uint8_t timer_group, uint64_t period_counts, uint32_t duty_q16)
+{
+    return _asdk_cyt2b75_limit_compare(timer_group, (period_counts * duty_q16) >> 16);
+}
+
+static uint32_t _asdk_cyt2b75_limit_compare(uint8_t timer_group, uint64_t compare_val)
+{
+    // 100 % of a full period does not fit the compare register, the last clock is lost
+    if (0xFFFFFFFFu < compare_val)
+    {
+        compare_val = 0xFFFFFFFFu;
+    }
+    else if (!_asdk_cyt2b75_is_period_valid(timer_group, (uint32_t)compare_val))
+    {
+        compare_val = 0xFFFFu;
+    }
+
+    return (uint32_t)compare_val;
+}
+
 static bool _asdk_cyt2b75_is_period_valid(uint8_t timer_group, uint32_t period)
 {
 
@@ -743,6 +1023,7 @@ static asdk_errorcode_t _asdk_cyt2b75_init_pwm(uint8_t asdk_timer_channel, uint8
         // general settings
         cyt2b75_pwm_config.clockPrescaler = pwm_config->pwm_clock.prescaler;
     cyt2b75_pwm_config.period = pwm_period - 1;
+    cyt2b75_pwm_config.period_buff = pwm_period - 1;
 
     /*Get the compare value from the duty cycle passed as parameter*/
     compare_val = (uint32_t)(((pwm_config->pwm_duty_cycle_in_percent) * pwm_period) / 100);
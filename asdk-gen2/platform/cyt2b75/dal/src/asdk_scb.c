@@ -66,6 +66,34 @@ cy_en_intr_t scb_isr_irqn[MAX_SCB_MODULES] = {
   scb_7_interrupt_IRQn
 };
 
+/* One-to-one triggers of the SCB FIFO levels to their hard-wired P-DMA0 channels */
+const uint32_t scb_dma_tx_trig[MAX_SCB_MODULES] = {
+  TRIG_OUT_1TO1_1_SCB0_TX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB1_TX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB2_TX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB3_TX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB4_TX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB5_TX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB6_TX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB7_TX_TO_PDMA0
+};
+
+const uint32_t scb_dma_rx_trig[MAX_SCB_MODULES] = {
+  TRIG_OUT_1TO1_1_SCB0_RX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB1_RX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB2_RX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB3_RX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB4_RX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB5_RX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB6_RX_TO_PDMA0,
+  TRIG_OUT_1TO1_1_SCB7_RX_TO_PDMA0
+};
+
+/* P-DMA0 channels at the end of the triggers above, scb[n].tr_tx_req and
+   scb[n].tr_rx_req to cpuss.dw0_tr_in[] in the device trigger table */
+const uint8_t scb_dma_tx_chnl[MAX_SCB_MODULES] = {16, 18, 20, 22, 24, 26, 28, 30};
+const uint8_t scb_dma_rx_chnl[MAX_SCB_MODULES] = {17, 19, 21, 23, 25, 27, 29, 31};
+
 /* Mapping between SCB block and Interrupt handler */
 cy_systemIntr_Handler scb_isr_handlers[MAX_SCB_MODULES] = {
     scb0_isr,
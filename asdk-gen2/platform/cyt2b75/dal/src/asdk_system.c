@@ -47,6 +47,10 @@
 
 ==============================================================================*/
 
+/* SYS_TIMER interrupts at the half and at the end of its 32-bit range */
+#define SYS_TIMER_HALF_RANGE 0x80000000UL
+#define SYS_TIMER_LATE_TC 0xC0000000UL
+
 /*==============================================================================
 
                       LOCAL DEFINITIONS AND TYPES : ENUMS
@@ -86,12 +90,15 @@ extern uint64_t asdk_os_get_time_in_ms(void);
 /* static variables ************************** */
 
 #ifdef SYS_TIMER
+/* Free-running 1 MHz counter over the full 32-bit range, the period register
+   holds timer_period - 1 so 0 selects 2^32 counts. */
 static asdk_timer_t sys_timer_config = {
     .type = ASDK_TIMER_TYPE_PERIODIC,
     .mode = {
-        .type = ASDK_TIMER_MODE_TIMER,
-        .config.timer = {
-            .timer_period = 1000 /* ms */,
+        .type = ASDK_TIMER_MODE_COMPARE,
+        .config.compare = {
+            .timer_period = 0,
+            .compare_value = SYS_TIMER_HALF_RANGE,
             .callback = __sys_timer_callback,
         },
     },
@@ -107,7 +114,10 @@ static asdk_timer_t sys_timer_config = {
     },
 };
 
-static int64_t ms_counter_value = -1;
+/* Half periods of SYS_TIMER passed, counted by its match and terminal count
+   interrupts. The lowest bit tells which half of the range the counter was
+   last seen in, which lets readers fix up a count the ISR has not seen yet. */
+static volatile uint32_t sys_timer_halves = 0;
 #endif
 
 /*==============================================================================                                       \
@@ -124,7 +134,7 @@ asdk_errorcode_t asdk_sys_init()
     asdk_timer_init(SYS_TIMER, &sys_timer_config);
 
     /* Making counter value to start from 0 and then starting timer */
-    ms_counter_value = 0;
+    sys_timer_halves = 0;
     asdk_timer_start(SYS_TIMER);
 #endif
 
@@ -158,12 +168,44 @@ int64_t asdk_sys_get_time_ms(void)
 #endif
 
 #ifdef SYS_TIMER
-    return ms_counter_value;
+    return (int64_t)(asdk_sys_get_time_us() / 1000U);
 #else
     return -1;
 #endif
 }
 
+/*! Lock-free, the counter is read once: the halves counted by the ISR must
+  agree with the top bit of the counter. When they don't, the ISR is either
+  pending (counter a half ahead) or already ran on the terminal count, which
+  fires while the counter still holds its last value. */
+uint64_t asdk_sys_get_time_us(void)
+{
+#ifdef SYS_TIMER
+    uint32_t halves = sys_timer_halves;
+    uint32_t counter = 0;
+    uint32_t upper_half;
+
+    asdk_timer_get_counter(SYS_TIMER, &counter);
+    upper_half = (counter >= SYS_TIMER_HALF_RANGE) ? 1U : 0U;
+
+    if ((halves & 1U) != upper_half)
+    {
+        if (upper_half && (counter >= SYS_TIMER_LATE_TC))
+        {
+            halves--;
+        }
+        else
+        {
+            halves++;
+        }
+    }
+
+    return ((uint64_t)(halves >> 1) << 32) | counter;
+#else
+    return 0;
+#endif
+}
+
 asdk_sys_reset_t asdk_sys_get_reset_reason(void)
 {
     asdk_sys_reset_t reason = ASDK_SYS_RESET_UNKNOWN;
@@ -274,7 +316,8 @@ void __sys_timer_callback(asdk_timer_event_t timer_event)
 {
 	switch (timer_event) {
 	case ASDK_TIMER_TERMINAL_COUNT_EVENT:
-        ms_counter_value++;
+	case ASDK_TIMER_MATCH_EVENT:
+        sys_timer_halves++;
 		break;
 
 	default:
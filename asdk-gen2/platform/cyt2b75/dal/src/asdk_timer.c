@@ -770,7 +770,20 @@ static asdk_errorcode_t _asdk_cyt2b75_init_capture(uint8_t asdk_timer_channel, u
 
     /* configure mcu pin for capture input */
 
+    // the pin drives trigger input 0 of the counter, selected below as capture input 2
     capture_pin_cfg[0].MCU_pin_num = capture_config->mcu_pin;
+    if (ASDK_CYT2B75_TIMER_GROUP_0 == cyt2b75_timer_group)
+    {
+        capture_pin_cfg[0].alternate_fun_id = ASDK_PINMUX_ALTFUN(ASDK_PINMUX_FUN_TCPWM_TRIG, ASDK_PINMUX_TCPWM0_CHX_SUBFUN_TRIG0, cyt2b75_timer_channel);
+    }
+    else if (ASDK_CYT2B75_TIMER_GROUP_1 == cyt2b75_timer_group)
+    {
+        capture_pin_cfg[0].alternate_fun_id = ASDK_PINMUX_ALTFUN(ASDK_PINMUX_FUN_TCPWM_TRIG, ASDK_PINMUX_TCPWM1_CHX_SUBFUN_TRIG0, cyt2b75_timer_channel);
+    }
+    else
+    {
+        capture_pin_cfg[0].alternate_fun_id = ASDK_PINMUX_ALTFUN(ASDK_PINMUX_FUN_TCPWM_TRIG, ASDK_PINMUX_TCPWM2_CHX_SUBFUN_TRIG0, cyt2b75_timer_channel);
+    }
 
     pinmux_status = asdk_set_pinmux(capture_pin_cfg, 1);
 
@@ -789,7 +802,8 @@ static asdk_errorcode_t _asdk_cyt2b75_init_capture(uint8_t asdk_timer_channel, u
     {
         timer_isr_src = tcpwm_0_interrupts_0_IRQn + asdk_timer_channel;
 
-        // enable terminal-count interrupt
+        // enable terminal-count interrupt, capture edges are added below
+        cyt2b75_counter_config.interruptSources = CY_TCPWM_INT_NONE;
         intr_mask->stcField.u1TC = 1;
 
         // interrupt configuration
@@ -30,10 +30,13 @@
 #include "asdk_scb.h"
 #include "asdk_uart.h"
 #include "asdk_pinmux.h"
+#include "asdk_system.h"
 
 // sdk includes
 #include "cy_device_headers.h" // Defines reg. and variant of CYT2B7 series
 #include "scb/cy_scb_uart.h"    // CYT2B75 UART driver APIs
+#include "dma/cy_pdma.h"        // CYT2B75 P-DMA (DataWire) driver APIs
+#include "trigmux/cy_trigmux.h" // CYT2B75 trigger multiplexer APIs
 #include "sysclk/cy_sysclk.h"
 #include "sysint/cy_sysint.h" // CYT2B75 system Interrupt APIs
 
@@ -68,6 +71,22 @@
                                  0                               \
                                 )
 
+/* DMA mode: the FIFO levels trigger DMA, only errors interrupt the CPU */
+#define E_UART_DMA_RX_INTR_FACTER (                              \
+                                 CY_SCB_UART_RX_OVERFLOW     |   \
+                                 CY_SCB_UART_RX_ERR_FRAME    |   \
+                                 CY_SCB_UART_RX_ERR_PARITY   |   \
+                                 CY_SCB_UART_RX_BREAK_DETECT |   \
+                                 0                               \
+                                )
+#define E_UART_DMA_TX_INTR_FACTER (                              \
+                                 CY_SCB_UART_TX_OVERFLOW     |   \
+                                 0                               \
+                                )
+
+/* DMA descriptor limits, X loop of 256 and Y loop of 256 */
+#define UART_DMA_X_COUNT_MAX 256ul
+#define UART_DMA_SEGMENT_MAX (UART_DMA_X_COUNT_MAX * 256ul)
 
 /*==============================================================================
 
@@ -75,6 +94,32 @@
 
 ==============================================================================*/
 
+/*==============================================================================
+
+                      LOCAL DEFINITIONS AND TYPES : STRUCTURES
+
+==============================================================================*/
+
+/* DMA mode state of a UART, descriptors must stay in RAM while in use */
+typedef struct
+{
+    bool enabled;
+    uint8_t rx_channel;
+    uint8_t tx_channel;
+
+    uint8_t *rx_buffer;
+    uint32_t rx_len;
+    uint32_t rx_read;     /* next byte to be reported */
+    uint32_t rx_last_pos; /* write position seen by the previous idle check */
+    volatile bool rx_reporting; /* idle check in the callback, the ISR leaves rx_read alone */
+    cy_stc_pdma_descr_t rx_descr[2];
+
+    volatile bool tx_busy;
+    uint8_t *tx_data;     /* first segment, passed to the callback */
+    uint32_t tx_len;      /* total of all segments */
+    cy_stc_pdma_descr_t tx_descr[ASDK_UART_DMA_TX_DESCR_MAX];
+} uart_dma_t;
+
 /*==============================================================================
 
                         LOCAL AND EXTERNAL DEFINITIONS
@@ -83,8 +128,13 @@
 
 extern volatile stc_SCB_t *scb_base_ptrs[];
 extern uint8_t scb_uart[];
+extern const uint32_t scb_dma_tx_trig[];
+extern const uint32_t scb_dma_rx_trig[];
+extern const uint8_t scb_dma_tx_chnl[];
+extern const uint8_t scb_dma_rx_chnl[];
 /* Driver state structure e*/
 static cy_stc_scb_uart_context_t g_stc_uart_context[ASDK_UART_MAX];
+static uart_dma_t uart_dma[ASDK_UART_MAX];
 
 /*==============================================================================
 
@@ -128,6 +178,13 @@ static void scb_uart7_callback_handler(uint32_t event);
 /* Helping inline functions */
 static inline void __asdk_uart_callback_caller(asdk_uart_num_t uart_no, uint32_t event);
 
+/* DMA mode */
+static asdk_errorcode_t __asdk_uart_dma_validate(asdk_uart_config_t *uart_config_data);
+static void __asdk_uart_dma_init(asdk_uart_num_t uart_no, volatile stc_SCB_t *scb, asdk_uart_config_t *uart_config_data);
+static uint32_t __asdk_uart_dma_rx_position(uart_dma_t *dma);
+static void __asdk_uart_dma_rx_report(asdk_uart_num_t uart_no, uint32_t pos);
+static void __asdk_uart_dma_isr(void);
+
 /*==============================================================================
 
                             LOCAL FUNCTION DEFINITIONS
@@ -254,6 +311,18 @@ asdk_errorcode_t asdk_uart_init(asdk_uart_config_t *uart_config_data)
         return ASDK_UART_ERROR_ISR_REQUIRED;
     }
 
+    if (true == uart_config_data->uart_dma_config.enable_dma)
+    {
+        ret_val = __asdk_uart_dma_validate(uart_config_data);
+        if (ASDK_UART_STATUS_SUCCESS != ret_val)
+        {
+            return ret_val;
+        }
+
+        stc_uart_config.rxFifoIntEnableMask = E_UART_DMA_RX_INTR_FACTER;
+        stc_uart_config.txFifoIntEnableMask = E_UART_DMA_TX_INTR_FACTER;
+    }
+
     /* Updating necessary configurations */
     if (ASDK_UART_DATA_BITS_UNDEFINED <= uart_config_data->data_bits)
         return ASDK_UART_ERROR_INVALID_DATABITS;
@@ -272,11 +341,17 @@ asdk_errorcode_t asdk_uart_init(asdk_uart_config_t *uart_config_data)
 
     /* De-Initialize the UART Instance */
     Cy_SCB_UART_DeInit(scb);
+    uart_dma[uart_config_data->uart_no].enabled = false;
 
     /* SCB Initilization for UART */
     cyt_uart_status = Cy_SCB_UART_Init(scb, &stc_uart_config, &g_stc_uart_context[uart_config_data->uart_no]);
     if (CY_SCB_UART_SUCCESS == cyt_uart_status)
     {
+        if (true == uart_config_data->uart_dma_config.enable_dma)
+        {
+            __asdk_uart_dma_init(uart_config_data->uart_no, scb, uart_config_data);
+        }
+
         Cy_SCB_UART_Enable(scb);
         ret_val = ASDK_UART_STATUS_SUCCESS;
     }
@@ -308,6 +383,14 @@ asdk_errorcode_t asdk_uart_deinit(asdk_uart_num_t uart_no)
         return ASDK_UART_ERROR_NOT_INITIALIZED;
     }
 
+    if (uart_dma[uart_no].enabled)
+    {
+        Cy_PDMA_Chnl_Disable(DW0, uart_dma[uart_no].rx_channel);
+        Cy_PDMA_Chnl_Disable(DW0, uart_dma[uart_no].tx_channel);
+        uart_dma[uart_no].enabled = false;
+        uart_dma[uart_no].tx_busy = false;
+    }
+
     /* De-Initialize the UART Instance */
     Cy_SCB_UART_Disable(scb, &g_stc_uart_context[uart_no]);
     Cy_SCB_UART_DeInit(scb);
@@ -379,6 +462,13 @@ asdk_errorcode_t asdk_uart_write_non_blocking(asdk_uart_num_t uart_no, uint8_t *
         return ASDK_UART_ERROR_RANGE_EXCEEDED;
     }
 
+    if (uart_dma[uart_no].enabled)
+    {
+        asdk_uart_tx_segment_t segment = {.data = data, .data_len = data_len};
+
+        return asdk_uart_write_scatter(uart_no, &segment, 1);
+    }
+
     scb_index = scb_uart[uart_no];
     scb = scb_base_ptrs[scb_index];
 
@@ -404,6 +494,12 @@ asdk_errorcode_t asdk_uart_read_non_blocking(asdk_uart_num_t uart_no, uint8_t *d
         return ASDK_UART_ERROR_RANGE_EXCEEDED;
     }
 
+    /* DMA receives continuously into the circular buffer */
+    if (uart_dma[uart_no].enabled)
+    {
+        return ASDK_UART_ERROR_READ_FAIL;
+    }
+
     scb_index = scb_uart[uart_no];
     scb = scb_base_ptrs[scb_index];
 
@@ -417,6 +513,166 @@ asdk_errorcode_t asdk_uart_read_non_blocking(asdk_uart_num_t uart_no, uint8_t *d
     return ASDK_UART_STATUS_SUCCESS;
 }
 
+asdk_errorcode_t asdk_uart_write_scatter(asdk_uart_num_t uart_no, const asdk_uart_tx_segment_t *segments, uint8_t segment_count)
+{
+    uart_dma_t *dma;
+    cy_stc_pdma_descr_config_t descr_config = {
+        .deact = CY_PDMA_RETDIG_4CYC,
+        .intrType = CY_PDMA_INTR_DESCR_CHAIN_CMPLT,
+        .trigoutType = CY_PDMA_TRIGOUT_DESCR_CMPLT,
+        .triginType = CY_PDMA_TRIGIN_1ELEMENT,
+        .dataSize = CY_PDMA_BYTE,
+        .srcTxfrSize = CY_PDMA_TXFR_SIZE_DATA_SIZE,
+        .destTxfrSize = CY_PDMA_TXFR_SIZE_WORD,
+        .srcXincr = 1,
+        .destXincr = 0,
+        .srcYincr = UART_DMA_X_COUNT_MAX,
+        .destYincr = 0,
+    };
+    uint32_t descr_total = 0;
+    uint32_t descr_count = 0;
+    uint32_t remaining;
+    uint8_t *src;
+
+    if (ASDK_UART_MAX <= uart_no)
+    {
+        return ASDK_UART_ERROR_RANGE_EXCEEDED;
+    }
+
+    if ((NULL == segments) || (0 == segment_count))
+    {
+        return ASDK_UART_ERROR_NULL_PTR;
+    }
+
+    dma = &uart_dma[uart_no];
+
+    if (!dma->enabled)
+    {
+        return ASDK_UART_ERROR_NOT_INITIALIZED;
+    }
+
+    if (dma->tx_busy)
+    {
+        return ASDK_UART_ERROR_DMA_BUSY;
+    }
+
+    /* a segment takes one descriptor, or a 2D one plus the remainder when longer than an X loop */
+    for (uint8_t i = 0; i < segment_count; i++)
+    {
+        if ((NULL == segments[i].data) || (0 == segments[i].data_len) ||
+            (UART_DMA_SEGMENT_MAX < segments[i].data_len))
+        {
+            return ASDK_UART_ERROR_INVALID_DMA_CONFIG;
+        }
+
+        descr_total += 1U;
+        if ((UART_DMA_X_COUNT_MAX < segments[i].data_len) && (0U != (segments[i].data_len % UART_DMA_X_COUNT_MAX)))
+        {
+            descr_total += 1U;
+        }
+    }
+
+    if (ASDK_UART_DMA_TX_DESCR_MAX < descr_total)
+    {
+        return ASDK_UART_ERROR_INVALID_DMA_CONFIG;
+    }
+
+    descr_config.destAddr = (void *)&scb_base_ptrs[scb_uart[uart_no]]->unTX_FIFO_WR.u32Register;
+    dma->tx_len = 0;
+
+    for (uint8_t i = 0; i < segment_count; i++)
+    {
+        src = segments[i].data;
+        remaining = segments[i].data_len;
+
+        while (0U != remaining)
+        {
+            descr_config.srcAddr = src;
+
+            if (UART_DMA_X_COUNT_MAX < remaining)
+            {
+                descr_config.descrType = CY_PDMA_2D_TRANSFER;
+                descr_config.xCount = UART_DMA_X_COUNT_MAX;
+                descr_config.yCount = remaining / UART_DMA_X_COUNT_MAX;
+            }
+            else
+            {
+                descr_config.descrType = CY_PDMA_1D_TRANSFER;
+                descr_config.xCount = remaining;
+                descr_config.yCount = 1;
+            }
+
+            /* the last descriptor ends the chain and disables the channel */
+            if ((descr_count + 1U) < descr_total)
+            {
+                descr_config.descrNext = &dma->tx_descr[descr_count + 1U];
+                descr_config.chStateAtCmplt = CY_PDMA_CH_ENABLED;
+            }
+            else
+            {
+                descr_config.descrNext = NULL;
+                descr_config.chStateAtCmplt = CY_PDMA_CH_DISABLED;
+            }
+
+            Cy_PDMA_Descr_Init(&dma->tx_descr[descr_count], &descr_config);
+
+            src += descr_config.xCount * descr_config.yCount;
+            remaining -= descr_config.xCount * descr_config.yCount;
+            descr_count++;
+        }
+
+        dma->tx_len += segments[i].data_len;
+    }
+
+    dma->tx_data = segments[0].data;
+    dma->tx_busy = true;
+
+    Cy_PDMA_Chnl_SetDescr(DW0, dma->tx_channel, &dma->tx_descr[0]);
+    Cy_PDMA_Chnl_Enable(DW0, dma->tx_channel);
+
+    return ASDK_UART_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_uart_dma_rx_idle_check(asdk_uart_num_t uart_no)
+{
+    uart_dma_t *dma;
+    uint32_t primask;
+    uint32_t pos;
+    bool report;
+
+    if (ASDK_UART_MAX <= uart_no)
+    {
+        return ASDK_UART_ERROR_RANGE_EXCEEDED;
+    }
+
+    dma = &uart_dma[uart_no];
+
+    if (!dma->enabled)
+    {
+        return ASDK_UART_ERROR_NOT_INITIALIZED;
+    }
+
+    /* the half complete interrupt reports too, hold it off while reporting */
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    pos = __asdk_uart_dma_rx_position(dma);
+    report = (pos == dma->rx_last_pos) && (pos != dma->rx_read) && !dma->rx_reporting;
+    dma->rx_last_pos = pos;
+    dma->rx_reporting = report;
+
+    __set_PRIMASK(primask);
+
+    /* outside the lock, a half completing meanwhile is reported by the next check */
+    if (report)
+    {
+        __asdk_uart_dma_rx_report(uart_no, pos);
+        dma->rx_reporting = false;
+    }
+
+    return ASDK_UART_STATUS_SUCCESS;
+}
+
 /*----------------------------------------------------------------------------*/
 /* Function : __asdk_uart_callback_caller */
 /*----------------------------------------------------------------------------*/
@@ -600,3 +856,246 @@ void UART7_ISR_UserCallback(void)
     /* UART interrupt handler for High-Level APIs */
     Cy_SCB_UART_Interrupt(scb_base_ptrs[scb_uart[7]], &g_stc_uart_context[7]);
 }
+
+/*----------------------------------------------------------------------------*/
+/* Function : __asdk_uart_dma_validate */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Validates the DMA config of a UART, the circular RX buffer is split in two
+  halves of one X loop each. The channels are not taken from the config, the
+  SCB triggers are hard-wired to theirs, see @ref __asdk_uart_dma_init.
+
+  @param asdk_uart_config_t *uart_config_data - UART configuration
+
+  @return
+    - @ref ASDK_UART_STATUS_SUCCESS
+    - @ref ASDK_UART_ERROR_INVALID_DMA_CONFIG
+*/
+static asdk_errorcode_t __asdk_uart_dma_validate(asdk_uart_config_t *uart_config_data)
+{
+    asdk_uart_dma_config_t *dma_config = &uart_config_data->uart_dma_config;
+
+    if ((NULL == dma_config->uart_rx_data_buffer) ||
+        (2U > dma_config->uart_rx_data_len_bytes) ||
+        (ASDK_UART_DMA_RX_BUFFER_MAX < dma_config->uart_rx_data_len_bytes) ||
+        (0U != (dma_config->uart_rx_data_len_bytes & 1U)))
+    {
+        return ASDK_UART_ERROR_INVALID_DMA_CONFIG;
+    }
+
+    return ASDK_UART_STATUS_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/* Function : __asdk_uart_dma_init */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Routes the SCB FIFO triggers to the DMA channels and starts the circular
+  reception. The one-to-one triggers only reach one P-DMA0 channel each, so
+  the channels follow from the SCB index. They interrupt on the same CPU
+  interrupt as the SCB.
+
+  @param asdk_uart_num_t uart_no - ASDK UART number
+  @param volatile stc_SCB_t *scb - SCB of the UART, initialized but not enabled
+  @param asdk_uart_config_t *uart_config_data - UART configuration
+
+  @return void
+*/
+static void __asdk_uart_dma_init(asdk_uart_num_t uart_no, volatile stc_SCB_t *scb, asdk_uart_config_t *uart_config_data)
+{
+    asdk_uart_dma_config_t *dma_config = &uart_config_data->uart_dma_config;
+    uart_dma_t *dma = &uart_dma[uart_no];
+    uint8_t scb_index = scb_uart[uart_no];
+    uint32_t half = dma_config->uart_rx_data_len_bytes / 2U;
+    cy_stc_pdma_descr_config_t rx_descr_config = {
+        .deact = CY_PDMA_RETDIG_4CYC,
+        .intrType = CY_PDMA_INTR_DESCR_CMPLT,
+        .trigoutType = CY_PDMA_TRIGOUT_DESCR_CMPLT,
+        .chStateAtCmplt = CY_PDMA_CH_ENABLED,
+        .triginType = CY_PDMA_TRIGIN_1ELEMENT,
+        .dataSize = CY_PDMA_BYTE,
+        .srcTxfrSize = CY_PDMA_TXFR_SIZE_WORD,
+        .destTxfrSize = CY_PDMA_TXFR_SIZE_DATA_SIZE,
+        .descrType = CY_PDMA_1D_TRANSFER,
+        .srcAddr = (void *)&scb->unRX_FIFO_RD.u32Register,
+        .srcXincr = 0,
+        .destXincr = 1,
+        .xCount = half,
+    };
+    cy_stc_pdma_chnl_config_t chnl_config = {
+        .PDMA_Descriptor = &dma->rx_descr[0],
+        .preemptable = false,
+        .priority = 0,
+        .enable = false,
+    };
+    cy_stc_sysint_irq_t irq_cfg = {
+        .intIdx = uart_config_data->interrupt_config.intr_num,
+        .isEnabled = true,
+    };
+
+    dma->rx_channel = scb_dma_rx_chnl[scb_index];
+    dma->tx_channel = scb_dma_tx_chnl[scb_index];
+
+    Cy_PDMA_Chnl_Disable(DW0, dma->rx_channel);
+    Cy_PDMA_Chnl_Disable(DW0, dma->tx_channel);
+
+    dma->rx_buffer = dma_config->uart_rx_data_buffer;
+    dma->rx_len = dma_config->uart_rx_data_len_bytes;
+    dma->rx_read = 0;
+    dma->rx_last_pos = 0;
+    dma->rx_reporting = false;
+    dma->tx_busy = false;
+
+    /* two halves chained into a ring, each completion interrupts */
+    rx_descr_config.destAddr = &dma->rx_buffer[0];
+    rx_descr_config.descrNext = &dma->rx_descr[1];
+    Cy_PDMA_Descr_Init(&dma->rx_descr[0], &rx_descr_config);
+
+    rx_descr_config.destAddr = &dma->rx_buffer[half];
+    rx_descr_config.descrNext = &dma->rx_descr[0];
+    Cy_PDMA_Descr_Init(&dma->rx_descr[1], &rx_descr_config);
+
+    /* RX requests while the FIFO holds a byte, TX while it has room for one */
+    Cy_SCB_SetRxFifoLevel(scb, 0);
+    Cy_SCB_SetTxFifoLevel(scb, Cy_SCB_GetFifoSize(scb) - 1UL);
+    Cy_TrigMux_Connect1To1(scb_dma_rx_trig[scb_index], 0, TRIGGER_TYPE_LEVEL, 0);
+    Cy_TrigMux_Connect1To1(scb_dma_tx_trig[scb_index], 0, TRIGGER_TYPE_LEVEL, 0);
+
+    Cy_PDMA_Chnl_Init(DW0, dma->rx_channel, &chnl_config);
+    chnl_config.PDMA_Descriptor = &dma->tx_descr[0];
+    Cy_PDMA_Chnl_Init(DW0, dma->tx_channel, &chnl_config);
+
+    Cy_PDMA_Chnl_SetInterruptMask(DW0, dma->rx_channel);
+    Cy_PDMA_Chnl_SetInterruptMask(DW0, dma->tx_channel);
+
+    irq_cfg.sysIntSrc = (cy_en_intr_t)(cpuss_interrupts_dw0_0_IRQn + dma->rx_channel);
+    Cy_SysInt_InitIRQ(&irq_cfg);
+    Cy_SysInt_SetSystemIrqVector(irq_cfg.sysIntSrc, __asdk_uart_dma_isr);
+
+    irq_cfg.sysIntSrc = (cy_en_intr_t)(cpuss_interrupts_dw0_0_IRQn + dma->tx_channel);
+    Cy_SysInt_InitIRQ(&irq_cfg);
+    Cy_SysInt_SetSystemIrqVector(irq_cfg.sysIntSrc, __asdk_uart_dma_isr);
+
+    Cy_PDMA_Enable(DW0);
+    Cy_PDMA_Chnl_Enable(DW0, dma->rx_channel);
+
+    dma->enabled = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/* Function : __asdk_uart_dma_rx_position */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Offset in the circular RX buffer the DMA writes next.
+
+  @param uart_dma_t *dma - DMA state of the UART
+
+  @return uint32_t - Write position, 0 to rx_len - 1
+*/
+static uint32_t __asdk_uart_dma_rx_position(uart_dma_t *dma)
+{
+    volatile stc_DW_CH_STRUCT_t *ch = &DW0->CH_STRUCT[dma->rx_channel];
+    uint32_t descr;
+    uint32_t x_idx;
+
+    /* the index resets when the descriptor switches, read until both agree */
+    do
+    {
+        descr = ch->unCH_CURR_PTR.u32Register;
+        x_idx = ch->unCH_IDX.stcField.u8X_IDX;
+    } while (descr != ch->unCH_CURR_PTR.u32Register);
+
+    if (descr == (uint32_t)&dma->rx_descr[1])
+    {
+        x_idx += dma->rx_len / 2U;
+    }
+
+    return x_idx;
+}
+
+/*----------------------------------------------------------------------------*/
+/* Function : __asdk_uart_dma_rx_report */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Passes the unreported bytes up to the write position to the user callback,
+  in two calls when they wrap around the end of the circular buffer.
+
+  @param asdk_uart_num_t uart_no - ASDK UART number
+  @param uint32_t pos - DMA write position
+
+  @return void
+*/
+static void __asdk_uart_dma_rx_report(asdk_uart_num_t uart_no, uint32_t pos)
+{
+    uart_dma_t *dma = &uart_dma[uart_no];
+
+    if (pos < dma->rx_read)
+    {
+        if (NULL != user_uart_callback_fun_list[uart_no])
+        {
+            user_uart_callback_fun_list[uart_no](uart_no, &dma->rx_buffer[dma->rx_read], dma->rx_len - dma->rx_read, ASDK_UART_STATUS_RECEIVE_COMPLETE);
+        }
+        dma->rx_read = 0;
+    }
+
+    if (pos > dma->rx_read)
+    {
+        if (NULL != user_uart_callback_fun_list[uart_no])
+        {
+            user_uart_callback_fun_list[uart_no](uart_no, &dma->rx_buffer[dma->rx_read], pos - dma->rx_read, ASDK_UART_STATUS_RECEIVE_COMPLETE);
+        }
+        dma->rx_read = pos;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/* Function : __asdk_uart_dma_isr */
+/*----------------------------------------------------------------------------*/
+/*!
+  @brief
+  Shared handler of the UART DMA channels: a completed RX half reports the
+  received bytes, a completed TX chain reports transmit complete.
+
+  @param void
+
+  @return void
+*/
+static void __asdk_uart_dma_isr(void)
+{
+    uart_dma_t *dma;
+
+    for (uint8_t uart_no = 0; uart_no < ASDK_UART_MAX; uart_no++)
+    {
+        dma = &uart_dma[uart_no];
+
+        if (!dma->enabled)
+        {
+            continue;
+        }
+
+        if (0UL != Cy_PDMA_Chnl_GetInterruptStatusMasked(DW0, dma->rx_channel))
+        {
+            Cy_PDMA_Chnl_ClearInterrupt(DW0, dma->rx_channel);
+            if (!dma->rx_reporting)
+            {
+                __asdk_uart_dma_rx_report(uart_no, __asdk_uart_dma_rx_position(dma));
+            }
+        }
+
+        if (0UL != Cy_PDMA_Chnl_GetInterruptStatusMasked(DW0, dma->tx_channel))
+        {
+            Cy_PDMA_Chnl_ClearInterrupt(DW0, dma->tx_channel);
+
+            /* the last byte is in the FIFO, the buffers may be reused */
+            dma->tx_busy = false;
+            if (NULL != user_uart_callback_fun_list[uart_no])
+            {
+                user_uart_callback_fun_list[uart_no](uart_no, dma->tx_data, dma->tx_len, ASDK_UART_STATUS_TRANSMIT_COMPLETE);
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/*
+   @file
+   emulated_eeprom_bench.c
+
+   @path
+   test/emulated_eeprom/emulated_eeprom_bench.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Init, read and write latency of the blocking emulated EEPROM against the
+   RAM-backed flash of host_flash.c. Host time is reported next to the flash
+   operations per call, which is what dominates on the device: blank checks
+   (and the words they cover), program and erase operations.
+
+   The workload fills a 256 byte structure with 4 byte writes at random
+   offsets, enough to go through several page transfers, then re-inits from
+   flash and reads every member back.
+*/
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "asdk_emulated_eeprom.h"
+#include "host_flash.h"
+
+/* structure size */
+#define BENCH_STRUCT_SIZE 256U
+
+#define BENCH_WRITES 12000U
+#define BENCH_READS 10000U
+
+static uint8_t bench_struct[BENCH_STRUCT_SIZE];
+static uint8_t bench_expected[BENCH_STRUCT_SIZE];
+
+static uint64_t bench_start_ns;
+static uint32_t bench_overwrites;
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+static uint64_t __bench_now_ns(void) {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+static void __bench_start(void) {
+  host_flash_reset_stats();
+  bench_start_ns = __bench_now_ns();
+}
+
+static void __bench_report(const char *what, uint32_t calls) {
+  double ns = (double)(__bench_now_ns() - bench_start_ns) / calls;
+  host_flash_stats_t stats;
+
+  host_flash_get_stats(&stats);
+  bench_overwrites += stats.overwrites;
+
+  printf("%-18s %9.0f ns  blank checks %7.1f (%8.1f words)  programs %6.2f  erases %6.3f\n", what, ns,
+         (double)stats.blank_checks / calls, (double)stats.blank_check_words / calls,
+         (double)stats.program_ops / calls, (double)stats.erase_ops / calls);
+}
+
+static int __bench_main(void) {
+  asdk_emulated_eeprom_init_deinit_config_t config = {
+      .flash_type_used = ASDK_EMULATED_EEPROM_INIT_FLASHTYPE_DATA_FLASH,
+      .emulated_eeprom_operation_mode = ASDK_EMULATED_EEPROM_OPERATION_BLOCKING_MODE,
+  };
+  uint32_t seed = 1;
+  uint32_t value;
+  uint32_t bad = 0;
+
+  printf("per call, %u byte structure, %u writes of 4 bytes\n", BENCH_STRUCT_SIZE, BENCH_WRITES);
+
+  __bench_start();
+  asdk_emulated_eeprom_init(&config, bench_struct, BENCH_STRUCT_SIZE);
+  __bench_report("init, blank", 1);
+
+  __bench_start();
+  for (uint32_t i = 0; i < BENCH_WRITES; i++) {
+    uint32_t offset;
+
+    seed = (seed * 1103515245U) + 12345U;
+    offset = ((seed >> 16) % (BENCH_STRUCT_SIZE / 4U)) * 4U;
+
+    memcpy(&bench_struct[offset], &i, sizeof(i));
+    asdk_emulated_eeprom_write(&bench_struct[offset], bench_struct, sizeof(i), BENCH_STRUCT_SIZE);
+  }
+  __bench_report("write 4 B", BENCH_WRITES);
+
+  memcpy(bench_expected, bench_struct, BENCH_STRUCT_SIZE);
+  memset(bench_struct, 0, BENCH_STRUCT_SIZE);
+
+  __bench_start();
+  asdk_emulated_eeprom_init(&config, bench_struct, BENCH_STRUCT_SIZE);
+  __bench_report("init, populated", 1);
+
+  if (0 != memcmp(bench_struct, bench_expected, BENCH_STRUCT_SIZE)) {
+    printf("init restored a different structure\n");
+    bad++;
+  }
+
+  __bench_start();
+  for (uint32_t i = 0; i < BENCH_READS; i++) {
+    uint32_t offset = (i % (BENCH_STRUCT_SIZE / 4U)) * 4U;
+
+    if ((ASDK_EMULATED_EEPROM_STATUS_SUCCESS !=
+         asdk_emulated_eeprom_read((uint8_t *)&value, &bench_struct[offset], bench_struct, sizeof(value))) ||
+        (0 != memcmp(&value, &bench_expected[offset], sizeof(value)))) {
+      bad++;
+    }
+  }
+  __bench_report("read 4 B", BENCH_READS);
+
+  if (0U != bench_overwrites) {
+    printf("%u words programmed twice\n", bench_overwrites);
+    bad++;
+  }
+
+  printf("%u mismatches\n", bad);
+  return (0U == bad) ? 0 : 1;
+}
+
+/*==============================================================================
+
+                            GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+int main(void) {
+  if (!host_flash_map()) {
+    printf("work flash address range is taken\n");
+    return 1;
+  }
+
+  return host_flash_run(__bench_main);
+}
@@ -0,0 +1,149 @@
+/*
+   @file
+   emulated_eeprom_migrate.c
+
+   @path
+   test/emulated_eeprom/emulated_eeprom_migrate.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Switching a device from the blocking to the journaled emulated EEPROM
+   mode: data written in the two page format must come back after the
+   journaled init, and keep coming back once the page ring takes over.
+   Runs with the valid page of the old format in Page0 and in Page1.
+*/
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "asdk_emulated_eeprom.h"
+#include "host_flash.h"
+
+#define MIGRATE_STRUCT_SIZE 256U
+
+/* one page of the old format holds about 2000 writes of 4 bytes */
+#define MIGRATE_WRITES_PAGE0 500U
+#define MIGRATE_WRITES_PAGE1 3000U
+
+#define MIGRATE_NB_WRITES 5000U
+
+static uint8_t migrate_struct[MIGRATE_STRUCT_SIZE];
+static uint8_t migrate_expected[MIGRATE_STRUCT_SIZE];
+
+static asdk_emulated_eeprom_init_deinit_config_t migrate_blocking = {
+    .flash_type_used = ASDK_EMULATED_EEPROM_INIT_FLASHTYPE_DATA_FLASH,
+    .emulated_eeprom_operation_mode = ASDK_EMULATED_EEPROM_OPERATION_BLOCKING_MODE,
+};
+
+static asdk_emulated_eeprom_init_deinit_config_t migrate_journaled = {
+    .flash_type_used = ASDK_EMULATED_EEPROM_INIT_FLASHTYPE_DATA_FLASH,
+    .emulated_eeprom_operation_mode = ASDK_EMULATED_EEPROM_OPERATION_JOURNALED_MODE,
+};
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+static void __migrate_write(uint32_t writes, uint32_t seed) {
+  for (uint32_t i = 0; i < writes; i++) {
+    uint32_t offset;
+    uint32_t value;
+
+    seed = (seed * 1103515245U) + 12345U;
+    offset = ((seed >> 16) % (MIGRATE_STRUCT_SIZE / 4U)) * 4U;
+    value = seed ^ i;
+
+    memcpy(&migrate_struct[offset], &value, sizeof(value));
+
+    while (ASDK_EMULATED_EEPROM_STATUS_BUSY ==
+           asdk_emulated_eeprom_write(&migrate_struct[offset], migrate_struct, sizeof(value), MIGRATE_STRUCT_SIZE)) {
+      asdk_emulated_eeprom_iteration();
+    }
+  }
+}
+
+/* re-init from flash into a cleared structure */
+static bool __migrate_restores(asdk_emulated_eeprom_init_deinit_config_t *config) {
+  memcpy(migrate_expected, migrate_struct, MIGRATE_STRUCT_SIZE);
+  memset(migrate_struct, 0, MIGRATE_STRUCT_SIZE);
+
+  if (ASDK_EMULATED_EEPROM_STATUS_SUCCESS != asdk_emulated_eeprom_init(config, migrate_struct, MIGRATE_STRUCT_SIZE)) {
+    return false;
+  }
+
+  return (0 == memcmp(migrate_struct, migrate_expected, MIGRATE_STRUCT_SIZE));
+}
+
+static int __migrate_run(const char *name, uint32_t writes, uint32_t legacy_base) {
+  int failed = 0;
+
+  host_flash_erase_all();
+  memset(migrate_struct, 0, MIGRATE_STRUCT_SIZE);
+
+  asdk_emulated_eeprom_init(&migrate_blocking, migrate_struct, MIGRATE_STRUCT_SIZE);
+  __migrate_write(writes, writes);
+  asdk_emulated_eeprom_deinit(&migrate_blocking);
+
+  if (VALID_PAGE != *(volatile uint32_t *)(uintptr_t)legacy_base) {
+    printf("%s: old format valid page not where expected\n", name);
+    return 1;
+  }
+
+  if (!__migrate_restores(&migrate_journaled)) {
+    printf("%s: journaled init lost the old format data\n", name);
+    failed = 1;
+  }
+
+  /* enough to go around the ring, over the old pages */
+  __migrate_write(MIGRATE_NB_WRITES, 7U);
+  while (ASDK_EMULATED_EEPROM_STATUS_SUCCESS != asdk_emulated_eeprom_iteration()) {
+  }
+
+  if (!__migrate_restores(&migrate_journaled)) {
+    printf("%s: journaled data lost after the migration\n", name);
+    failed = 1;
+  }
+
+  printf("%s: %s\n", name, failed ? "failed" : "migrated");
+  return failed;
+}
+
+static int __migrate_main(void) {
+  int failed = 0;
+
+  failed |= __migrate_run("valid Page0", MIGRATE_WRITES_PAGE0, PAGE0_BASE_ADDRESS);
+  failed |= __migrate_run("valid Page1", MIGRATE_WRITES_PAGE1, PAGE1_BASE_ADDRESS);
+
+  return failed;
+}
+
+/*==============================================================================
+
+                            GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+int main(void) {
+  if (!host_flash_map()) {
+    printf("work flash address range is taken\n");
+    return 1;
+  }
+
+  return host_flash_run(__migrate_main);
+}
@@ -0,0 +1,341 @@
+/*
+	@file
+	external_eeprom_sim.c
+
+	@path
+	test/external_eeprom/external_eeprom_sim.c
+
+	@Created on
+	Oct 17, 2026
+
+	@Author
+	Ather Energy Pvt Ltd.
+
+	@Copyright
+	Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+	@brief
+	Throughput of asdk_external_eeprom.c against a simulated I2C EEPROM, in
+	bytes/s of simulated time. The part is 24C256-like: 32 KB, 64 byte pages,
+	2 address bytes, 400 kHz bus and a 5 ms write cycle during which it NACKs
+	its address. Bus completions are delivered as the I2C interrupt would, the
+	application calls asdk_external_eeprom_iteration() at a fixed period.
+
+	Every run checks the EEPROM content and the data read back, the write
+	figures are compared against the bound set by the write cycle.
+*/
+
+/*==============================================================================
+
+							   INCLUDE FILES
+
+==============================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "asdk_external_eeprom.h"
+
+/*==============================================================================
+
+					  DEFINITIONS AND TYPES : MACROS
+
+==============================================================================*/
+
+#define SIM_MEMORY_SIZE 32768U
+#define SIM_PAGE_SIZE 64U
+#define SIM_ADDR_WIDTH 2U
+
+/* 9 clocks per byte at 400 kHz, and the write cycle */
+#define SIM_BYTE_NS 22500U
+#define SIM_START_STOP_NS 3000U
+#define SIM_WRITE_CYCLE_NS 5000000U
+
+/* give up on a run after this much simulated time */
+#define SIM_RUN_LIMIT_NS 30000000000ULL
+
+/*==============================================================================
+
+						LOCAL AND EXTERNAL DEFINITIONS
+
+==============================================================================*/
+
+static uint64_t sim_now_ns;
+static uint64_t sim_busy_until_ns; /* end of the write cycle */
+static uint8_t sim_memory[SIM_MEMORY_SIZE];
+static uint32_t sim_pointer; /* current address of the part */
+
+static asdk_i2c_callback_fun_t sim_callback;
+static asdk_i2c_status_t sim_status = ASDK_I2C_STATUS_WR_COMPLETE;
+static bool sim_pending;
+static uint64_t sim_pending_ns;
+static asdk_i2c_status_t sim_pending_status;
+static uint8_t *sim_buffer;
+static uint16_t sim_length;
+
+static uint8_t sim_tx_buffer[SIM_ADDR_WIDTH + SIM_PAGE_SIZE];
+static uint8_t sim_source[8192];
+static uint8_t sim_read[8192];
+
+static volatile uint32_t sim_done;
+static volatile uint32_t sim_errors;
+
+/*==============================================================================
+
+							LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+/* bus completion, the I2C interrupt of the device */
+static void __sim_complete(void)
+{
+	sim_pending = false;
+	sim_status = sim_pending_status;
+
+	if (ASDK_I2C_STATUS_WR_COMPLETE == sim_pending_status) {
+		sim_pointer = (((uint32_t)sim_buffer[0] << 8) | sim_buffer[1]) % SIM_MEMORY_SIZE;
+
+		/* data rolls over within the page, like the real part */
+		for (uint16_t i = SIM_ADDR_WIDTH; i < sim_length; i++) {
+			sim_memory[sim_pointer] = sim_buffer[i];
+			sim_pointer = (sim_pointer & ~(SIM_PAGE_SIZE - 1U)) | ((sim_pointer + 1U) % SIM_PAGE_SIZE);
+		}
+
+		if (sim_length > SIM_ADDR_WIDTH)
+			sim_busy_until_ns = sim_now_ns + SIM_WRITE_CYCLE_NS;
+	} else if (ASDK_I2C_STATUS_RD_COMPLETE == sim_pending_status) {
+		for (uint16_t i = 0; i < sim_length; i++) {
+			sim_buffer[i] = sim_memory[sim_pointer];
+			sim_pointer = (sim_pointer + 1U) % SIM_MEMORY_SIZE;
+		}
+	}
+
+	sim_callback(0, sim_buffer, (uint8_t)sim_length, sim_pending_status);
+}
+
+static asdk_errorcode_t __sim_start(uint8_t *buffer, uint16_t length, asdk_i2c_status_t status)
+{
+	sim_pending = true;
+	sim_status = ASDK_I2C_STATUS_BUSY;
+	sim_buffer = buffer;
+	sim_length = length;
+
+	/* write cycle in progress, the address byte is NACKed */
+	if (sim_now_ns < sim_busy_until_ns) {
+		sim_pending_ns = sim_now_ns + SIM_BYTE_NS + SIM_START_STOP_NS;
+		sim_pending_status = ASDK_I2C_STATUS_MASTER_ADDR_NACK;
+	} else {
+		sim_pending_ns = sim_now_ns + (SIM_BYTE_NS * (1U + length)) + SIM_START_STOP_NS;
+		sim_pending_status = status;
+	}
+
+	return ASDK_I2C_STATUS_SUCCESS;
+}
+
+/* moves the simulated time, delivering the bus completions on the way */
+static void __sim_advance(uint64_t ns)
+{
+	uint64_t end_ns = sim_now_ns + ns;
+
+	while (sim_pending && (sim_pending_ns <= end_ns)) {
+		sim_now_ns = sim_pending_ns;
+		__sim_complete();
+	}
+
+	sim_now_ns = end_ns;
+}
+
+static void __sim_done_callback(uint8_t eeprom_index, asdk_external_eeprom_status_t status, uint32_t eeprom_addr,
+								void *buff, uint32_t length)
+{
+	(void)eeprom_index;
+	(void)eeprom_addr;
+	(void)buff;
+	(void)length;
+
+	sim_done++;
+
+	if (ASDK_EXTERNAL_EEPROM_STATUS_ERROR == status)
+		sim_errors++;
+}
+
+static void __sim_user_callback(asdk_external_eeprom_status_t status)
+{
+	(void)status;
+}
+
+/* one run of count transactions of length bytes, returns the bytes/s */
+static double __sim_run(bool is_read, uint32_t address, uint32_t length, uint32_t count, uint64_t period_ns)
+{
+	asdk_external_eeprom_stats_t before;
+	asdk_external_eeprom_stats_t stats;
+	uint32_t submitted = 0;
+	uint64_t start_ns = sim_now_ns;
+	uint64_t elapsed_ns;
+	asdk_errorcode_t ret;
+	double rate;
+
+	sim_done = 0;
+	sim_errors = 0;
+	asdk_external_eeprom_get_stats(0, &before);
+
+	while ((sim_done < count) && ((sim_now_ns - start_ns) < SIM_RUN_LIMIT_NS)) {
+		while (submitted < count) {
+			uint32_t offset = submitted * length;
+
+			if (is_read)
+				ret = asdk_external_eeprom_queue_read(0, address + offset, &sim_read[offset], length,
+													  __sim_done_callback);
+			else
+				ret = asdk_external_eeprom_queue_write(0, address + offset, &sim_source[offset], length,
+													   __sim_done_callback);
+
+			if (ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS != ret)
+				break;
+
+			submitted++;
+		}
+
+		asdk_external_eeprom_iteration(0);
+		__sim_advance(period_ns);
+	}
+
+	elapsed_ns = sim_now_ns - start_ns;
+	rate = (double)(length * count) * 1e9 / (double)elapsed_ns;
+	asdk_external_eeprom_get_stats(0, &stats);
+
+	printf("  %-5s %5u B in %u txn, iteration every %5u us: %8.1f ms, %6.0f B/s, ack polls %u, errors %u%s\n",
+		   is_read ? "read" : "write", length * count, count, (uint32_t)(period_ns / 1000U), (double)elapsed_ns / 1e6,
+		   rate, stats.ack_polls - before.ack_polls, sim_errors, (sim_done < count) ? ", stalled" : "");
+
+	/* let the last write cycle end */
+	__sim_advance(SIM_WRITE_CYCLE_NS);
+
+	return ((sim_done == count) && (0U == sim_errors)) ? rate : 0.0;
+}
+
+/*!
+ * @brief Best case write rate: every page is sent once, right as the previous write cycle
+ * ends. The transaction completes when its last page left the bus, before that page's cycle.
+ */
+static double __sim_write_bound(uint32_t address, uint32_t length)
+{
+	uint32_t pages = ((address + length - 1U) / SIM_PAGE_SIZE) - (address / SIM_PAGE_SIZE) + 1U;
+	double bus_ns = ((double)pages * ((SIM_BYTE_NS * (1U + SIM_ADDR_WIDTH)) + SIM_START_STOP_NS)) +
+					((double)length * SIM_BYTE_NS);
+
+	return (double)length * 1e9 / (bus_ns + ((double)(pages - 1U) * SIM_WRITE_CYCLE_NS));
+}
+
+/*==============================================================================
+
+							GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+asdk_errorcode_t asdk_i2c_init(asdk_i2c_config_t *i2c_config_data)
+{
+	(void)i2c_config_data;
+
+	return ASDK_I2C_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_i2c_install_callback(asdk_i2c_num_t i2c_no, asdk_i2c_callback_fun_t callback_fun)
+{
+	(void)i2c_no;
+
+	sim_callback = callback_fun;
+	return ASDK_I2C_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_i2c_master_write_non_blocking(asdk_i2c_num_t i2c_no, uint8_t slave_addr, uint8_t *send_buf,
+													 uint16_t length)
+{
+	(void)i2c_no;
+	(void)slave_addr;
+
+	if (sim_pending)
+		return ASDK_I2C_ERROR_WRITE_FAIL;
+
+	return __sim_start(send_buf, length, ASDK_I2C_STATUS_WR_COMPLETE);
+}
+
+asdk_errorcode_t asdk_i2c_master_read_non_blocking(asdk_i2c_num_t i2c_no, uint8_t slave_addr, uint8_t *recv_buf,
+													uint16_t length)
+{
+	(void)i2c_no;
+	(void)slave_addr;
+
+	if (sim_pending)
+		return ASDK_I2C_ERROR_READ_FAIL;
+
+	return __sim_start(recv_buf, length, ASDK_I2C_STATUS_RD_COMPLETE);
+}
+
+asdk_errorcode_t asdk_i2c_get_transfer_status(asdk_i2c_num_t i2c_no, asdk_i2c_status_t *i2c_status)
+{
+	(void)i2c_no;
+
+	*i2c_status = sim_status;
+	return ASDK_I2C_STATUS_SUCCESS;
+}
+
+int64_t asdk_sys_get_time_ms(void)
+{
+	return (int64_t)(sim_now_ns / 1000000U);
+}
+
+int main(void)
+{
+	asdk_external_eeprom_config_t config = {
+		.memory_size_bytes = SIM_MEMORY_SIZE,
+		.page_size_bytes = SIM_PAGE_SIZE,
+		.addr_width = SIM_ADDR_WIDTH,
+		.tx_buffer = sim_tx_buffer,
+		.tx_buffer_size = sizeof(sim_tx_buffer),
+		.protocol = ASDK_EXTERNAL_EEPROM_PROTOCOL_I2C,
+		.eeprom_user_callback = __sim_user_callback,
+	};
+	static const uint64_t periods_ns[] = {100000U, 1000000U, 10000000U};
+	/* 4096 B from address 37 is 65 pages: 27 B, 63 full pages and 37 B */
+	double write_bound = __sim_write_bound(37, 4096);
+	int failed = 0;
+
+	srand(1);
+	for (uint32_t i = 0; i < sizeof(sim_source); i++)
+		sim_source[i] = (uint8_t)rand();
+
+	if (ASDK_MW_EXTERNAL_EEPROM_STATUS_SUCCESS != asdk_external_eeprom_init(0, &config)) {
+		printf("init failed\n");
+		return 1;
+	}
+
+	printf("24C256-like part, 400 kHz, 5 ms write cycle, write bound %.0f B/s\n", write_bound);
+
+	for (uint32_t p = 0; p < (sizeof(periods_ns) / sizeof(periods_ns[0])); p++) {
+		double rate;
+
+		memset(sim_memory, 0xFF, sizeof(sim_memory));
+		memset(sim_read, 0, sizeof(sim_read));
+
+		/* unaligned start, the transaction is split at every page boundary */
+		rate = __sim_run(false, 37, 4096, 1, periods_ns[p]);
+		failed |= (rate <= 0.0) || (0 != memcmp(&sim_memory[37], sim_source, 4096));
+
+		/* the write cycle is the limit, as long as the iteration keeps up with it */
+		if ((periods_ns[p] < SIM_WRITE_CYCLE_NS) && (rate < (0.9 * write_bound))) {
+			printf("  write below 90%% of the bound\n");
+			failed = 1;
+		}
+
+		failed |= (__sim_run(true, 37, 4096, 1, periods_ns[p]) <= 0.0) || (0 != memcmp(sim_read, sim_source, 4096));
+
+		/* queued transactions, the next one starts from the interrupt */
+		failed |= (__sim_run(false, 5000, 256, 8, periods_ns[p]) <= 0.0) ||
+				  (0 != memcmp(&sim_memory[5000], sim_source, 2048));
+	}
+
+	printf("%s\n", failed ? "failed" : "data verified");
+	return failed;
+}
@@ -0,0 +1,214 @@
+/*
+   @file
+   ring_buffer_stress.c
+
+   @path
+   test/ring_buffer/ring_buffer_stress.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Host stress test of the ring buffer: a producer and a consumer thread
+   move a numbered sequence through the buffer in random batch sizes and
+   the consumer checks that nothing is lost, repeated or torn. Covers the
+   copying and the in-place API of the SPSC mode and the locked mode.
+*/
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ring_buffer.h"
+
+/* blocks moved per scenario */
+#define STRESS_BLOCKS 1000000U
+
+/* 4 words per block, derived from the sequence number */
+#define STRESS_WORDS 4U
+
+#define STRESS_MAX_BATCH 5U
+
+typedef struct {
+  ring_buffer_t *ring;
+  bool in_place;
+  unsigned int seed;
+  uint32_t errors;
+} stress_ctx_t;
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+static void __stress_fill(uint32_t *block, uint32_t seq) {
+  block[0] = seq;
+  block[1] = ~seq;
+  block[2] = seq * 2654435761U;
+  block[3] = seq ^ 0xA5A5A5A5U;
+}
+
+static bool __stress_check(const uint32_t *block, uint32_t seq) {
+  uint32_t expected[STRESS_WORDS];
+
+  __stress_fill(expected, seq);
+  return (0 == memcmp(block, expected, sizeof(expected)));
+}
+
+static void *__stress_producer(void *arg) {
+  stress_ctx_t *ctx = arg;
+  uint32_t blocks[STRESS_MAX_BATCH][STRESS_WORDS];
+  uint32_t *slot;
+  size_t batch;
+  size_t done;
+  uint32_t seq = 0;
+
+  while (seq < STRESS_BLOCKS) {
+    batch = 1U + ((size_t)rand_r(&ctx->seed) % STRESS_MAX_BATCH);
+
+    if (batch > (STRESS_BLOCKS - seq)) {
+      batch = STRESS_BLOCKS - seq;
+    }
+
+    if (ctx->in_place) {
+      slot = ring_buffer_claim_write(ctx->ring, &batch);
+
+      if (NULL == slot) {
+        sched_yield();
+        continue;
+      }
+
+      for (size_t i = 0; i < batch; i++) {
+        __stress_fill(&slot[i * STRESS_WORDS], seq + (uint32_t)i);
+      }
+
+      done = ring_buffer_commit_write(ctx->ring, batch);
+    } else {
+      for (size_t i = 0; i < batch; i++) {
+        __stress_fill(blocks[i], seq + (uint32_t)i);
+      }
+
+      done = ring_buffer_write(ctx->ring, blocks, batch);
+    }
+
+    if (0U == done) {
+      sched_yield();
+    }
+
+    seq += (uint32_t)done;
+  }
+
+  return NULL;
+}
+
+static void __stress_consumer(stress_ctx_t *ctx) {
+  uint32_t blocks[STRESS_MAX_BATCH][STRESS_WORDS];
+  uint32_t *slot;
+  size_t batch;
+  size_t done;
+  uint32_t seq = 0;
+
+  while (seq < STRESS_BLOCKS) {
+    batch = 1U + ((size_t)rand_r(&ctx->seed) % STRESS_MAX_BATCH);
+
+    if (ctx->in_place) {
+      slot = ring_buffer_claim_read(ctx->ring, &batch);
+      done = 0;
+
+      if (NULL != slot) {
+        for (size_t i = 0; i < batch; i++) {
+          if (!__stress_check(&slot[i * STRESS_WORDS], seq + (uint32_t)i)) {
+            ctx->errors++;
+          }
+        }
+
+        done = ring_buffer_release_read(ctx->ring, batch);
+      }
+    } else {
+      done = ring_buffer_read(ctx->ring, blocks, batch);
+
+      for (size_t i = 0; i < done; i++) {
+        if (!__stress_check(blocks[i], seq + (uint32_t)i)) {
+          ctx->errors++;
+        }
+      }
+    }
+
+    if (0U == done) {
+      sched_yield();
+    }
+
+    seq += (uint32_t)done;
+  }
+}
+
+static int __stress_run(const char *name, ring_buffer_mode_t mode, bool in_place) {
+  static uint32_t memory[16][STRESS_WORDS];
+  ring_buffer_t ring = {
+      .buffer = memory,
+      .total_capacity = sizeof(memory),
+      .block_size = sizeof(memory[0]),
+      .mode = mode,
+  };
+  stress_ctx_t producer = {.ring = &ring, .in_place = in_place, .seed = 1U};
+  stress_ctx_t consumer = {.ring = &ring, .in_place = in_place, .seed = 2U};
+  pthread_t thread;
+
+  if (RING_BUFFER_SUCCESS != ring_buffer_init(&ring)) {
+    printf("%-16s init failed\n", name);
+    return 1;
+  }
+
+  pthread_create(&thread, NULL, __stress_producer, &producer);
+  __stress_consumer(&consumer);
+  pthread_join(thread, NULL);
+
+  printf("%-16s %u blocks, %u bad, empty %d\n", name, STRESS_BLOCKS, consumer.errors,
+         ring_buffer_is_empty(&ring));
+
+  return ((0U == consumer.errors) && ring_buffer_is_empty(&ring)) ? 0 : 1;
+}
+
+/*==============================================================================
+
+                            GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+int main(void) {
+  uint8_t odd[10];
+  ring_buffer_t odd_ring = {
+      .buffer = odd,
+      .total_capacity = sizeof(odd),
+      .block_size = 1,
+      .mode = RING_BUFFER_MODE_SPSC,
+  };
+  int failed = 0;
+
+  failed |= __stress_run("spsc copy", RING_BUFFER_MODE_SPSC, false);
+  failed |= __stress_run("spsc in place", RING_BUFFER_MODE_SPSC, true);
+  failed |= __stress_run("locked copy", RING_BUFFER_MODE_LOCKED, false);
+
+  /* the SPSC indices are masked, other sizes must be refused */
+  if (RING_BUFFER_ERROR_INVALID_LEN != ring_buffer_init(&odd_ring)) {
+    printf("spsc accepted a capacity of %zu\n", sizeof(odd));
+    failed = 1;
+  }
+
+  return failed;
+}
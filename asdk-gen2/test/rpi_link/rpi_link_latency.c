@@ -0,0 +1,393 @@
+/*
+   @file
+   rpi_link_latency.c
+
+   @path
+   test/rpi_link/rpi_link_latency.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Frame latency of the RPi link over a pty pair. A writer thread sends COBS
+   frames into the master side at 1 to 3 ms intervals, like the RPi. The
+   slave side feeds app_rpi.c through an emulation of the UART DMA mode: a
+   report when half of the circular buffer is filled, and on
+   asdk_uart_dma_rx_idle_check() once no byte arrived since the previous
+   check. Like the scheduler, the main loop runs app_rpi_idle_check() every
+   1 ms tick and app_rpi_iteration() only on RPI_RX_EVENT.
+
+   The latency is from writing a frame to the frame handler seeing it. All
+   frames must arrive with valid CRCs, the median within a few ticks.
+*/
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/* the decoder and its statistics are static */
+#include "app_rpi.c"
+
+/*==============================================================================
+
+                      DEFINITIONS AND TYPES : MACROS
+
+==============================================================================*/
+
+#define LINK_FRAMES 1000U
+#define LINK_PAYLOAD_SIZE 17U
+
+#define LINK_TICK_NS 1000000U
+#define LINK_RUN_LIMIT_NS 20000000000ULL
+
+/* idle detection takes up to two ticks, leave room for the host scheduler */
+#define LINK_MEDIAN_LIMIT_US 5000.0
+
+/*==============================================================================
+
+                        LOCAL AND EXTERNAL DEFINITIONS
+
+==============================================================================*/
+
+static int link_master;
+static int link_slave;
+static volatile bool link_stop;
+
+static uint64_t link_sent_ns[LINK_FRAMES];
+static double link_latency_us[LINK_FRAMES];
+
+/* emulated DMA of the RPi UART, shared with its "interrupt" thread */
+static asdk_uart_config_t *link_uart;
+static asdk_uart_callback_fun_t link_callback;
+static uint32_t link_dma_pos;
+static uint32_t link_dma_read;
+static uint32_t link_dma_last_pos;
+
+static pthread_mutex_t link_event_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t link_event_cond;
+static uint32_t link_events;
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+static uint64_t __link_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/* same as the DAL, in two calls when wrapping around the buffer end */
+static void __link_dma_report(uint32_t pos)
+{
+    uint8_t *buffer = link_uart->uart_dma_config.uart_rx_data_buffer;
+    uint32_t len = link_uart->uart_dma_config.uart_rx_data_len_bytes;
+
+    if (pos < link_dma_read)
+    {
+        link_callback(link_uart->uart_no, &buffer[link_dma_read], len - link_dma_read, ASDK_UART_STATUS_RECEIVE_COMPLETE);
+        link_dma_read = 0;
+    }
+
+    if (pos > link_dma_read)
+    {
+        link_callback(link_uart->uart_no, &buffer[link_dma_read], pos - link_dma_read, ASDK_UART_STATUS_RECEIVE_COMPLETE);
+        link_dma_read = pos;
+    }
+}
+
+/* the DMA channel and its half complete interrupt */
+static void *__link_dma_thread(void *arg)
+{
+    uint8_t *buffer = link_uart->uart_dma_config.uart_rx_data_buffer;
+    uint32_t len = link_uart->uart_dma_config.uart_rx_data_len_bytes;
+    struct pollfd slave = {.fd = link_slave, .events = POLLIN};
+    uint32_t half_end;
+    ssize_t received;
+
+    (void)arg;
+
+    while (!link_stop)
+    {
+        if (0 >= poll(&slave, 1, 1))
+        {
+            continue;
+        }
+
+        __disable_irq();
+
+        half_end = (link_dma_pos < (len / 2U)) ? (len / 2U) : len;
+        received = read(link_slave, &buffer[link_dma_pos], half_end - link_dma_pos);
+
+        if (0 < received)
+        {
+            link_dma_pos += (uint32_t)received;
+
+            if (half_end == link_dma_pos)
+            {
+                link_dma_pos %= len;
+                __link_dma_report(link_dma_pos);
+            }
+        }
+
+        __enable_irq();
+    }
+
+    return NULL;
+}
+
+/* the RPi, frame i carries i in its first two bytes */
+static void *__link_writer_thread(void *arg)
+{
+    uint8_t payload[LINK_PAYLOAD_SIZE];
+    uint8_t frame[COBS_FRAME_ENCODED_SIZE(LINK_PAYLOAD_SIZE)];
+    size_t frame_len;
+
+    (void)arg;
+
+    for (uint32_t i = 0; i < LINK_FRAMES; i++)
+    {
+        for (uint32_t j = 0; j < LINK_PAYLOAD_SIZE; j++)
+        {
+            payload[j] = (uint8_t)(i + (j * 31U));
+        }
+        payload[0] = (uint8_t)i;
+        payload[1] = (uint8_t)(i >> 8);
+
+        frame_len = cobs_frame_encode(payload, sizeof(payload), frame, sizeof(frame));
+
+        link_sent_ns[i] = __link_now_ns();
+        if ((ssize_t)frame_len != write(link_master, frame, frame_len))
+        {
+            break;
+        }
+
+        usleep(1000U + ((uint32_t)rand() % 2000U));
+    }
+
+    return NULL;
+}
+
+static bool __link_open(void)
+{
+    struct termios tio;
+
+    link_master = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if ((0 > link_master) || (0 != grantpt(link_master)) || (0 != unlockpt(link_master)))
+    {
+        return false;
+    }
+
+    link_slave = open(ptsname(link_master), O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+    if (0 > link_slave)
+    {
+        return false;
+    }
+
+    /* bytes pass unchanged, like the UART */
+    tcgetattr(link_slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(link_slave, TCSANOW, &tio);
+
+    return true;
+}
+
+static int __link_compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x < y) ? -1 : (x > y);
+}
+
+/*==============================================================================
+
+                            GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+asdk_errorcode_t asdk_uart_init(asdk_uart_config_t *uart_config)
+{
+    link_uart = uart_config;
+    link_dma_pos = 0;
+    link_dma_read = 0;
+    link_dma_last_pos = 0;
+
+    return ASDK_UART_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_uart_install_callback(asdk_uart_num_t uart_no, asdk_uart_callback_fun_t callback_fun)
+{
+    (void)uart_no;
+
+    link_callback = callback_fun;
+    return ASDK_UART_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_uart_dma_rx_idle_check(asdk_uart_num_t uart_no)
+{
+    (void)uart_no;
+
+    __disable_irq();
+
+    if ((link_dma_pos == link_dma_last_pos) && (link_dma_pos != link_dma_read))
+    {
+        __link_dma_report(link_dma_pos);
+    }
+
+    link_dma_last_pos = link_dma_pos;
+
+    __enable_irq();
+
+    return ASDK_UART_STATUS_SUCCESS;
+}
+
+void _putchar(char character)
+{
+    putchar(character);
+}
+
+void scheduler_post_event(uint32_t events)
+{
+    pthread_mutex_lock(&link_event_lock);
+    link_events |= events;
+    pthread_cond_signal(&link_event_cond);
+    pthread_mutex_unlock(&link_event_lock);
+}
+
+int main(void)
+{
+    pthread_condattr_t cond_attr;
+    pthread_t dma_thread;
+    pthread_t writer_thread;
+    struct timespec deadline;
+    uint64_t start_ns;
+    uint64_t next_tick_ns;
+    uint32_t received = 0;
+    uint32_t events;
+    uint32_t median_index;
+    double median_us;
+    int failed = 0;
+
+    if (!__link_open())
+    {
+        printf("no pty pair\n");
+        return 1;
+    }
+
+    /* the 1 ms tick is on the monotonic clock */
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&link_event_cond, &cond_attr);
+
+    app_rpi_init();
+
+    srand(1);
+    pthread_create(&dma_thread, NULL, __link_dma_thread, NULL);
+    pthread_create(&writer_thread, NULL, __link_writer_thread, NULL);
+
+    start_ns = __link_now_ns();
+    next_tick_ns = start_ns + LINK_TICK_NS;
+
+    while ((received < LINK_FRAMES) && ((__link_now_ns() - start_ns) < LINK_RUN_LIMIT_NS))
+    {
+        deadline.tv_sec = (time_t)(next_tick_ns / 1000000000U);
+        deadline.tv_nsec = (long)(next_tick_ns % 1000000000U);
+
+        /* sleeps until the tick or RPI_RX_EVENT */
+        pthread_mutex_lock(&link_event_lock);
+        while ((0U == (link_events & RPI_RX_EVENT)) &&
+               (0 == pthread_cond_timedwait(&link_event_cond, &link_event_lock, &deadline)))
+        {
+        }
+        events = link_events;
+        link_events = 0;
+        pthread_mutex_unlock(&link_event_lock);
+
+        if (__link_now_ns() >= next_tick_ns)
+        {
+            next_tick_ns += LINK_TICK_NS;
+
+            /* task_1ms, a report of the idle check posts RPI_RX_EVENT */
+            app_rpi_idle_check();
+        }
+
+        if (0U == (events & RPI_RX_EVENT))
+        {
+            continue;
+        }
+
+        app_rpi_iteration();
+
+        /* frames come in order, the handler leaves the sequence in pi_data */
+        while ((received < __rpi_decoder.frames) && (received < LINK_FRAMES))
+        {
+            link_latency_us[received] = (double)(__link_now_ns() - link_sent_ns[received]) / 1e3;
+            received++;
+        }
+
+        if ((0U < received) && ((uint8_t)(received - 1U) != pi_data))
+        {
+            printf("frame %u out of order\n", received - 1U);
+            failed = 1;
+        }
+    }
+
+    link_stop = true;
+    pthread_join(writer_thread, NULL);
+    pthread_join(dma_thread, NULL);
+
+    if (0U == received)
+    {
+        printf("no frames received\n");
+        return 1;
+    }
+
+    qsort(link_latency_us, received, sizeof(link_latency_us[0]), __link_compare);
+    median_index = received / 2U;
+    median_us = link_latency_us[median_index];
+
+    printf("%u/%u frames, latency us p50 %.0f p99 %.0f max %.0f, crc errors %u, framing errors %u, dropped %u\n",
+           received, LINK_FRAMES, median_us, link_latency_us[(received * 99U) / 100U], link_latency_us[received - 1U],
+           __rpi_decoder.crc_errors, __rpi_decoder.framing_errors, __rpi_rx_dropped);
+
+    /* the first delimiter closes the empty frame before it */
+    if ((LINK_FRAMES != received) || (0U != __rpi_decoder.crc_errors) || (1U < __rpi_decoder.framing_errors) ||
+        (0U != __rpi_rx_dropped))
+    {
+        failed = 1;
+    }
+
+    if (LINK_MEDIAN_LIMIT_US < median_us)
+    {
+        printf("median above %.0f us\n", LINK_MEDIAN_LIMIT_US);
+        failed = 1;
+    }
+
+    return failed;
+}
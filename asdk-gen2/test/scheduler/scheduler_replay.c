@@ -0,0 +1,258 @@
+/*
+   @file
+   scheduler_replay.c
+
+   @path
+   test/scheduler/scheduler_replay.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Host replay of the scheduler against a synthetic time base. Time only
+   moves when a task spends it or the loop sleeps, the 1 ms tick and an
+   event interrupt are posted when the clock crosses their times. One
+   task has a single run longer than two periods, the replay checks the
+   statistics and that the deadline mode stays on the period grid where
+   the relative mode drifts.
+*/
+
+/*==============================================================================
+
+                               INCLUDE FILES
+
+==============================================================================*/
+
+#include <stdarg.h>
+#include <stdio.h>
+
+/* sleeping jumps the time base to the next interrupt */
+static void __replay_idle(void);
+#define SCHEDULER_IDLE() __replay_idle()
+
+#include "scheduler.c"
+
+/*==============================================================================
+
+                      DEFINITIONS AND TYPES : MACROS
+
+==============================================================================*/
+
+#define REPLAY_DURATION_MS 1000U
+
+#define REPLAY_EVENT SCHEDULER_EVENT(1)
+#define REPLAY_EVENT_PERIOD_US 7300U
+
+/* cost of the task runs in microseconds */
+#define REPLAY_FAST_COST_US 200U
+#define REPLAY_LATE_COST_US 12000U /* more than two 5 ms periods */
+#define REPLAY_LATE_RUN 3U
+#define REPLAY_SLOW_COST_US 50U
+#define REPLAY_EVENT_COST_US 20U
+
+/*==============================================================================
+
+                        LOCAL AND EXTERNAL DEFINITIONS
+
+==============================================================================*/
+
+static uint64_t replay_now_us = 0;
+static uint64_t replay_next_tick_us = 0;
+static uint64_t replay_next_event_us = 0;
+static uint32_t replay_fast_runs = 0;
+
+static void __replay_fast_task(void);
+static void __replay_slow_task(void);
+static void __replay_event_task(void);
+
+static scheduler_t replay_tasks[3];
+
+static const scheduler_t replay_template[3] = {
+    {.task_fn = __replay_fast_task, .periodicty = 5},
+    {.task_fn = __replay_slow_task, .periodicty = 10},
+    {.task_fn = __replay_event_task, .periodicty = 0, .events = REPLAY_EVENT},
+};
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+/* moves the time base, posting the interrupts that fall in between */
+static void __replay_advance(uint64_t us)
+{
+    uint64_t end_us = replay_now_us + us;
+
+    while ((replay_next_tick_us <= end_us) || (replay_next_event_us <= end_us))
+    {
+        if (replay_next_tick_us <= replay_next_event_us)
+        {
+            replay_now_us = replay_next_tick_us;
+            replay_next_tick_us += SCHEDULER_TIMER_PERIOD;
+            scheduler_tick();
+        }
+        else
+        {
+            replay_now_us = replay_next_event_us;
+            replay_next_event_us += REPLAY_EVENT_PERIOD_US;
+            scheduler_post_event(REPLAY_EVENT);
+        }
+    }
+
+    replay_now_us = end_us;
+}
+
+static void __replay_idle(void)
+{
+    uint64_t next_us = (replay_next_tick_us < replay_next_event_us) ? replay_next_tick_us : replay_next_event_us;
+
+    __replay_advance(next_us - replay_now_us);
+}
+
+static void __replay_fast_task(void)
+{
+    replay_fast_runs++;
+    __replay_advance((REPLAY_LATE_RUN == replay_fast_runs) ? REPLAY_LATE_COST_US : REPLAY_FAST_COST_US);
+}
+
+static void __replay_slow_task(void)
+{
+    __replay_advance(REPLAY_SLOW_COST_US);
+}
+
+static void __replay_event_task(void)
+{
+    __replay_advance(REPLAY_EVENT_COST_US);
+}
+
+static int __replay_check(bool ok, const char *what)
+{
+    if (!ok)
+    {
+        printf("  FAIL: %s\n", what);
+    }
+
+    return ok ? 0 : 1;
+}
+
+static int __replay_run(scheduler_mode_t mode)
+{
+    scheduler_stats_t fast;
+    scheduler_stats_t slow;
+    scheduler_latency_t latency;
+    uint64_t end_us;
+    int failed = 0;
+
+    memcpy(replay_tasks, replay_template, sizeof(replay_tasks));
+    replay_fast_runs = 0;
+    pending_events = 0;
+    replay_next_tick_us = replay_now_us + SCHEDULER_TIMER_PERIOD;
+    replay_next_event_us = replay_now_us + REPLAY_EVENT_PERIOD_US;
+    end_us = replay_now_us + ((uint64_t)REPLAY_DURATION_MS * SCHEDULER_TIMER_PERIOD);
+
+    scheduler_set_mode(mode);
+    scheduler_init(replay_tasks, 3);
+    scheduler_reset_stats();
+
+    while (replay_now_us < end_us)
+    {
+        scheduler_iteration();
+    }
+
+    printf("%s mode, fast task last release %lu ms\n", (SCHEDULER_MODE_DEADLINE == mode) ? "deadline" : "relative",
+           (unsigned long)replay_tasks[0].last_tick);
+    scheduler_print_stats();
+
+    scheduler_get_stats(0, &fast);
+    scheduler_get_stats(1, &slow);
+    scheduler_get_latency(&latency);
+
+    failed |= __replay_check(1U == fast.overrun_count, "one overrun of the late run");
+    failed |= __replay_check(REPLAY_LATE_COST_US == fast.exec_max_cycles, "exec max is the late run");
+    failed |= __replay_check(REPLAY_FAST_COST_US == fast.exec_min_cycles, "exec min is a normal run");
+    failed |= __replay_check(0U < fast.skipped_count, "releases skipped behind the late run");
+    failed |= __replay_check(0U == slow.overrun_count, "no overrun of the slow task");
+    failed |= __replay_check(REPLAY_FAST_COST_US <= slow.jitter_max_cycles, "slow task waits for the fast one");
+    failed |= __replay_check(0U < latency.count, "events picked up");
+    failed |= __replay_check(REPLAY_LATE_COST_US + REPLAY_SLOW_COST_US >= latency.max_cycles,
+                             "event latency bounded by the longest run");
+
+    if (SCHEDULER_MODE_DEADLINE == mode)
+    {
+        // every release up to the last tick is either served or skipped
+        failed |= __replay_check(0U == (replay_tasks[0].last_tick % replay_tasks[0].periodicty),
+                                 "releases stay on the period grid");
+        failed |= __replay_check((REPLAY_DURATION_MS / replay_tasks[0].periodicty) ==
+                                     (fast.run_count + fast.skipped_count),
+                                 "no release lost");
+        failed |= __replay_check(replay_tasks[0].periodicty * cycles_per_ms > fast.jitter_max_cycles,
+                                 "jitter below a period");
+    }
+    else
+    {
+        // releases counted from the late run, the grid is lost
+        failed |= __replay_check(0U != (replay_tasks[0].last_tick % replay_tasks[0].periodicty),
+                                 "releases drift after the late run");
+        failed |= __replay_check((REPLAY_DURATION_MS / replay_tasks[0].periodicty) >
+                                     (fast.run_count + fast.skipped_count),
+                                 "drift loses releases");
+    }
+
+    return failed;
+}
+
+/*==============================================================================
+
+                            GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+uint64_t asdk_sys_get_time_us(void)
+{
+    return replay_now_us;
+}
+
+asdk_errorcode_t asdk_timer_init(asdk_timer_channel_t timer_ch, asdk_timer_t *timer_config)
+{
+    (void)timer_ch;
+    (void)timer_config;
+
+    return ASDK_TIMER_SUCCESS;
+}
+
+asdk_errorcode_t asdk_timer_start(asdk_timer_channel_t timer_ch)
+{
+    (void)timer_ch;
+
+    return ASDK_TIMER_SUCCESS;
+}
+
+/* scheduler_print_stats() goes to the debug UART */
+int debug_uart_printf(const char *format, ...)
+{
+    va_list va;
+    int ret;
+
+    va_start(va, format);
+    ret = vprintf(format, va);
+    va_end(va);
+
+    return ret;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    failed |= __replay_run(SCHEDULER_MODE_RELATIVE);
+    failed |= __replay_run(SCHEDULER_MODE_DEADLINE);
+
+    return failed;
+}
@@ -0,0 +1,43 @@
+/*
+   @file
+   cy_device_headers.h
+
+   @path
+   test/stubs/cy_device_headers.h
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Host stand-in for the device header, so the DAL asdk_platform.h can be
+   used as is. Only the core intrinsics are provided, tests that need
+   peripheral registers put their own header in front of this one.
+*/
+
+#ifndef CY_DEVICE_HEADERS_H
+#define CY_DEVICE_HEADERS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define __ASM __asm__
+
+#define __DMB() __sync_synchronize()
+#define __DSB() __sync_synchronize()
+#define __ISB() __sync_synchronize()
+#define __WFI()
+
+/* PRIMASK of the simulated core, see host_critical.c */
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void __disable_irq(void);
+void __enable_irq(void);
+
+#endif /* CY_DEVICE_HEADERS_H */
@@ -0,0 +1,45 @@
+/*
+   @file
+   cy_flash.h
+
+   @path
+   test/stubs/flash/cy_flash.h
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Host stand-in of the PDL flash driver header, only the blank check used by
+   the DAL. Implemented over the RAM-backed work flash of host_flash.c.
+*/
+
+#ifndef CY_FLASH_H
+#define CY_FLASH_H
+
+#include "cy_device_headers.h"
+
+typedef enum {
+  CY_FLASH_DRV_SUCCESS = 0,
+  CY_FLASH_DRV_FLASH_NOT_ERASED = 5,
+} cy_en_flashdrv_status_t;
+
+typedef enum {
+  CY_FLASH_ERASESECTOR_NON_BLOCKING = 0,
+  CY_FLASH_ERASESECTOR_BLOCKING,
+} cy_en_flash_driver_blocking_t;
+
+typedef struct {
+  uint32_t *addrToBeChecked;
+  uint32_t numOfWordsToBeChecked;
+} cy_stc_flash_blankcheck_config_t;
+
+cy_en_flashdrv_status_t Cy_Flash_BlankCheck(void *context, const cy_stc_flash_blankcheck_config_t *config,
+                                            cy_en_flash_driver_blocking_t block);
+
+#endif /* CY_FLASH_H */
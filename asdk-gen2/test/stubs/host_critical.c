@@ -0,0 +1,60 @@
+/*
+   @file
+   host_critical.c
+
+   @path
+   test/stubs/host_critical.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Interrupt masking of the host stubs. Masking takes one global mutex, so
+   code that relies on critical sections stays correct when the tests run
+   it from several threads.
+*/
+
+#include <pthread.h>
+
+#include "asdk_platform.h"
+
+static pthread_mutex_t host_critical_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* PRIMASK of the calling thread, interrupts are masked while it is 1 */
+static __thread uint32_t host_primask;
+
+uint32_t __get_PRIMASK(void) {
+  return host_primask;
+}
+
+void __set_PRIMASK(uint32_t primask) {
+  if (primask && !host_primask) {
+    pthread_mutex_lock(&host_critical_lock);
+  } else if (!primask && host_primask) {
+    pthread_mutex_unlock(&host_critical_lock);
+  }
+
+  host_primask = primask ? 1U : 0U;
+}
+
+void __disable_irq(void) {
+  __set_PRIMASK(1U);
+}
+
+void __enable_irq(void) {
+  __set_PRIMASK(0U);
+}
+
+void asdk_sys_disable_interrupts(void) {
+  __disable_irq();
+}
+
+void asdk_sys_enable_interrupts(void) {
+  __enable_irq();
+}
@@ -0,0 +1,260 @@
+/*
+   @file
+   host_flash.c
+
+   @path
+   test/stubs/host_flash.c
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   RAM-backed work flash for the host tests, see host_flash.h.
+*/
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "flash/cy_flash.h"
+#include "host_flash.h"
+
+#define HOST_FLASH_STACK_SIZE (1U << 20)
+
+typedef struct {
+  int (*fn)(void);
+  int result;
+} host_flash_job_t;
+
+uint32_t host_flash_latency_polls = 1;
+
+static host_flash_stats_t host_flash_stats;
+
+static bool host_flash_pending;
+static uint32_t host_flash_polls;
+static uint32_t host_flash_pending_addr;
+static uint32_t host_flash_pending_word;
+static bool host_flash_pending_erase;
+
+/*==============================================================================
+
+                            LOCAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+static bool __host_flash_in_range(uint32_t address, uint32_t size) {
+  return (address >= HOST_FLASH_BASE) && (size <= HOST_FLASH_SIZE) &&
+         ((address - HOST_FLASH_BASE) <= (HOST_FLASH_SIZE - size));
+}
+
+static void __host_flash_program(uint32_t address, const uint8_t *data, uint32_t size) {
+  uint8_t *flash = (uint8_t *)(uintptr_t)address;
+
+  for (uint32_t i = 0; i < size; i++) {
+    if ((0 == ((address + i) % 4U)) && (0xFFFFFFFFU != *(uint32_t *)(uintptr_t)((address + i) & ~3U))) {
+      host_flash_stats.overwrites++;
+    }
+
+    flash[i] &= data[i];
+  }
+
+  host_flash_stats.program_ops++;
+  host_flash_stats.program_bytes += size;
+}
+
+static void __host_flash_erase(uint32_t address) {
+  memset((void *)(uintptr_t)(address & ~(HOST_FLASH_SECTOR_SIZE - 1U)), 0xFF, HOST_FLASH_SECTOR_SIZE);
+  host_flash_stats.erase_ops++;
+}
+
+static void *__host_flash_job(void *arg) {
+  host_flash_job_t *job = arg;
+
+  job->result = job->fn();
+  return NULL;
+}
+
+/*==============================================================================
+
+                            GLOBAL FUNCTION DEFINITIONS
+
+==============================================================================*/
+
+bool host_flash_map(void) {
+  void *flash = mmap((void *)(uintptr_t)HOST_FLASH_BASE, HOST_FLASH_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+  if ((MAP_FAILED == flash) || ((void *)(uintptr_t)HOST_FLASH_BASE != flash)) {
+    return false;
+  }
+
+  host_flash_erase_all();
+  return true;
+}
+
+void host_flash_erase_all(void) {
+  memset((void *)(uintptr_t)HOST_FLASH_BASE, 0xFF, HOST_FLASH_SIZE);
+  host_flash_pending = false;
+}
+
+void host_flash_get_stats(host_flash_stats_t *stats) {
+  *stats = host_flash_stats;
+}
+
+void host_flash_reset_stats(void) {
+  memset(&host_flash_stats, 0, sizeof(host_flash_stats));
+}
+
+int host_flash_run(int (*fn)(void)) {
+  host_flash_job_t job = {.fn = fn, .result = -1};
+  pthread_attr_t attr;
+  pthread_t thread;
+  void *stack;
+
+  stack = mmap(NULL, HOST_FLASH_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+  if (MAP_FAILED == stack) {
+    return -1;
+  }
+
+  pthread_attr_init(&attr);
+  pthread_attr_setstack(&attr, stack, HOST_FLASH_STACK_SIZE);
+
+  if (0 == pthread_create(&thread, &attr, __host_flash_job, &job)) {
+    pthread_join(thread, NULL);
+  }
+
+  pthread_attr_destroy(&attr);
+  munmap(stack, HOST_FLASH_STACK_SIZE);
+
+  return job.result;
+}
+
+cy_en_flashdrv_status_t Cy_Flash_BlankCheck(void *context, const cy_stc_flash_blankcheck_config_t *config,
+                                            cy_en_flash_driver_blocking_t block) {
+  (void)context;
+  (void)block;
+
+  host_flash_stats.blank_checks++;
+  host_flash_stats.blank_check_words += config->numOfWordsToBeChecked;
+
+  for (uint32_t i = 0; i < config->numOfWordsToBeChecked; i++) {
+    if (0xFFFFFFFFU != config->addrToBeChecked[i]) {
+      return CY_FLASH_DRV_FLASH_NOT_ERASED;
+    }
+  }
+
+  return CY_FLASH_DRV_SUCCESS;
+}
+
+asdk_errorcode_t asdk_flash_init(asdk_flash_config_t *flash_config) {
+  (void)flash_config;
+
+  host_flash_pending = false;
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_flash_deinit(asdk_flash_config_t *flash_config) {
+  (void)flash_config;
+
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
+bool asdk_flash_is_operation_complete(void) {
+  if (host_flash_pending && (++host_flash_polls >= host_flash_latency_polls)) {
+    if (host_flash_pending_erase) {
+      __host_flash_erase(host_flash_pending_addr);
+    } else {
+      __host_flash_program(host_flash_pending_addr, (const uint8_t *)&host_flash_pending_word, 4U);
+    }
+
+    host_flash_pending = false;
+  }
+
+  return !host_flash_pending;
+}
+
+asdk_errorcode_t asdk_flash_write_blocking(asdk_flash_operation_config_t *flash_write_config, uint32_t timeout_ms) {
+  (void)timeout_ms;
+
+  if (!__host_flash_in_range(flash_write_config->destination_addr, flash_write_config->size_in_bytes)) {
+    return ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS;
+  }
+
+  __host_flash_program(flash_write_config->destination_addr,
+                       (const uint8_t *)(uintptr_t)flash_write_config->source_addr,
+                       flash_write_config->size_in_bytes);
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
+/* no row buffering on the host, every write is programmed right away */
+asdk_errorcode_t asdk_flash_write_buffered(asdk_flash_operation_config_t *flash_write_config, uint32_t timeout_ms) {
+  return asdk_flash_write_blocking(flash_write_config, timeout_ms);
+}
+
+asdk_errorcode_t asdk_flash_flush(uint32_t timeout_ms) {
+  (void)timeout_ms;
+
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_flash_write_non_blocking(asdk_flash_operation_config_t *flash_write_config) {
+  if (host_flash_pending) {
+    return ASDK_FLASH_STATUS_BUSY;
+  }
+
+  if ((4U != flash_write_config->size_in_bytes) ||
+      !__host_flash_in_range(flash_write_config->destination_addr, 4U)) {
+    return ASDK_FLASH_ERROR_INVALID_DATA_SIZE;
+  }
+
+  memcpy(&host_flash_pending_word, (const void *)(uintptr_t)flash_write_config->source_addr, 4U);
+  host_flash_pending_addr = flash_write_config->destination_addr;
+  host_flash_pending_erase = false;
+  host_flash_pending = true;
+  host_flash_polls = 0;
+
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_flash_erase_sector_blocking(uint32_t Base_Sector_Address, uint32_t timeout_ms) {
+  (void)timeout_ms;
+
+  if (!__host_flash_in_range(Base_Sector_Address, HOST_FLASH_SECTOR_SIZE)) {
+    return ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS;
+  }
+
+  __host_flash_erase(Base_Sector_Address);
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_flash_erase_sector_non_blocking(uint32_t Base_Sector_Address) {
+  if (host_flash_pending) {
+    return ASDK_FLASH_STATUS_BUSY;
+  }
+
+  if (!__host_flash_in_range(Base_Sector_Address, HOST_FLASH_SECTOR_SIZE)) {
+    return ASDK_FLASH_ERROR_INVALID_FLASH_ADDRESS;
+  }
+
+  host_flash_pending_addr = Base_Sector_Address;
+  host_flash_pending_erase = true;
+  host_flash_pending = true;
+  host_flash_polls = 0;
+
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
+
+asdk_errorcode_t asdk_flash_get_sector_size(uint32_t address, uint32_t *flash_sector_size) {
+  (void)address;
+
+  *flash_sector_size = HOST_FLASH_SECTOR_SIZE;
+  return ASDK_FLASH_STATUS_SUCCESS;
+}
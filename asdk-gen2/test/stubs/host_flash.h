@@ -0,0 +1,62 @@
+/*
+   @file
+   host_flash.h
+
+   @path
+   test/stubs/host_flash.h
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   RAM-backed work flash for the host tests. Implements asdk_flash.h and the
+   PDL blank check over the large sectors of the work flash, mapped at their
+   device address so the DAL can keep passing addresses as uint32_t.
+
+   Programming clears bits only, like NOR flash, and programming a word that
+   is not erased is counted (the ECC work flash does not allow it). A
+   non-blocking operation completes after host_flash_latency_polls calls to
+   asdk_flash_is_operation_complete().
+
+   The DAL also passes stack addresses as uint32_t, so code under test runs
+   through host_flash_run() on a stack below 4 GB. Build with -no-pie.
+*/
+
+#ifndef HOST_FLASH_H
+#define HOST_FLASH_H
+
+#include "asdk_flash.h"
+
+#define HOST_FLASH_BASE WORKFLASH_LARGE_START_ADDRESS
+#define HOST_FLASH_SIZE ((WORKFLASH_LARGE_END_ADDRESS + 1) - WORKFLASH_LARGE_START_ADDRESS)
+#define HOST_FLASH_SECTOR_SIZE 2048U
+
+typedef struct {
+  uint32_t blank_checks;
+  uint32_t blank_check_words;
+  uint32_t program_ops;
+  uint32_t program_bytes;
+  uint32_t erase_ops;
+  uint32_t overwrites; /* words programmed while not erased */
+} host_flash_stats_t;
+
+extern uint32_t host_flash_latency_polls;
+
+/* maps the work flash, erased, false when the address range is taken */
+bool host_flash_map(void);
+
+void host_flash_erase_all(void);
+
+void host_flash_get_stats(host_flash_stats_t *stats);
+void host_flash_reset_stats(void);
+
+/* runs fn on a stack below 4 GB, returns its result */
+int host_flash_run(int (*fn)(void));
+
+#endif /* HOST_FLASH_H */
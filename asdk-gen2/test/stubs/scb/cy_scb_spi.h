@@ -0,0 +1,25 @@
+/*
+   @file
+   cy_scb_spi.h
+
+   @path
+   test/stubs/scb/cy_scb_spi.h
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Empty host stand-in of the PDL header, the DAL sources under test include
+   it without using it.
+*/
+
+#ifndef CY_SCB_SPI_H
+#define CY_SCB_SPI_H
+
+#endif /* CY_SCB_SPI_H */
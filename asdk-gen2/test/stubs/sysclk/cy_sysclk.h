@@ -0,0 +1,25 @@
+/*
+   @file
+   cy_sysclk.h
+
+   @path
+   test/stubs/sysclk/cy_sysclk.h
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Empty host stand-in of the PDL header, the DAL sources under test include
+   it without using it.
+*/
+
+#ifndef CY_SYSCLK_H
+#define CY_SYSCLK_H
+
+#endif /* CY_SYSCLK_H */
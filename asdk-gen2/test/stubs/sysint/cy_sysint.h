@@ -0,0 +1,25 @@
+/*
+   @file
+   cy_sysint.h
+
+   @path
+   test/stubs/sysint/cy_sysint.h
+
+   @Created on
+   Oct 17, 2026
+
+   @Author
+   Ather Energy Pvt Ltd.
+
+   @Copyright
+   Copyright (c) Ather Energy Pvt Ltd.  All rights reserved.
+
+   @brief
+   Empty host stand-in of the PDL header, the DAL sources under test include
+   it without using it.
+*/
+
+#ifndef CY_SYSINT_H
+#define CY_SYSINT_H
+
+#endif /* CY_SYSINT_H */
@@ -11,41 +11,45 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define MAGIC_SIZE 		4
-#define FOOTER_SIZE		8
-#define MAX_FILE_SIZE	(1024 * 256)
-#define CRC_POLYNOMIAL 	0xEDB88320
+#include "crc32.h"
 
-char fbuff[MAX_FILE_SIZE];
+#define MAGIC_SIZE 		CRC32_FOOTER_MAGIC_SIZE
+#define FOOTER_SIZE		sizeof(footer_t)
+#define CHUNK_SIZE		(1024 * 64)
 
-typedef struct footer{
-	uint32_t crc;
-	char magic[MAGIC_SIZE];
-}footer_t;
+typedef crc32_footer_t footer_t;
 
-uint32_t getFileSize(FILE *file)
+/* images of any size are streamed through this buffer */
+static uint8_t chunk[CHUNK_SIZE];
+
+long getFileSize(FILE *file)
 {
 	fseek( file, 0L, SEEK_END);
-	uint32_t size = ftell( file );
+	long size = ftell( file );
 	fseek( file, 0L, SEEK_SET);
 	return size;
 }
 
-uint32_t get_crc(uint8_t *data, uint32_t len)
+/* CRC of the first len bytes of the file */
+int get_crc(FILE *file, long len, uint32_t *crc)
 {
-       uint32_t crc = 0;
-       uint32_t  i, k, j = 0;
-
-       crc = ~crc;
-       for(k = 0; k < len; k++)
-       {
-               crc = crc ^ data[j++];
-               for (i = 0; i < 8; i++)
-               {
-                       crc = (crc >> 1) ^ (CRC_POLYNOMIAL & -(crc & 1));
-               }
-       }
-       return ~crc;
+	size_t n;
+
+	*crc = 0;
+	fseek(file, 0L, SEEK_SET);
+
+	while (len > 0) {
+		n = (len < CHUNK_SIZE) ? (size_t)len : CHUNK_SIZE;
+
+		if (fread(chunk, n, 1, file) != 1) {
+			return -1;
+		}
+
+		*crc = crc32(chunk, n, *crc);
+		len -= (long)n;
+	}
+
+	return 0;
 }
 
 /* Make sure file is padded & aligned with 256 bytes -
@@ -54,13 +58,12 @@ int main(int argc, char* argv[])
 {
 	  FILE *binfile;
 	  char *filename = NULL;
-	  uint8_t buff[FOOTER_SIZE];
 	  char *magic = NULL;
+	  const char *magic_end = NULL;
 	  long f_size = 0;
-	  footer_t *foot = (footer_t *)buff;
-	  uint8_t foot_buff[MAGIC_SIZE];
-	  footer_t *file_foot = (footer_t *)foot_buff;
-	  int offset = 0;
+	  footer_t foot;
+	  footer_t file_foot;
+	  long offset = 0;
 
 	  if (argc < 3) {
 		  printf("Usage: %s filename.bin bin_name\n", argv[0]);
@@ -68,6 +71,7 @@ int main(int argc, char* argv[])
 	  }
 
 	  filename = argv[1];
+	  magic = argv[2];
 
 	  /* Append Magic string at the end */
 	  binfile = fopen(filename, "r+b");
@@ -76,45 +80,34 @@ int main(int argc, char* argv[])
 		  exit(1);
 	  }
 
-	  magic = argv[2];
-
 	  f_size = getFileSize(binfile);
 
-	  /* Move to the starting of file */
-	  fseek(binfile, 0x0, SEEK_SET);
+	  /* An existing footer is replaced */
+	  if (f_size >= (long)FOOTER_SIZE) {
+		  fseek(binfile, -(long)FOOTER_SIZE, SEEK_END);
 
-	  /* Read from the file */
-	  if ((fread(fbuff, f_size, 1, binfile)) != 1) {
-		  perror("fread");
-		  exit(1);
+		  if ((fread(&file_foot, FOOTER_SIZE, 1, binfile) == 1) &&
+		      (strncmp(file_foot.magic, magic, MAGIC_SIZE) == 0)) {
+			  offset = FOOTER_SIZE;
+		  }
 	  }
 
-	  fseek(binfile, -8, SEEK_END);
-	  fread(foot_buff, FOOTER_SIZE, 1, binfile);
-
-	  int ret = strncmp(file_foot->magic, magic, MAGIC_SIZE);
-
-	  if (ret == 0) {
-			 offset = 8;
-	  } else {
-			 offset = 0;
+	  if (get_crc(binfile, f_size - offset, &foot.crc) != 0) {
+		  perror("fread");
+		  exit(1);
 	  }
+	  printf("crc = 0x%x\n", foot.crc);
 
-	  foot->crc = get_crc(fbuff, (f_size-offset));
-	  printf("crc = 0x%x\n", foot->crc);
+	  /* Copy the magic string to the footer, zero padded when shorter */
+	  magic_end = memchr(magic, '\0', MAGIC_SIZE);
+	  memset(foot.magic, 0, MAGIC_SIZE);
+	  memcpy(foot.magic, magic, (magic_end != NULL) ? (size_t)(magic_end - magic) : MAGIC_SIZE);
+	  printf("magic = %.*s\n", MAGIC_SIZE, foot.magic);
 
-	  /* Copy the magic string to a buffer */
-	  strncpy(&buff[4], magic, MAGIC_SIZE);
-	  printf("magic = %s\n", foot->magic);
-
-	  if (offset == 0) {
-		  fseek(binfile, 0x0, SEEK_END);
-	  } else {
-		  fseek(binfile, -8, SEEK_END);
-	  }
+	  fseek(binfile, f_size - offset, SEEK_SET);
 
 	  /* Write the magic string */
-	  fwrite(buff, FOOTER_SIZE, 1, binfile);
+	  fwrite(&foot, FOOTER_SIZE, 1, binfile);
 
 	  fclose(binfile);
 
@@ -4,10 +4,16 @@
 #include "adc_cfg.h"
 #include "defaults.h"
 
-/* ASDK User Action: Add new ADC pins here */
+/* ASDK User Action: Add new ADC pins here, all pins on one SAR module */
 
-asdk_mcu_pin_t adc_pins[] = {
-    LDR_ADC_PIN,
+asdk_mcu_pin_t adc_pins[ADC_CH_MAX] = {
+    [ADC_CH_LDR] = LDR_ADC_PIN,
+};
+
+/* ASDK User Action: Filter of each ADC pin */
+
+app_adc_filter_t adc_filter[ADC_CH_MAX] = {
+    [ADC_CH_LDR] = { .median = true, .iir_shift = 3 },
 };
 
 /* ******** CAUTION! Do not edit below code ******** */
@@ -18,4 +24,9 @@ asdk_adc_config_t adc_conf = {
     .enable_interrupt = true, 
     .intr_num = ASDK_EXTI_INTR_CPU_4, 
     .interrupt_priority = 3, 
+    .enable_group = true,
+    .enable_continuous = true,
+    .average_samples = 256,
+    .enable_dma = true,
+    .grp_callback = app_adc_group_callback,
 };
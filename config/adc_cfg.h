@@ -5,4 +5,12 @@
 
 #define LDR_ADC_PIN     MCU_PIN_34      // LDR Sensor
 
+/* ASDK User Action: Add an index for every pin in adc_pins[] */
+
+typedef enum {
+    ADC_CH_LDR = 0,
+
+    ADC_CH_MAX,
+} adc_channel_t;
+
 #endif /* ADC_CFG_H */
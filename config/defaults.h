@@ -26,6 +26,18 @@
     } \
 }
 
+/* input debounced by gpio_event, interrupts on both edges */
+#define GPIO_EVENT_INPUT_CONFIG(pin) {\
+    .mcu_pin = pin, \
+    .gpio_mode = ASDK_GPIO_MODE_INPUT, \
+    .gpio_pull = ASDK_GPIO_HIGH_Z, \
+    .interrupt_config = {   \
+        .intr_num = ASDK_EXTI_INTR_CPU_4, \
+        .type = ASDK_GPIO_INTERRUPT_BOTH_EDGES, \
+        .priority = 3, \
+    } \
+}
+
 #define COLOR_SENSOR_INPUT(pin) {\
     .mcu_pin = pin, \
     .gpio_mode = ASDK_GPIO_MODE_INPUT, \
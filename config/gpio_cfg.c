@@ -1,4 +1,5 @@
 #include "app_gpio.h"
+#include "gpio_event.h"
 
 #include "defaults.h"
 #include "gpio_cfg.h"
@@ -15,15 +16,26 @@ asdk_gpio_config_t gpio_output_config[] = {
 /* ASDK User Action: Add new input pins here */
 
 asdk_gpio_config_t gpio_input_config[] = {
-    GPIO_INPUT_CONFIG(USER_BUTTON),      GPIO_INPUT_CONFIG(IR1_SENSE),
-    GPIO_INPUT_CONFIG(IR2_SENSE),        GPIO_INPUT_CONFIG(ULTRASONIC_ECHO1),
-    GPIO_INPUT_CONFIG(ULTRASONIC_ECHO2), GPIO_INPUT_CONFIG(RAIN1_SENSE),
+    GPIO_EVENT_INPUT_CONFIG(USER_BUTTON), GPIO_EVENT_INPUT_CONFIG(IR1_SENSE),
+    GPIO_EVENT_INPUT_CONFIG(IR2_SENSE),   GPIO_EVENT_INPUT_CONFIG(RAIN1_SENSE),
+    // ULTRASONIC_ECHOx pins are owned by the echo capture timers, see ultrasonic_cfg.c
     // GPIO_INPUT_CONFIG_WITH_INTERRUPT(USER_BUTTON),
 };
 
+/* ASDK User Action: Add debounced inputs here, configured with GPIO_EVENT_INPUT_CONFIG above */
+
+gpio_event_config_t gpio_event_config[] = {
+    {.pin = USER_BUTTON, .debounce_us = USER_BUTTON_DEBOUNCE_US},
+    {.pin = IR1_SENSE, .debounce_us = IR_SENSE_DEBOUNCE_US},
+    {.pin = IR2_SENSE, .debounce_us = IR_SENSE_DEBOUNCE_US},
+    {.pin = RAIN1_SENSE, .debounce_us = RAIN_SENSE_DEBOUNCE_US},
+};
+
 /* ******** CAUTION! Do not edit below code ******** */
 
 const uint8_t gpio_output_config_size =
     sizeof(gpio_output_config) / sizeof(gpio_output_config[0]);
 const uint8_t gpio_input_config_size =
     sizeof(gpio_input_config) / sizeof(gpio_input_config[0]);
+const uint8_t gpio_event_config_size =
+    sizeof(gpio_event_config) / sizeof(gpio_event_config[0]);
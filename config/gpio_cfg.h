@@ -14,6 +14,11 @@
 
 #define RAIN1_SENSE MCU_PIN_32
 
+/* debounce times of the gpio_event inputs */
+#define USER_BUTTON_DEBOUNCE_US 20000
+#define IR_SENSE_DEBOUNCE_US 2000
+#define RAIN_SENSE_DEBOUNCE_US 50000
+
 #define ULTRASONIC_ECHO1 MCU_PIN_68
 #define ULTRASONIC_TRIG1 MCU_PIN_67
 
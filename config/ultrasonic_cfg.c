@@ -0,0 +1,23 @@
+#include "gpio_cfg.h"
+#include "ultrasonic_cfg.h"
+#include "ultrasonic.h"
+
+/* ASDK User Action: Add new sensors here, in ultrasonic_channel_t order */
+
+ultrasonic_config_t ultrasonic_config[] = {
+    [ULTRASONIC_ROAD] = {
+        .echo_timer_ch = ULTRASONIC_ECHO1_TIMER,
+        .echo_pin = ULTRASONIC_ECHO1,
+        .trigger_pin = ULTRASONIC_TRIG1,
+    },
+    [ULTRASONIC_OBSTACLE] = {
+        .echo_timer_ch = ULTRASONIC_ECHO2_TIMER,
+        .echo_pin = ULTRASONIC_ECHO2,
+        .trigger_pin = ULTRASONIC_TRIG2,
+    },
+};
+
+/* ******** CAUTION! Do not edit below code ******** */
+
+const uint8_t ultrasonic_config_size =
+    sizeof(ultrasonic_config) / sizeof(ultrasonic_config[0]);
@@ -0,0 +1,25 @@
+#ifndef ULTRASONIC_CFG_H
+#define ULTRASONIC_CFG_H
+
+#include "asdk_timer.h"
+
+/* ASDK User Action: Define echo timers here, the counter must have the echo pin
+   on its trigger input 0, refer asdk_pinmux.c */
+
+#define ULTRASONIC_ECHO1_TIMER ASDK_TIMER_MODULE_CH_70 // TCPWM1 CH7, P18.1
+#define ULTRASONIC_ECHO2_TIMER ASDK_TIMER_MODULE_CH_59 // TCPWM0 CH59, P17.2
+
+/* shared one-shot timer releasing the trigger pins */
+#define ULTRASONIC_TRIGGER_TIMER ASDK_TIMER_MODULE_CH_77
+
+#define ULTRASONIC_INTR_NUM ASDK_EXTI_INTR_CPU_4
+#define ULTRASONIC_INTR_PRIORITY 3
+
+/* ASDK User Action: Index of each sensor in ultrasonic_config[] */
+
+typedef enum {
+    ULTRASONIC_ROAD = 0, // pothole detection
+    ULTRASONIC_OBSTACLE, // obstacle warning
+} ultrasonic_channel_t;
+
+#endif /* ULTRASONIC_CFG_H */
@@ -1,10 +1,44 @@
 #ifndef ULTRASONIC_H
 #define ULTRASONIC_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "asdk_mcu_pins.h"
-#include "app_gpio.h"
+#include "asdk_platform.h"
+
+/* sensors supported, each channel needs its own capture callback */
+#define ULTRASONIC_CHANNEL_MAX 4
+
+/* echo timers count microseconds, 16-bit period covers the 38 ms no-echo pulse */
+#define ULTRASONIC_ECHO_CLOCK_HZ 1000000
+#define ULTRASONIC_ECHO_TIMER_PERIOD 0xFFFF
+
+/* trigger pins are released by a one-shot timer, sensors need at least 10 us */
+#define ULTRASONIC_TRIGGER_PULSE_US 12
+
+/* sound travels 0.343 mm/us, halved for the round trip */
+#define ULTRASONIC_ECHO_US_TO_MM(us) (((us) * 343U) / 2000U)
+
+typedef struct {
+    asdk_timer_channel_t echo_timer_ch; /* counter with echo_pin on its trigger input 0 */
+    asdk_mcu_pin_t echo_pin;
+    asdk_mcu_pin_t trigger_pin;         /* GPIO output */
+} ultrasonic_config_t;
+
+typedef struct {
+    uint32_t echo_us;     /* echo pulse width */
+    uint32_t distance_mm;
+    uint32_t sequence;    /* incremented for every published result */
+    bool valid;           /* false when no echo completed since the last trigger */
+} ultrasonic_result_t;
+
+extern ultrasonic_config_t ultrasonic_config[];
+extern const uint8_t ultrasonic_config_size;
 
+void ultrasonic_init(void);
 void ultrasonic_iterations(void);
-uint32_t ultrsonic_get_distance(asdk_mcu_pin_t mcu_pin);
+bool ultrasonic_get_result(uint8_t channel, ultrasonic_result_t *result);
+uint32_t ultrasonic_get_distance_cm(uint8_t channel);
 
-#endif /* ULTRASONIC_H */
\ No newline at end of file
+#endif /* ULTRASONIC_H */
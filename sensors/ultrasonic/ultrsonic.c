@@ -1,89 +1,245 @@
-#include "gpio_cfg.h"
+#include <stddef.h>
+
+#include "asdk_gpio.h"
+#include "asdk_timer.h"
+
+#include "ultrasonic_cfg.h"
 #include "ultrasonic.h"
 
-static uint32_t current_time;
-static uint32_t last_time_trigger;
-static bool trigger_flag;
+/* echo edges of one channel, only touched by its capture ISR */
+typedef struct {
+    uint32_t rise;    /* counter at the rising edge */
+    uint8_t wraps;    /* terminal counts since the rising edge, may be one off */
+    bool echo_high;
+} ultrasonic_capture_t;
+
+/* latest result, the capture ISR is the only writer: seq is odd while it writes */
+typedef struct {
+    volatile uint32_t seq;
+    uint32_t echo_us;
+    bool valid;
+} ultrasonic_slot_t;
+
+static ultrasonic_capture_t captures[ULTRASONIC_CHANNEL_MAX];
+static ultrasonic_slot_t slots[ULTRASONIC_CHANNEL_MAX];
+
+/* trigger bookkeeping, task context only */
+static uint8_t channel_count;
+static uint32_t seq_at_trigger[ULTRASONIC_CHANNEL_MAX];
+static bool timed_out[ULTRASONIC_CHANNEL_MAX];
+
+static void __ultrasonic_capture(uint8_t channel, asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value);
+static void __ultrasonic_publish(uint8_t channel, uint32_t echo_us, bool valid);
+static void __ultrasonic_trigger_release(asdk_timer_event_t event);
+
+static void __ultrasonic_capture_0(asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value);
+static void __ultrasonic_capture_1(asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value);
+static void __ultrasonic_capture_2(asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value);
+static void __ultrasonic_capture_3(asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value);
 
-static bool ultrasonic_echo_flag_1;
+/* the capture callback has no channel argument, one entry per channel */
+static const asdk_capture_callback_t capture_callbacks[ULTRASONIC_CHANNEL_MAX] = {
+    __ultrasonic_capture_0,
+    __ultrasonic_capture_1,
+    __ultrasonic_capture_2,
+    __ultrasonic_capture_3,
+};
 
-static uint32_t distance_start_1;
+static asdk_timer_t echo_timer_config = {
+    .type = ASDK_TIMER_TYPE_PERIODIC,
+    .mode = {
+        .type = ASDK_TIMER_MODE_CAPTURE,
+        .config.capture = {
+            .timer_period = ULTRASONIC_ECHO_TIMER_PERIOD,
+            .edge = ASDK_TIMER_CAPTURE_ON_BOTH_EDGES,
+        },
+    },
+    .direction = ASDK_TIMER_COUNT_DIRECTION_UP,
+    .interrupt = {
+        .enable = true,
+        .intr_num = ULTRASONIC_INTR_NUM,
+        .priority = ULTRASONIC_INTR_PRIORITY,
+    },
+    .counter_clock = {
+        .frequency = ULTRASONIC_ECHO_CLOCK_HZ,
+        .prescaler = ASDK_CLOCK_PRESCALER_1,
+    },
+};
 
-static uint32_t distance_increment_1;
+static asdk_timer_t trigger_timer_config = {
+    .type = ASDK_TIMER_TYPE_ONE_SHOT,
+    .mode = {
+        .type = ASDK_TIMER_MODE_TIMER,
+        .config.timer = {
+            .timer_period = ULTRASONIC_TRIGGER_PULSE_US,
+            .callback = __ultrasonic_trigger_release,
+        },
+    },
+    .direction = ASDK_TIMER_COUNT_DIRECTION_UP,
+    .interrupt = {
+        .enable = true,
+        .intr_num = ULTRASONIC_INTR_NUM,
+        .priority = ULTRASONIC_INTR_PRIORITY,
+    },
+    .counter_clock = {
+        .frequency = ULTRASONIC_ECHO_CLOCK_HZ,
+        .prescaler = ASDK_CLOCK_PRESCALER_1,
+    },
+};
 
-static uint32_t total_distance_1;
-static uint32_t total_distance_2;
-static uint32_t total_distance_3;
-static uint32_t total_distance_4;
+static void __ultrasonic_capture_0(asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value)
+{
+    __ultrasonic_capture(0, event, edge, value);
+}
+
+static void __ultrasonic_capture_1(asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value)
+{
+    __ultrasonic_capture(1, event, edge, value);
+}
+
+static void __ultrasonic_capture_2(asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value)
+{
+    __ultrasonic_capture(2, event, edge, value);
+}
 
-static void __ultrasonic_trigger(void);
-static void __ultrasonic_echo(void);
+static void __ultrasonic_capture_3(asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value)
+{
+    __ultrasonic_capture(3, event, edge, value);
+}
 
-static void __ultrasonic_echo(void)
+static void __ultrasonic_capture(uint8_t channel, asdk_timer_event_t event, asdk_timer_capture_edge_t edge, uint32_t value)
 {
-    uint8_t ultrasonic_state1 = 0;
-    
-    ultrasonic_state1 = app_gpio_get_pin_state(ULTRASONIC_ECHO1);
-    if (ultrasonic_state1) {
-        if (ultrasonic_echo_flag_1) {
-           distance_start_1 = asdk_sys_get_time_ms();
-           ultrasonic_echo_flag_1 = false;
+    ultrasonic_capture_t *capture = &captures[channel];
+    uint32_t echo_us = 0;
+    bool valid = true;
+
+    if (ASDK_TIMER_TERMINAL_COUNT_EVENT == event) {
+        if (capture->echo_high && (capture->wraps < UINT8_MAX)) {
+            capture->wraps++;
+        }
+        return;
+    }
+
+    if (ASDK_TIMER_CAPTURE_ON_RISING_EDGE == edge) {
+        capture->rise = value;
+        capture->wraps = 0;
+        capture->echo_high = true;
+    } else if ((ASDK_TIMER_CAPTURE_ON_FALLING_EDGE == edge) && capture->echo_high) {
+        capture->echo_high = false;
+
+        /* echoes are shorter than the period, so the captured value tells whether
+           the counter wrapped. With a capture and TC pending in one interrupt the
+           DAL reports TC first, wraps can be one off either way around the edge */
+        if (value >= capture->rise) {
+            echo_us = value - capture->rise;
+        } else {
+            echo_us = value + ULTRASONIC_ECHO_TIMER_PERIOD - capture->rise;
+        }
+
+        /* stuck high for more than a period */
+        if (1 < capture->wraps) {
+            valid = false;
+            echo_us = 0;
         }
-        distance_increment_1 = asdk_sys_get_time_ms();
-    } else {
-        total_distance_1 = (distance_increment_1 - distance_start_1);
-        /* NOTE: The distance calculation is based on the formula:
-            object_distance = velocity of sound / (2*time)
-            total_distance = total_distance * MILLI_TO_MICRO / object_distance;
-        */
-        /* Todo: Calculate distance */
-        ultrasonic_echo_flag_1 = true;
-    }    
+
+        __ultrasonic_publish(channel, echo_us, valid);
+    }
+}
+
+static void __ultrasonic_publish(uint8_t channel, uint32_t echo_us, bool valid)
+{
+    ultrasonic_slot_t *slot = &slots[channel];
+
+    slot->seq++;
+    ASDK_MEMORY_BARRIER()
+    slot->echo_us = echo_us;
+    slot->valid = valid;
+    ASDK_MEMORY_BARRIER()
+    slot->seq++;
 }
 
-static void __ultrasonic_trigger(void)
+static void __ultrasonic_trigger_release(asdk_timer_event_t event)
 {
-    current_time = asdk_sys_get_time_ms();
-    if ((current_time - last_time_trigger) < 100)
+    if (ASDK_TIMER_TERMINAL_COUNT_EVENT != event) {
         return;
+    }
+
+    for (uint8_t i = 0; i < channel_count; i++) {
+        asdk_gpio_output_clear(ultrasonic_config[i].trigger_pin);
+    }
+}
 
-    if (trigger_flag == 0) {
-        app_gpio_set_pin_state(ULTRASONIC_TRIG1, 1);
-        /* ASDK User Action: Add new ULTRASONIC_TRIG pin here */
-        trigger_flag = true;
-    } else {
-        app_gpio_set_pin_state(ULTRASONIC_TRIG1, 0);
-        /* ASDK User Action: Add new ULTRASONIC_TRIG pin here */
-        trigger_flag = false;
-        last_time_trigger = current_time;
+void ultrasonic_init(void)
+{
+    asdk_errorcode_t status = ASDK_TIMER_SUCCESS;
+
+    channel_count = (ultrasonic_config_size < ULTRASONIC_CHANNEL_MAX) ? ultrasonic_config_size : ULTRASONIC_CHANNEL_MAX;
+
+    for (uint8_t i = 0; i < channel_count; i++) {
+        echo_timer_config.mode.config.capture.mcu_pin = ultrasonic_config[i].echo_pin;
+        echo_timer_config.mode.config.capture.callback = capture_callbacks[i];
+
+        status = asdk_timer_init(ultrasonic_config[i].echo_timer_ch, &echo_timer_config);
+        ASDK_DEV_ERROR_ASSERT(status, ASDK_TIMER_SUCCESS);
+
+        status = asdk_timer_start(ultrasonic_config[i].echo_timer_ch);
+        ASDK_DEV_ERROR_ASSERT(status, ASDK_TIMER_SUCCESS);
     }
+
+    status = asdk_timer_init(ULTRASONIC_TRIGGER_TIMER, &trigger_timer_config);
+    ASDK_DEV_ERROR_ASSERT(status, ASDK_TIMER_SUCCESS);
 }
 
+/* call at the measurement rate, echoes of the previous call are complete by then */
 void ultrasonic_iterations(void)
 {
-    __ultrasonic_trigger();
-    __ultrasonic_echo();
+    for (uint8_t i = 0; i < channel_count; i++) {
+        timed_out[i] = (slots[i].seq == seq_at_trigger[i]);
+        seq_at_trigger[i] = slots[i].seq;
+
+        asdk_gpio_output_set(ultrasonic_config[i].trigger_pin);
+    }
+
+    asdk_timer_start(ULTRASONIC_TRIGGER_TIMER);
+}
+
+bool ultrasonic_get_result(uint8_t channel, ultrasonic_result_t *result)
+{
+    ultrasonic_slot_t *slot;
+    uint32_t seq;
+
+    if ((channel >= channel_count) || (NULL == result)) {
+        return false;
+    }
+
+    slot = &slots[channel];
+
+    /* retry when the capture ISR published while copying */
+    do {
+        seq = slot->seq;
+        ASDK_MEMORY_BARRIER()
+        result->echo_us = slot->echo_us;
+        result->valid = slot->valid;
+        ASDK_MEMORY_BARRIER()
+    } while ((seq & 1U) || (seq != slot->seq));
+
+    result->sequence = seq / 2U;
+    result->distance_mm = ULTRASONIC_ECHO_US_TO_MM(result->echo_us);
+
+    if (timed_out[channel]) {
+        result->valid = false;
+    }
+
+    return (0U != result->sequence);
 }
 
-uint32_t ultrsonic_get_distance(asdk_mcu_pin_t mcu_pin)
+uint32_t ultrasonic_get_distance_cm(uint8_t channel)
 {
-    switch (mcu_pin)
-    {
-    case ULTRASONIC_ECHO1:
-    return total_distance_1;
-
-    case ULTRASONIC_ECHO2:
-    return total_distance_2;
-
-    case ULTRASONIC_ECHO3:
-    return total_distance_3;
-
-    case ULTRASONIC_ECHO4:
-    return total_distance_4;
-    
-    default:
-        break;
+    ultrasonic_result_t result;
+
+    if (!ultrasonic_get_result(channel, &result) || !result.valid) {
+        return 0;
     }
 
-    return 0;
+    return result.distance_mm / 10U;
 }